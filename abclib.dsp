@@ -3915,6 +3915,10 @@ SOURCE=.\src\opt\dau\dau.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauBatch.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
@@ -5015,6 +5019,22 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilProf.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilProf.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -5915,6 +5935,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -6867,6 +6891,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
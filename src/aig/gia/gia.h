@@ -42,7 +42,15 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// the wide object layout (compile with ABC_USE_GIA_WIDE) extends the fanin diffs
+// to 30 bits, which is the largest object count representable by int literals
+#ifdef ABC_USE_GIA_WIDE
+#define GIA_NONE 0x3FFFFFFF
+#define GIA_OBJ_LOG 30
+#else
 #define GIA_NONE 0x1FFFFFFF
+#define GIA_OBJ_LOG 29
+#endif
 #define GIA_VOID 0x0FFFFFFF
 
 ////////////////////////////////////////////////////////////////////////
@@ -74,6 +82,24 @@ struct Gia_Plc_t_
 };
 
 typedef struct Gia_Obj_t_ Gia_Obj_t;
+#ifdef ABC_USE_GIA_WIDE
+struct Gia_Obj_t_
+{
+    unsigned       iDiff0 :  30;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+    unsigned       fMark0 :   1;  // first user-controlled mark
+
+    unsigned       iDiff1 :  30;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+    unsigned       fMark1 :   1;  // second user-controlled mark
+
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused:  30;  // unused
+
+    unsigned       Value;         // application-specific value
+};
+#else
 struct Gia_Obj_t_
 {
     unsigned       iDiff0 :  29;  // the diff of the first fanin
@@ -88,6 +114,7 @@ struct Gia_Obj_t_
 
     unsigned       Value;         // application-specific value
 };
+#endif
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
@@ -683,9 +710,10 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew;
+        if ( p->nObjs == (1 << GIA_OBJ_LOG) )
+            printf( "Hard limit on the number of nodes (2^%d) is reached. Quitting...\n", GIA_OBJ_LOG ), exit(1);
+        nObjNew = p->nObjsAlloc < (1 << (GIA_OBJ_LOG-1)) ? 2 * p->nObjsAlloc : (1 << GIA_OBJ_LOG);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
@@ -1276,8 +1304,9 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1311,6 +1340,7 @@ extern void                Cbs_ManStop( Cbs_Man_t * p );
 extern int                 Cbs_ManSolve( Cbs_Man_t * p, Gia_Obj_t * pObj );
 extern int                 Cbs_ManSolve2( Cbs_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pObj2 );
 extern Vec_Int_t *         Cbs_ManSolveMiterNc( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int f0Proved, int fVerbose );
+extern Vec_Int_t *         Cbs_ManSolveMiterNcInt( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int f0Proved, int fKeepRefs, int fVerbose );
 extern void                Cbs_ManSetConflictNum( Cbs_Man_t * p, int Num );
 extern Vec_Int_t *         Cbs_ReadModel( Cbs_Man_t * p );
 /*=== giaCTas.c ============================================================*/
@@ -1335,6 +1365,7 @@ extern int                 Gia_ManSuppSize( Gia_Man_t * p, int * pNodes, int nNo
 extern int                 Gia_ManConeSize( Gia_Man_t * p, int * pNodes, int nNodes );
 extern Vec_Vec_t *         Gia_ManLevelize( Gia_Man_t * p );
 extern Vec_Wec_t *         Gia_ManLevelizeR( Gia_Man_t * p );
+extern Vec_Wec_t *         Gia_ManLevelizeCuts( Gia_Man_t * p );
 extern Vec_Int_t *         Gia_ManOrderReverse( Gia_Man_t * p );
 extern void                Gia_ManCollectTfi( Gia_Man_t * p, Vec_Int_t * vRoots, Vec_Int_t * vNodes );
 extern void                Gia_ManCollectTfo( Gia_Man_t * p, Vec_Int_t * vRoots, Vec_Int_t * vNodes );
@@ -1517,6 +1548,13 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+/*=== giaHashPar.c ===========================================================*/
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+extern Gia_HashPar_t *     Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashParStop( Gia_HashPar_t * pHash );
+extern int                 Gia_ManHashParAnd( Gia_HashPar_t * pHash, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nProcs );
+extern void                Gia_ManHashParBench( Gia_Man_t * p, int nProcs, int fVerbose );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintOutputLutStats( Gia_Man_t * p );
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
@@ -1649,6 +1687,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimOutPar( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts, int nProcs );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
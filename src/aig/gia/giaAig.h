@@ -66,6 +66,8 @@ extern Gia_Man_t *         Gia_ManPerformDch( Gia_Man_t * p, void * pPars );
 extern Gia_Man_t *         Gia_ManAbstraction( Gia_Man_t * p, Vec_Int_t * vFlops );
 extern void                Gia_ManSeqCleanupClasses( Gia_Man_t * p, int fConst, int fEquiv, int fVerbose );
 extern int                 Gia_ManSolveSat( Gia_Man_t * p );
+/*=== giaStoch.c =============================================================*/
+extern Gia_Man_t *         Gia_ManCompress2Par( Gia_Man_t * p, int fUpdateLevel, int nWinSize, int nProcs, int fVerbose );
 
 
 ABC_NAMESPACE_HEADER_END
@@ -24,6 +24,13 @@
 #include "base/main/main.h"
 #include "map/if/if.h"
 
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -163,18 +170,166 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND section of the binary AIGER in parallel.]
+
+  Description [The AND section is split into blocks of bytes. The first pass
+  counts the varint terminators (bytes without the high bit) in each block, 
+  which gives the index of the first varint starting in each block. The 
+  second pass decodes the AND gates whose first varint starts in the block.
+  If the AIG is read without structural hashing, the objects are created
+  directly because the i-th AND gate is the i-th object after the CIs.
+  Otherwise, the fanin literals are returned to be hashed sequentially.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerBlock_t_ Gia_AigerBlock_t;
+struct Gia_AigerBlock_t_
+{
+    Gia_Man_t *     pNew;     // the AIG whose objects are created (or NULL)
+    int *           pLits;    // the fanin literals of the AND gates (or NULL)
+    unsigned char * pStart;   // the beginning of the AND section
+    unsigned char * pBeg;     // the beginning of the block
+    unsigned char * pEnd;     // the end of the block
+    word            nTerms;   // the number of terminators in (then before) the block
+    int             nAnds;    // the number of AND gates
+    int             nCis;     // the number of CIs
+    int             nBufs;    // the number of buffers created
+};
+int Gia_AigerCountBlock( void * pArg )
+{
+    Gia_AigerBlock_t * p = (Gia_AigerBlock_t *)pArg;
+    unsigned char * pCur;
+    word nTerms = 0;
+    for ( pCur = p->pBeg; pCur < p->pEnd; pCur++ )
+        nTerms += !(*pCur & 0x80);
+    p->nTerms = nTerms;
+    return 1;
+}
+int Gia_AigerDecodeBlock( void * pArg )
+{
+    Gia_AigerBlock_t * p = (Gia_AigerBlock_t *)pArg;
+    unsigned char * pCur = p->pBeg;
+    word iVar = p->nTerms, nVars = 2 * (word)p->nAnds;
+    unsigned uLit0, uLit1, uLit;
+    int iAnd, iObj;
+    // skip the varint started in the previous block
+    if ( pCur > p->pStart && (pCur[-1] & 0x80) )
+    {
+        while ( *pCur++ & 0x80 );
+        iVar++;
+    }
+    // skip the second varint of the AND gate started in the previous block
+    if ( (iVar & 1) && iVar < nVars )
+    {
+        while ( *pCur++ & 0x80 );
+        iVar++;
+    }
+    for ( ; pCur < p->pEnd && iVar < nVars; iVar += 2 )
+    {
+        iAnd  = (int)(iVar >> 1);
+        iObj  = iAnd + 1 + p->nCis;
+        uLit  = ((unsigned)iObj << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( p->pLits )
+        {
+            p->pLits[2*(size_t)iAnd+0] = (int)uLit0;
+            p->pLits[2*(size_t)iAnd+1] = (int)uLit1;
+            continue;
+        }
+        // same as Gia_ManAppendAnd() or Gia_ManAppendBuf() when the literals are equal
+        {
+            Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+            assert( uLit0 <= uLit1 && Abc_Lit2Var(uLit1) < iObj );
+            pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(uLit0));
+            pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(uLit0));
+            pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(uLit1));
+            pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(uLit1));
+            p->nBufs += (uLit0 == uLit1);
+        }
+    }
+    return 1;
+}
+unsigned char * Gia_AigerDecodeAndsPar( Gia_Man_t * pNew, unsigned char * pStart, unsigned char * pLimit, int nAnds, int nCis, int fDirect, int ** ppLits, int nProcs )
+{
+    Gia_AigerBlock_t * pBlocks;
+    Vec_Ptr_t * vData;
+    unsigned char * pCur = NULL;
+    word nVars = 2 * (word)nAnds, nTerms = 0, nTermsBlock;
+    size_t nBytes, nBlockSize;
+    int i, nBlocks = 16 * nProcs, iLast = -1;
+    *ppLits = NULL;
+    // each AND gate takes at most 10 bytes
+    nBytes = Abc_MinWord( (word)(pLimit - pStart), 10 * (word)nAnds );
+    nBlockSize = nBytes / nBlocks + 1;
+    pBlocks = ABC_CALLOC( Gia_AigerBlock_t, nBlocks );
+    vData = Vec_PtrAlloc( nBlocks );
+    for ( i = 0; i < nBlocks; i++ )
+    {
+        pBlocks[i].pStart = pStart;
+        pBlocks[i].pBeg   = pStart + Abc_MinWord( (word)i * nBlockSize, nBytes );
+        pBlocks[i].pEnd   = pStart + Abc_MinWord( (word)(i+1) * nBlockSize, nBytes );
+        pBlocks[i].nAnds  = nAnds;
+        pBlocks[i].nCis   = nCis;
+        Vec_PtrPush( vData, pBlocks + i );
+    }
+    Util_ProcessThreads( Gia_AigerCountBlock, vData, nProcs + 1, 0, 0 );
+    // convert the counts into the number of terminators before each block
+    for ( i = 0; i < nBlocks; i++ )
+    {
+        nTermsBlock = pBlocks[i].nTerms;
+        pBlocks[i].nTerms = nTerms;
+        if ( iLast == -1 && nTerms + nTermsBlock >= nVars )
+            iLast = i;
+        nTerms += nTermsBlock;
+    }
+    if ( iLast == -1 ) // the AND section is truncated
+    {
+        Vec_PtrFree( vData );
+        ABC_FREE( pBlocks );
+        return NULL;
+    }
+    // find the end of the AND section in the last block
+    nTerms = pBlocks[iLast].nTerms;
+    for ( pCur = pBlocks[iLast].pBeg; nTerms < nVars; pCur++ )
+        nTerms += !(*pCur & 0x80);
+    // decode the blocks
+    if ( fDirect )
+        pNew->nObjs = 1 + nCis + nAnds;
+    else
+        *ppLits = ABC_ALLOC( int, 2 * (size_t)nAnds );
+    Vec_PtrClear( vData );
+    for ( i = 0; i <= iLast; i++ )
+    {
+        pBlocks[i].pNew  = pNew;
+        pBlocks[i].pLits = *ppLits;
+        Vec_PtrPush( vData, pBlocks + i );
+    }
+    Util_ProcessThreads( Gia_AigerDecodeBlock, vData, nProcs + 1, 0, 0 );
+    for ( i = 0; i <= iLast; i++ )
+        pNew->nBufs += pBlocks[i].nBufs;
+    Vec_PtrFree( vData );
+    ABC_FREE( pBlocks );
+    return pCur;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The AND section is decoded by nProcs threads if nProcs > 1.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -183,8 +338,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned char * pDrivers, * pSymbols, * pCur, * pCurPar = NULL;
     unsigned uLit0, uLit1, uLit;
+    int * pLits = NULL;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -254,10 +410,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
     }
 
-    // allocate the empty AIG
+    // allocate the empty AIG with the CI/CO arrays sized as given in the header
     pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
     pNew->nConstrs = nConstr;
     pNew->fGiaSimple = fGiaSimple;
+    Vec_IntFree( pNew->vCis );
+    Vec_IntFree( pNew->vCos );
+    pNew->vCis = Vec_IntAlloc( nInputs + nLatches );
+    pNew->vCos = Vec_IntAlloc( nOutputs + nLatches );
 
     // prepare the array of nodes
     vNodes = Vec_IntAlloc( 1 + nTotal );
@@ -284,14 +444,34 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates in parallel
+    if ( nProcs > 1 && nAnds >= (1 << 16) )
+        pCurPar = Gia_AigerDecodeAndsPar( pNew, pCur, (unsigned char *)pContents + nFileSize, nAnds, nInputs + nLatches, !fGiaSimple && fSkipStrash, &pLits, nProcs );
+    if ( pCurPar && pLits == NULL )
+    {
+        // the objects are already created
+        for ( i = 0; i < nAnds; i++ )
+            Vec_IntPush( vNodes, Abc_Var2Lit(i + 1 + nInputs + nLatches, 0) );
+        pCur = pCurPar;
+    }
+    else
+    {
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pLits )
+        {
+            uLit0 = (unsigned)pLits[2*(size_t)i+0];
+            uLit1 = (unsigned)pLits[2*(size_t)i+1];
+        }
+        else
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -308,6 +488,10 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    if ( pLits )
+        pCur = pCurPar;
+    ABC_FREE( pLits );
+    }
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -625,7 +809,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );             pCur += 4;
                 memcpy( Vec_StrArray(vStr), pCur, (size_t)Vec_StrSize(vStr) );
                 pCur += Vec_StrSize(vStr);
-                pNew->pAigExtra = Gia_AigerReadFromMemory( Vec_StrArray(vStr), Vec_StrSize(vStr), 0, 0, 0 );
+                pNew->pAigExtra = Gia_AigerReadFromMemoryInt( Vec_StrArray(vStr), Vec_StrSize(vStr), 0, 0, 0, 1 );
                 Vec_StrFree( vStr );
                 if ( fVerbose ) printf( "Finished reading extension \"a\".\n" );
             }
@@ -1059,6 +1243,57 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the AIGER file into memory.]
+
+  Description [Returns NULL if the file cannot be mapped, in which case
+  it should be read into a buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerMapFile( char * pFileName, size_t * pnFileSize )
+{
+#ifndef WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    // the last byte is read as a terminator by the name parser, so the file 
+    // should not end on a page boundary, where the mapping ends as well
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size % sysconf(_SC_PAGESIZE) == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    // the mapping is private because the name parser writes into the buffer
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+    *pnFileSize = (size_t)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_AigerUnmapFile( char * pContents, size_t nFileSize )
+{
+#ifndef WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -1070,24 +1305,33 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
+    size_t nFileSize;
     int RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    // decode the file directly from the page cache if it can be mapped
+    if ( (pContents = Gia_AigerMapFile( pFileName, &nFileSize )) )
+    {
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nProcs );
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nProcs );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1100,6 +1344,10 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
 
 
 
@@ -1345,9 +1593,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
+    // write the nodes into the buffer, which is flushed when full
+    // (one node takes at most 10 bytes, so the buffer size does not depend on the AIG size)
     Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+    nBufferSize = 8 * Abc_MinInt( Gia_ManAndNum(p), (1 << 20) ) + 100;
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1359,16 +1608,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
         if ( Pos > nBufferSize - 10 )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            fwrite( pBuffer, 1, Pos, pFile );
+            Pos = 0;
         }
     }
     assert( Pos < nBufferSize );
 
-    // write the buffer
+    // write the rest of the buffer
     fwrite( pBuffer, 1, Pos, pFile );
     ABC_FREE( pBuffer );
 
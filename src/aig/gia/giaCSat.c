@@ -1027,14 +1027,15 @@ void Cbs_ManSatPrintStats( Cbs_Man_t * p )
 
   Synopsis    [Procedure to test the new SAT solver.]
 
-  Description []
+  Description [If fKeepRefs is set, uses the fanout counts given by the 
+  caller in pAig->pRefs instead of recomputing them.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int f0Proved, int fVerbose )
+Vec_Int_t * Cbs_ManSolveMiterNcInt( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int f0Proved, int fKeepRefs, int fVerbose )
 {
     extern void Gia_ManCollectTest( Gia_Man_t * pAig );
     extern void Cec_ManSatAddToStore( Vec_Int_t * vCexStore, Vec_Int_t * vCex, int Out );
@@ -1047,7 +1048,8 @@ Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvSt
     assert( Gia_ManRegNum(pAig) == 0 );
 //    Gia_ManCollectTest( pAig );
     // prepare AIG
-    Gia_ManCreateRefs( pAig );
+    if ( !fKeepRefs || pAig->pRefs == NULL )
+        Gia_ManCreateRefs( pAig );
     Gia_ManCleanMark0( pAig );
     Gia_ManCleanMark1( pAig );
     Gia_ManFillValue( pAig ); // maps nodes into trail ids
@@ -1132,6 +1134,10 @@ Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvSt
 //        (Vec_IntSize(vCexStore)-2*p->nSatUndec-2*p->nSatSat)/p->nSatSat );
     return vCexStore;
 }
+Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int f0Proved, int fVerbose )
+{
+    return Cbs_ManSolveMiterNcInt( pAig, nConfs, pvStatus, f0Proved, 0, fVerbose );
+}
 
 
 ////////////////////////////////////////////////////////////////////////
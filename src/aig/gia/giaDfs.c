@@ -444,6 +444,40 @@ Vec_Wec_t * Gia_ManLevelizeR( Gia_Man_t * p )
     }
     return vLevels;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Levelizes the internal nodes for cut computation.]
+
+  Description [The level of a node is one more than the largest level 
+  of its fanins, including the control input of a MUX and the next node
+  in the choice class. The nodes of one level do not depend on each 
+  other when cuts are computed. Level 0 contains no nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_ManLevelizeCuts( Gia_Man_t * p )
+{ 
+    Gia_Obj_t * pObj;
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p) );
+    int i, Level;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(p, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjFaninId2(p, i)) );
+        if ( Gia_ObjSibl(p, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjSibl(p, i)) );
+        Vec_IntWriteEntry( vLevel, i, ++Level );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
 /**Function*************************************************************
 
   Synopsis    [Computes reverse topological order.]
@@ -0,0 +1,387 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#endif
+
+#endif
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// without pthreads, the table is only used by one thread
+#ifdef ABC_USE_PTHREADS
+typedef atomic_int Gia_HashParInt_t;
+#define Gia_HashParLoad( pPlace )             atomic_load_explicit( pPlace, memory_order_acquire )
+#define Gia_HashParStore( pPlace, Value )     atomic_store_explicit( pPlace, Value, memory_order_release )
+#define Gia_HashParAdd( pPlace )              atomic_fetch_add_explicit( pPlace, 1, memory_order_relaxed )
+static inline int Gia_HashParClaim( Gia_HashParInt_t * pPlace, int Value )
+{
+    int Expected = 0;
+    return atomic_compare_exchange_strong_explicit( pPlace, &Expected, Value, memory_order_acq_rel, memory_order_acquire );
+}
+#else
+typedef int Gia_HashParInt_t;
+#define Gia_HashParLoad( pPlace )             (*(pPlace))
+#define Gia_HashParStore( pPlace, Value )     (*(pPlace) = (Value))
+#define Gia_HashParAdd( pPlace )              ((*(pPlace))++)
+static inline int Gia_HashParClaim( Gia_HashParInt_t * pPlace, int Value )
+{
+    if ( *pPlace )
+        return 0;
+    *pPlace = Value;
+    return 1;
+}
+#endif
+
+#define GIA_HASH_BUSY  (-1)       // the entry is claimed but the node is not written yet
+
+struct Gia_HashPar_t_
+{
+    Gia_Man_t *        pGia;      // the manager
+    int                nObjsMax;  // the number of objects reserved in the manager
+    int                fHashed;   // the manager had a sequential hash table
+    unsigned           Mask;      // the table size minus one
+    Gia_HashParInt_t * pTable;    // open-addressed table of node IDs
+    Gia_HashParInt_t   nObjs;     // the number of objects in the manager
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the first table entry to probe for this node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_ManHashParOne( int iLit0, int iLit1, unsigned Mask )
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1 + (unsigned)iLit1 * 0x85EBCA6B;
+    Key ^= Key >> 15;
+    return Key & Mask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts concurrent structural hashing.]
+
+  Description [Reserves the storage for nObjsMax objects in the manager,
+  so that the object array is not reallocated while the threads add nodes.
+  The open-addressed table has at least twice as many entries as there are
+  objects and therefore never needs resizing. Only AND nodes can be added
+  until Gia_ManHashParStop() is called. While the concurrent table is used,
+  Gia_ManObjNum() does not count the new nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashPar_t * Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_HashPar_t * pHash;
+    Gia_Obj_t * pObj;
+    int i, nSize = 1;
+    assert( p->pMuxes == NULL && p->pFanData == NULL && p->vSuppWords == NULL );
+    assert( !p->fSweeper && !p->fBuiltInSim && !p->fAddStrash );
+    assert( nObjsMax >= Gia_ManObjNum(p) && nObjsMax <= (1 << GIA_OBJ_LOG) );
+    // reserve the object storage
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    while ( nSize < 2 * nObjsMax )
+        nSize <<= 1;
+    pHash = ABC_CALLOC( Gia_HashPar_t, 1 );
+    pHash->pGia     = p;
+    pHash->nObjsMax = nObjsMax;
+    pHash->fHashed  = Vec_IntSize(&p->vHTable) > 0;
+    pHash->Mask     = (unsigned)nSize - 1;
+    pHash->pTable   = ABC_CALLOC( Gia_HashParInt_t, nSize );
+    Gia_HashParStore( &pHash->nObjs, Gia_ManObjNum(p) );
+    if ( pHash->fHashed )
+        Gia_ManHashStop( p );
+    // add the existing nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        unsigned Key = Gia_ManHashParOne( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), pHash->Mask );
+        while ( pHash->pTable[Key] )
+            Key = (Key + 1) & pHash->Mask;
+        pHash->pTable[Key] = i;
+    }
+    return pHash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops concurrent structural hashing.]
+
+  Description [Should be called after all threads adding nodes are done.
+  Restores the sequential hash table if the manager had one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashParStop( Gia_HashPar_t * pHash )
+{
+    Gia_Man_t * p = pHash->pGia;
+    p->nObjs = Gia_HashParLoad( &pHash->nObjs );
+    if ( pHash->fHashed )
+        Gia_ManHashStart( p );
+    ABC_FREE( pHash->pTable );
+    ABC_FREE( pHash );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds an AND node using concurrent structural hashing.]
+
+  Description [Can be called by several threads at the same time. A thread
+  inserting a new node first claims an empty table entry, then takes the
+  next object ID and writes the node, and finally publishes its ID in the
+  entry. The node is always created after its fanins, so the object order
+  remains topological. Threads looking for the same node wait until it is
+  published. The IDs of the new nodes depend on the thread schedule.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashParAnd( Gia_HashPar_t * pHash, int iLit0, int iLit1 )
+{
+    Gia_Obj_t * pObjs = pHash->pGia->pObjs;
+    unsigned Key;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ManHashParOne( iLit0, iLit1, pHash->Mask );
+    while ( 1 )
+    {
+        int iThis = Gia_HashParLoad( pHash->pTable + Key );
+        if ( iThis == GIA_HASH_BUSY )
+            continue;
+        if ( iThis == 0 )
+        {
+            Gia_Obj_t * pObj;
+            if ( !Gia_HashParClaim( pHash->pTable + Key, GIA_HASH_BUSY ) )
+                continue;
+            iThis = Gia_HashParAdd( &pHash->nObjs );
+            if ( iThis >= pHash->nObjsMax )
+                printf( "The number of objects reserved for concurrent hashing (%d) is exceeded. Quitting...\n", pHash->nObjsMax ), exit(1);
+            pObj = pObjs + iThis;
+            pObj->iDiff0  = (unsigned)(iThis - Abc_Lit2Var(iLit0));
+            pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+            pObj->iDiff1  = (unsigned)(iThis - Abc_Lit2Var(iLit1));
+            pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+            Gia_HashParStore( pHash->pTable + Key, iThis );
+            return Abc_Var2Lit( iThis, 0 );
+        }
+        if ( Gia_ObjFaninLit0(pObjs + iThis, iThis) == iLit0 && Gia_ObjFaninLit1(pObjs + iThis, iThis) == iLit1 )
+            return Abc_Var2Lit( iThis, 0 );
+        Key = (Key + 1) & pHash->Mask;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG using several threads.]
+
+  Description [Each thread builds the logic cones of every nProcs-th
+  combinational output, with a private copy of the node literals. Logic
+  shared by the cones is added once because all threads use the same
+  table. The result has the same nodes as that of Gia_ManRehash() but
+  their order depends on the thread schedule.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_RehashPar_t_ Gia_RehashPar_t;
+struct Gia_RehashPar_t_
+{
+    Gia_Man_t *        p;         // the old manager
+    Gia_HashPar_t *    pHash;     // the concurrent table of the new manager
+    Vec_Int_t *        vCoLits;   // the literals of the CO drivers
+    int                iThread;   // the thread number
+    int                nThreads;  // the number of threads
+};
+int Gia_ManRehashParThread( void * pArg )
+{
+    Gia_RehashPar_t * pData = (Gia_RehashPar_t *)pArg;
+    Gia_Man_t * p = pData->p;
+    Vec_Int_t * vCopies = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj; int i, Id, iDriver;
+    Vec_IntWriteEntry( vCopies, 0, 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vCopies, Gia_ObjId(p, pObj), Abc_Var2Lit(1 + i, 0) );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        if ( i % pData->nThreads != pData->iThread )
+            continue;
+        // build the cone in the DFS order without recursion
+        iDriver = Gia_ObjFaninId0p( p, pObj );
+        if ( Vec_IntEntry(vCopies, iDriver) == -1 )
+            Vec_IntPush( vStack, iDriver );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            Gia_Obj_t * pNode = Gia_ManObj( p, (Id = Vec_IntEntryLast(vStack)) );
+            int iFan0 = Gia_ObjFaninId0(pNode, Id);
+            int iFan1 = Gia_ObjFaninId1(pNode, Id);
+            if ( Vec_IntEntry(vCopies, Id) >= 0 )
+            {
+                Vec_IntPop( vStack );
+                continue;
+            }
+            if ( Vec_IntEntry(vCopies, iFan0) == -1 || Vec_IntEntry(vCopies, iFan1) == -1 )
+            {
+                if ( Vec_IntEntry(vCopies, iFan0) == -1 )
+                    Vec_IntPush( vStack, iFan0 );
+                if ( Vec_IntEntry(vCopies, iFan1) == -1 )
+                    Vec_IntPush( vStack, iFan1 );
+                continue;
+            }
+            Vec_IntWriteEntry( vCopies, Id, Gia_ManHashParAnd( pData->pHash,
+                Abc_LitNotCond(Vec_IntEntry(vCopies, iFan0), Gia_ObjFaninC0(pNode)),
+                Abc_LitNotCond(Vec_IntEntry(vCopies, iFan1), Gia_ObjFaninC1(pNode)) ) );
+            Vec_IntPop( vStack );
+        }
+        Vec_IntWriteEntry( pData->vCoLits, i, Abc_LitNotCond(Vec_IntEntry(vCopies, iDriver), Gia_ObjFaninC0(pObj)) );
+    }
+    Vec_IntFree( vCopies );
+    Vec_IntFree( vStack );
+    return 1;
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nProcs )
+{
+    Gia_RehashPar_t * pThData;
+    Gia_HashPar_t * pHash;
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Ptr_t * vData;
+    Vec_Int_t * vCoLits = Vec_IntStartFull( Gia_ManCoNum(p) );
+    int i, nThreads = Abc_MaxInt( 1, Abc_MinInt(nProcs, 100) - 1 );
+    assert( p->pMuxes == NULL && Gia_ManXorNum(p) == 0 && Gia_ManBufNum(p) == 0 );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManForEachCi( p, pObj, i )
+        Gia_ManAppendCi( pNew );
+    // reserve the objects for the ANDs and the COs
+    pHash = Gia_ManHashParStart( pNew, Gia_ManObjNum(p) );
+    pThData = ABC_CALLOC( Gia_RehashPar_t, nThreads );
+    vData = Vec_PtrAlloc( nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].p        = p;
+        pThData[i].pHash    = pHash;
+        pThData[i].vCoLits  = vCoLits;
+        pThData[i].iThread  = i;
+        pThData[i].nThreads = nThreads;
+        Vec_PtrPush( vData, pThData + i );
+    }
+    Util_ProcessThreads( Gia_ManRehashParThread, vData, nProcs, 0, 0 );
+    Vec_PtrFree( vData );
+    ABC_FREE( pThData );
+    Gia_ManHashParStop( pHash );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Vec_IntEntry(vCoLits, i) );
+    Vec_IntFree( vCoLits );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares sequential and concurrent rehashing.]
+
+  Description [Rehashes the AIG with 1, 2, 4, etc threads up to nProcs,
+  checks that the number of nodes is the same as that of the sequential
+  rehashing, and prints the speedup.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashParBench( Gia_Man_t * p, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    abctime clk = Abc_Clock(), clkSeq;
+    int nThreads, nAnds;
+    pNew = Gia_ManRehash( p, 0 );
+    clkSeq = Abc_Clock() - clk;
+    nAnds = Gia_ManAndNum( pNew );
+    Gia_ManStop( pNew );
+    printf( "Sequential  : Nodes = %9d. ", nAnds );
+    Abc_PrintTime( 1, "Time", clkSeq );
+    for ( nThreads = 1; nThreads <= nProcs; nThreads *= 2 )
+    {
+        clk = Abc_Clock();
+        pNew = Gia_ManRehashPar( p, nThreads + 1 );
+        clk = Abc_Clock() - clk;
+        printf( "Threads %3d : Nodes = %9d. ", nThreads, Gia_ManAndNum(pNew) );
+        if ( Gia_ManAndNum(pNew) != nAnds )
+            printf( "MISMATCH! " );
+        printf( "Speedup = %6.2f. ", clk ? 1.0*clkSeq/clk : 0 );
+        Abc_PrintTime( 1, "Time", clk );
+        Gia_ManStop( pNew );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
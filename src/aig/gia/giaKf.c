@@ -27,16 +27,6 @@
 #include <unistd.h>
 #endif
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -961,36 +951,20 @@ typedef struct Kf_ThData_t_
 {
     Kf_Set_t *  pSett;
     int         Id;
-    int         Status;
     abctime     clkUsed;
 } Kf_ThData_t;
-void * Kf_WorkerThread( void * pArg )
+int Kf_WorkerThread( void * pArg )
 {
     Kf_ThData_t * pThData = (Kf_ThData_t *)pArg;
     Kf_Man_t * pMan = pThData->pSett->pMan;
     int fAreaOnly = pThData->pSett->pMan->pPars->fAreaOnly;
     int fCutMin = pThData->pSett->pMan->pPars->fCutMin;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        assert( pThData->Id >= 0 );
-        clk = Abc_Clock();
-        Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-    assert( 0 );
-    return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Id >= 0 );
+    Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
+    pThData->clkUsed += Abc_Clock() - clk;
+//    printf( "Finished object %d\n", pThData->Id );
+    return 1;
 }
 Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )  
 {
@@ -1009,12 +983,12 @@ Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )
 }
 void Kf_ManComputeCuts( Kf_Man_t * p )
 {
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Util_Task_t * pTasks[PAR_THR_MAX];
     Kf_ThData_t ThData[PAR_THR_MAX];
     Vec_Int_t * vStack, * vFanins;
     Gia_Obj_t * pObj;
     int nProcs = p->pPars->nProcNum;
-    int i, k, iFan, status, nCountFanins, fRunning;
+    int i, k, iFan, nCountFanins, fRunning;
     abctime clk, clkUsed = 0;
     assert( nProcs <= PAR_THR_MAX );
     // start fanins
@@ -1025,14 +999,14 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     Gia_ManForEachObjReverse( p->pGia, pObj, k )
         if ( Gia_ObjIsAnd(pObj) && Vec_IntEntry(vFanins, k) == 0 )
             Vec_IntPush( vStack, k );
-    // start the threads
+    // the nodes are processed by the thread pool
+    Util_PoolStart( nProcs );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].pSett = p->pSett + i;
         ThData[i].Id = -1;
-        ThData[i].Status = 0;
         ThData[i].clkUsed = 0;
-        status = pthread_create( WorkerThread + i, NULL, Kf_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        pTasks[i] = NULL;
     }
     nCountFanins = Vec_IntSum(vFanins);
     fRunning = 1;
@@ -1040,13 +1014,14 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     {
         for ( i = 0; i < nProcs; i++ )
         {
-            if ( ThData[i].Status )
+            if ( pTasks[i] && !Util_TaskIsDone(pTasks[i]) )
                 continue;
-            assert( ThData[i].Status == 0 );
             if ( ThData[i].Id >= 0 )
             {
                 int iObj = ThData[i].Id;
                 Kf_Set_t * pSett = p->pSett + i;
+                Util_TaskFree( pTasks[i] );
+                pTasks[i] = NULL;
                 //printf( "Closing obj %d with Thread %d:\n", iObj, i );
                 clk = Abc_Clock();
                 // finalize the results
@@ -1074,15 +1049,18 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             if ( Vec_IntSize(vStack) > 0 )
             {
                 ThData[i].Id = Vec_IntPop( vStack );
-                ThData[i].Status = 1;
+                pTasks[i] = Util_PoolSubmit( Kf_WorkerThread, ThData + i );
                 //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
             }
         }
         fRunning = 0;
         for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
+            if ( pTasks[i] != NULL )
                 fRunning = 1;
 //        printf( "fRunning %d\n", fRunning );
+        // sleep till one of the threads finishes
+        if ( fRunning )
+            Util_TaskWaitAny( pTasks, nProcs, 0 );
     }
     Vec_IntForEachEntry( vFanins, iFan, k )
         if ( iFan != 0 )
@@ -1091,13 +1069,8 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             Gia_ObjPrint( p->pGia, Gia_ManObj(p->pGia, k) );
         }
     assert( Vec_IntSum(vFanins) == 0 );
-    // stop the threads
     for ( i = 0; i < nProcs; i++ )
-    {
-        assert( ThData[i].Status == 0 );
-        ThData[i].Id = -1;
-        ThData[i].Status = 1;
-    }
+        assert( pTasks[i] == NULL );
     Gia_ManStaticFanoutStop( p->pGia );
     Vec_IntFree( vStack );
     Vec_IntFree( vFanins );
@@ -71,6 +71,7 @@ struct Lf_Mem_t_
     int             MaskPage;        // page mask
     int             nCutWords;       // cut size in words
     int             iCur;            // writing position 
+    int             fNoRecycle;      // cuts are not saved in the order of node IDs
     Vec_Ptr_t       vPages;          // memory pages
     Vec_Ptr_t *     vFree;           // free pages 
 };
@@ -111,11 +112,15 @@ struct Lf_Man_t_
     int             nCutMux;         // non-trivial MUX cuts
     int             nCutEqual;       // equal two cuts
     int             nCutCounts[LF_LEAF_MAX+1];
+    // parallel data
+    Vec_Wec_t *     vLevels;         // nodes by level
+    Vec_Mem_t *     vTtMemLoc;       // truth tables computed by the thread
+    int             fCutSetsExt;     // cutsets are allocated by the caller
 };
 
 static inline void        Lf_CutCopy( Lf_Cut_t * p, Lf_Cut_t * q, int n ) { memcpy(p, q, sizeof(word) * n);                                         }
 static inline Lf_Cut_t *  Lf_CutNext( Lf_Cut_t * p, int n )               { return (Lf_Cut_t *)((word *)p + n);                                     }
-static inline word *      Lf_CutTruth( Lf_Man_t * p, Lf_Cut_t * pCut )    { return Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc));           }
+static inline word *      Lf_CutTruth( Lf_Man_t * p, Lf_Cut_t * pCut )    { int i = Abc_Lit2Var(pCut->iFunc), n = Vec_MemEntryNum(p->vTtMem); return (p->vTtMemLoc && i >= n) ? Vec_MemReadEntry(p->vTtMemLoc, i - n) : Vec_MemReadEntry(p->vTtMem, i); }
 
 static inline int         Lf_ObjOff( Lf_Man_t * p, int i )                { return Vec_IntEntry(&p->vOffsets, i);                                   }
 static inline int         Lf_ObjRequired( Lf_Man_t * p, int i )           { return Vec_IntEntry(&p->vRequired, i);                                  }
@@ -361,6 +366,11 @@ static inline int Lf_CutCreateUnit( Lf_Cut_t * p, int i )
     p->Sign = ((word)1) << (i & 0x3F);
     return 1;
 }
+static inline Lf_Cut_t * Lf_ManCutSet( Lf_Man_t * p, int Entry )
+{
+    int uMaskPage = (1 << LF_LOG_PAGE) - 1;
+    return (Lf_Cut_t *)((word *)Vec_PtrEntry(&p->vMemSets, Entry >> LF_LOG_PAGE) + p->nSetWords * (Entry & uMaskPage));
+}
 static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
 {
     int uMaskPage = (1 << LF_LOG_PAGE) - 1;
@@ -369,6 +379,11 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
     int Entry = Vec_IntEntry( &p->vCutSets, iOffSet );
     assert( Gia_ObjIsAndNotBuf(pObj) );
     assert( pObj->Value > 0 );
+    if ( p->fCutSetsExt ) // the caller allocates and releases cutsets
+    {
+        assert( Entry >= 0 );
+        return Lf_ManCutSet( p, Entry );
+    }
     if ( Entry == -1 ) // first visit
     {
         if ( Vec_IntSize(&p->vFreeSets) == 0 ) // add new
@@ -391,13 +406,12 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
         Vec_IntPush( &p->vFreeSets, Entry );
         Vec_IntWriteEntry( &p->vCutSets, iOffSet, -1 );
     }
-    return (Lf_Cut_t *)((word *)Vec_PtrEntry(&p->vMemSets, Entry >> LF_LOG_PAGE) + p->nSetWords * (Entry & uMaskPage));
+    return Lf_ManCutSet( p, Entry );
 }
-static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, int Index, Lf_Cut_t ** ppCutSet )
+static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, word * pCutTemp, Lf_Cut_t ** ppCutSet )
 {
-    static word CutTemp[3][LF_CUT_WORDS];
     if ( Vec_IntEntry(&p->vOffsets, iObj) == -1 )
-        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)CutTemp[Index]), iObj );
+        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)pCutTemp), iObj );
     {
         Lf_Cut_t * pCut; 
         int i, nCutNum = p->pPars->nCutNum;
@@ -557,7 +571,7 @@ static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut
         pCut->pLeaves[i] = Prev - Gia_AigerReadUnsigned(&pPlace), Prev = pCut->pLeaves[i];
     pCut->iFunc = fTruth ? Gia_AigerReadUnsigned(&pPlace) : -1;
     assert( pCut->nLeaves >= 2 || pCut->iFunc <= 3 );
-    if ( fRecycle && Page && Vec_PtrEntry(&p->vPages, Page-1) )
+    if ( fRecycle && !p->fNoRecycle && Page && Vec_PtrEntry(&p->vPages, Page-1) )
     {
         Vec_PtrPush( p->vFree, Vec_PtrEntry(&p->vPages, Page-1) );
         Vec_PtrWriteEntry( &p->vPages, Page-1, NULL );
@@ -574,6 +588,7 @@ static inline void Lf_MemRecycle( Lf_Mem_t * p )
             Vec_PtrPush( p->vFree, pPlace );
     Vec_PtrClear( &p->vPages );
     p->iCur = 0;
+    p->fNoRecycle = 0;
 }
 static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pCut )
 {
@@ -587,11 +602,6 @@ static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pC
     pCut->fMux7 = 1;
     return pCut;
 }
-static inline Lf_Cut_t * Lf_ObjCutMux( Lf_Man_t * p, int i )
-{
-    static word CutSet[LF_CUT_WORDS];
-    return Lf_MemLoadMuxCut( p, i, (Lf_Cut_t *)CutSet );
-}
 static inline Lf_Cut_t * Lf_ObjCutBest( Lf_Man_t * p, int i )
 {
     static word CutSet[LF_CUT_WORDS];
@@ -961,6 +971,17 @@ static inline int Lf_ManFindCofVar( word * pTruth, int nWords, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Lf_ManTruthInsert( Lf_Man_t * p, word * pTruth )
+{
+    int * pSpot;
+    if ( p->vTtMemLoc == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    // the shared table is not modified while the threads are running
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    return Vec_MemEntryNum(p->vTtMem) + Vec_MemHashInsert( p->vTtMemLoc, pTruth );
+}
 static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, int fCompl0, int fCompl1, Lf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
@@ -975,7 +996,7 @@ static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
 //    p->nCutMux += Lf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -1004,7 +1025,7 @@ static inline int Lf_CutComputeTruth( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1026,7 +1047,7 @@ static inline int Lf_CutComputeTruthMux6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1054,7 +1075,7 @@ static inline int Lf_CutComputeTruthMux( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1186,6 +1207,7 @@ static inline void Lf_CutParams( Lf_Man_t * p, Lf_Cut_t * pCut, int Required, fl
 void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
 {
     word CutSet[LF_CUT_MAX][LF_CUT_WORDS] = {{0}};
+    word CutTemp[4][LF_CUT_WORDS];
     Lf_Cut_t * pCutSet0, * pCutSet1, * pCutSet2, * pCut0, * pCut1, * pCut2;
     Lf_Cut_t * pCutSet = (Lf_Cut_t *)CutSet, * pCutsR[LF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
@@ -1197,8 +1219,8 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     int nCutWords  = p->nCutWords;
     int fComp0     = Gia_ObjFaninC0(pObj);
     int fComp1     = Gia_ObjFaninC1(pObj);
-    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), 0, &pCutSet0 );
-    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), 1, &pCutSet1 );
+    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), CutTemp[0], &pCutSet0 );
+    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), CutTemp[1], &pCutSet1 );
     int iSibl      = Gia_ObjSibl(p->pGia, iObj);
     int i, k, n, iCutUsed, nCutsR = 0;
     float Value1 = -1, Value2 = -1;
@@ -1233,7 +1255,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Gia_Obj_t * pObjE = Gia_ObjSiblObj(p->pGia, iObj);
         int fCompE = Gia_ObjPhase(pObj) ^ Gia_ObjPhase(pObjE);
-        int nCutsE = Lf_ManPrepareSet( p, iSibl, 2, &pCutSet2 );
+        int nCutsE = Lf_ManPrepareSet( p, iSibl, CutTemp[2], &pCutSet2 );
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCutsE )
         {
             if ( pCut2->pLeaves[0] == iSibl )
@@ -1249,7 +1271,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Lf_Cut_t * pCutSave = NULL;
         int fComp2 = Gia_ObjFaninC2(p->pGia, pObj);
-        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), 2, &pCutSet2 );
+        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), CutTemp[2], &pCutSet2 );
         p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
@@ -1357,7 +1379,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     // mux cut
     if ( p->pPars->fUseMux7 && Gia_ObjIsMuxId(p->pGia, iObj) )
     {
-        pCut2 = Lf_ObjCutMux( p, iObj );
+        pCut2 = Lf_MemLoadMuxCut( p, iObj, (Lf_Cut_t *)CutTemp[3] );
         Lf_CutParams( p, pCut2, Required, FlowRefs, pObj );
         pBest->Delay[2] = pCut2->Delay;
         pBest->Flow[2] = pCut2->Flow;
@@ -2004,6 +2026,7 @@ void Lf_ManFree( Lf_Man_t * p )
     ABC_FREE( p->vSwitches.pArray );
     ABC_FREE( p->vCiArrivals.pArray );
     ABC_FREE( p->pObjBests );
+    Vec_WecFreeP( &p->vLevels );
     ABC_FREE( p );
 }
 
@@ -2135,6 +2158,185 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
     Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     fflush( stdout );
 }
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass using several threads.]
+
+  Description [The nodes of one level do not depend on each other, so 
+  each thread processes a range of them. Before the level is processed,
+  the cutsets of its nodes are allocated. Each thread uses a private copy
+  of the manager, which saves the best cuts and the new truth tables into
+  the memory of the thread. When the level is processed, the best cuts
+  are copied into the shared memory in the order of the nodes and the 
+  new truth tables are added to the shared table in the same order.
+  Finally, the cutsets of the fanins are released as in the sequential 
+  pass. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Lf_ParJob_t_ Lf_ParJob_t;
+struct Lf_ParJob_t_
+{
+    Lf_Man_t *      p;               // the mapping manager
+    Vec_Int_t *     vLevel;          // the nodes of the level
+    int             iStart;          // the first node
+    int             iStop;           // the node following the last one
+    Lf_Mem_t        vStore;          // the cuts saved by the thread
+    Vec_Ptr_t       vFreePages;      // the free memory pages of the thread
+    Vec_Mem_t *     vTtMem;          // the truth tables computed by the thread
+    double          CutCount[4];     // cut counts
+    int             nTimeFails;      // timing fails
+    int             nCutEqual;       // equal two cuts
+    int             nCutCounts[LF_LEAF_MAX+1];
+};
+int Lf_ManComputeMappingJob( void * pArg )
+{
+    Lf_ParJob_t * pJob = (Lf_ParJob_t *)pArg;
+    Lf_Man_t Man = *pJob->p;
+    int i, iObj;
+    memset( Man.CutCount, 0, sizeof(Man.CutCount) );
+    memset( Man.nCutCounts, 0, sizeof(Man.nCutCounts) );
+    Man.nTimeFails           = 0;
+    Man.nCutEqual            = 0;
+    Man.vStoreNew            = pJob->vStore;
+    Man.vStoreOld.fNoRecycle = 1;
+    Man.vTtMemLoc            = pJob->vTtMem;
+    Man.fCutSetsExt          = 1;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        if ( !Gia_ObjIsBuf(Gia_ManObj(Man.pGia, (iObj = Vec_IntEntry(pJob->vLevel, i)))) )
+            Lf_ObjMergeOrder( &Man, iObj );
+    pJob->vStore     = Man.vStoreNew;
+    pJob->nTimeFails = Man.nTimeFails;
+    pJob->nCutEqual  = Man.nCutEqual;
+    memcpy( pJob->CutCount, Man.CutCount, sizeof(Man.CutCount) );
+    memcpy( pJob->nCutCounts, Man.nCutCounts, sizeof(Man.nCutCounts) );
+    return 1;
+}
+static inline int Lf_ManTruthTransfer( Lf_Man_t * p, Vec_Mem_t * vTtMem, int nTtMem, int iFunc )
+{
+    if ( vTtMem == NULL || iFunc < 0 || Abc_Lit2Var(iFunc) < nTtMem )
+        return iFunc;
+    return Abc_Var2Lit( Vec_MemHashInsert(p->vTtMem, Vec_MemReadEntry(vTtMem, Abc_Lit2Var(iFunc) - nTtMem)), Abc_LitIsCompl(iFunc) );
+}
+void Lf_ManTransferCuts( Lf_Man_t * p, Lf_ParJob_t * pJob, int nTtMem )
+{
+    word CutTemp[LF_CUT_WORDS];
+    Lf_Cut_t * pCut, * pCutSet;
+    Lf_Bst_t * pBest;
+    Gia_Obj_t * pObj;
+    int i, k, iObj, fDiff;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+    {
+        pObj = Gia_ManObj( p->pGia, (iObj = Vec_IntEntry(pJob->vLevel, i)) );
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        pBest = Lf_ObjReadBest( p, iObj );
+        fDiff = Lf_BestDiffCuts( pBest );
+        for ( k = 0; k <= fDiff; k++ )
+        {
+            pCut = Lf_MemLoadCut( &pJob->vStore, pBest->Cut[k].Handle, iObj, (Lf_Cut_t *)CutTemp, p->pPars->fCutMin, 0 );
+            pCut->iFunc = Lf_ManTruthTransfer( p, pJob->vTtMem, nTtMem, pCut->iFunc );
+            pBest->Cut[k].Handle = Lf_MemSaveCut( &p->vStoreNew, pCut, iObj );
+        }
+        if ( !fDiff )
+            pBest->Cut[1].Handle = pBest->Cut[0].Handle;
+        if ( pJob->vTtMem == NULL || pObj->Value == 0 )
+            continue;
+        pCutSet = Lf_ManCutSet( p, Vec_IntEntry(&p->vCutSets, Lf_ObjOff(p, iObj)) );
+        Lf_CutSetForEachCut( p->nCutWords, pCutSet, pCut, k, p->pPars->nCutNum )
+            if ( pCut->nLeaves != LF_NO_LEAF )
+                pCut->iFunc = Lf_ManTruthTransfer( p, pJob->vTtMem, nTtMem, pCut->iFunc );
+    }
+    Lf_MemRecycle( &pJob->vStore );
+}
+static inline void Lf_ManReleaseSet( Lf_Man_t * p, int iObj )
+{
+    if ( Vec_IntEntry(&p->vOffsets, iObj) >= 0 )
+        Lf_ManFetchSet( p, iObj );
+}
+void Lf_ManComputeLevels( Lf_Man_t * p )
+{
+    Lf_ParJob_t pJobs[100];
+    Vec_Ptr_t * vData = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vLevel;
+    Gia_Obj_t * pObj;
+    int i, k, n, iObj, nTtMem, nJobsCur, nJobs = Abc_MinInt( p->pPars->nProcNum, 99 );
+    assert( nJobs >= 2 );
+    // the cuts are saved level by level
+    p->vStoreNew.fNoRecycle = 1;
+    memset( pJobs, 0, sizeof(Lf_ParJob_t) * nJobs );
+    for ( i = 0; i < nJobs; i++ )
+    {
+        pJobs[i].p = p;
+        Lf_MemAlloc( &pJobs[i].vStore, 16, &pJobs[i].vFreePages, p->nCutWords );
+        if ( p->vTtMem )
+        {
+            pJobs[i].vTtMem = Vec_MemAlloc( Vec_MemEntrySize(p->vTtMem), 12 );
+            Vec_MemHashAlloc( pJobs[i].vTtMem, 1000 );
+        }
+    }
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+    {
+        // allocate the cutsets of the nodes
+        Gia_ManForEachObjVec( vLevel, p->pGia, pObj, i )
+            if ( !Gia_ObjIsBuf(pObj) && pObj->Value > 0 )
+                Lf_ManFetchSet( p, Gia_ObjId(p->pGia, pObj) );
+        // compute the cuts
+        nJobsCur = Vec_IntSize(vLevel) < 64 * nJobs ? 1 : nJobs;
+        nTtMem = p->vTtMem ? Vec_MemEntryNum(p->vTtMem) : 0;
+        Vec_PtrClear( vData );
+        for ( i = 0; i < nJobsCur; i++ )
+        {
+            pJobs[i].vLevel = vLevel;
+            pJobs[i].iStart = i * Vec_IntSize(vLevel) / nJobsCur;
+            pJobs[i].iStop  = (i + 1) * Vec_IntSize(vLevel) / nJobsCur;
+            if ( pJobs[i].vTtMem )
+                Vec_MemHashClear( pJobs[i].vTtMem );
+            Vec_PtrPush( vData, pJobs + i );
+        }
+        if ( nJobsCur == 1 )
+            Lf_ManComputeMappingJob( pJobs );
+        else
+            Util_ProcessThreads( Lf_ManComputeMappingJob, vData, nJobs + 1, 0, 0 );
+        // collect the results
+        for ( i = 0; i < nJobsCur; i++ )
+        {
+            Lf_ManTransferCuts( p, pJobs + i, nTtMem );
+            for ( n = 0; n < 4; n++ )
+                p->CutCount[n] += pJobs[i].CutCount[n];
+            for ( n = 0; n <= LF_LEAF_MAX; n++ )
+                p->nCutCounts[n] += pJobs[i].nCutCounts[n];
+            p->nTimeFails += pJobs[i].nTimeFails;
+            p->nCutEqual  += pJobs[i].nCutEqual;
+        }
+        // release the cutsets of the fanins
+        Gia_ManForEachObjVec( vLevel, p->pGia, pObj, i )
+        {
+            if ( Gia_ObjIsBuf(pObj) )
+                continue;
+            iObj = Gia_ObjId( p->pGia, pObj );
+            Lf_ManReleaseSet( p, Gia_ObjFaninId0(pObj, iObj) );
+            Lf_ManReleaseSet( p, Gia_ObjFaninId1(pObj, iObj) );
+            if ( Gia_ObjSibl(p->pGia, iObj) )
+                Lf_ManReleaseSet( p, Gia_ObjSibl(p->pGia, iObj) );
+            if ( Gia_ObjIsMuxId(p->pGia, iObj) )
+                Lf_ManReleaseSet( p, Gia_ObjFaninId2(p->pGia, iObj) );
+        }
+    }
+    for ( i = 0; i < nJobs; i++ )
+    {
+        Vec_PtrFreeData( &pJobs[i].vFreePages );
+        ABC_FREE( pJobs[i].vFreePages.pArray );
+        ABC_FREE( pJobs[i].vStore.vPages.pArray );
+        Vec_MemHashFree( pJobs[i].vTtMem );
+        Vec_MemFreeP( &pJobs[i].vTtMem );
+    }
+    Vec_PtrFree( vData );
+}
+
 void Lf_ManComputeMapping( Lf_Man_t * p )
 {
     Gia_Obj_t * pObj;
@@ -2165,6 +2367,8 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
         }
 //        Tim_ManPrint( p->pGia->pManTime );
     }
+    else if ( p->vLevels && !p->fUseEla ) // area flow does not update the references
+        Lf_ManComputeLevels( p );
     else
     {
         Gia_ManForEachAnd( p->pGia, pObj, i )
@@ -2195,6 +2399,8 @@ Gia_Man_t * Lf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     else pCls = pGia;
     p = Lf_ManAlloc( pCls, pPars );
+    if ( pPars->nProcNum > 1 && pCls->pManTime == NULL )
+        p->vLevels = Gia_ManLevelizeCuts( pCls );
     if ( pPars->fVerbose && pPars->fCoarsen )
     {
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
@@ -76,6 +76,10 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    // parallel data
+    Vec_Wec_t *     vLevels;        // nodes by level
+    Vec_Int_t *     vCutsLoc;       // cutsets computed by the thread
+    Vec_Mem_t *     vTtMemLoc;      // truth tables computed by the thread
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -541,6 +545,17 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Mf_ManTruthInsert( Mf_Man_t * p, word * pTruth )
+{
+    int * pSpot;
+    if ( p->vTtMemLoc == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    // the shared table is not modified while the threads are running
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    return Vec_MemEntryNum(p->vTtMem) + Vec_MemHashInsert( p->vTtMemLoc, pTruth );
+}
 static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, int fCompl0, int fCompl1, Mf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
@@ -556,7 +571,7 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -587,7 +602,7 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -611,7 +626,7 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt6CnfSize(t, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)&t, pCutR->nLeaves, &p->vCnfMem) );
@@ -641,7 +656,7 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     if ( (p->pPars->fGenCnf || p->pPars->fGenLit) && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
         Vec_IntPush( &p->vCnfSizes, p->pPars->fGenCnf ? Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) : Kit_TruthLitNum((unsigned *)uTruth, pCutR->nLeaves, &p->vCnfMem) );
@@ -729,17 +744,32 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocCutSet( Mf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1;
-    for ( i = 0; i < nCuts; i++ )
-        nInts += pCuts[i]->nLeaves + 1;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
-    pPlace = Mf_ManCutSet( p, iCur );
+    return iCur;
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, * pPlace, iCur, nInts = 1;
+    for ( i = 0; i < nCuts; i++ )
+        nInts += pCuts[i]->nLeaves + 1;
+    if ( p->vCutsLoc ) // the thread saves cutsets into its own array
+    {
+        iCur = Vec_IntSize( p->vCutsLoc );
+        Vec_IntFillExtra( p->vCutsLoc, iCur + nInts, 0 );
+        pPlace = Vec_IntEntryP( p->vCutsLoc, iCur );
+    }
+    else
+    {
+        iCur = Mf_ManAllocCutSet( p, nInts );
+        pPlace = Mf_ManCutSet( p, iCur );
+    }
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
     {
@@ -1419,6 +1449,7 @@ void Mf_ManFree( Mf_Man_t * p )
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
+    Vec_WecFreeP( &p->vLevels );
     ABC_FREE( p->vCnfSizes.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
@@ -1528,11 +1559,138 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     }
     fflush( stdout );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the nodes level by level using several threads.]
+
+  Description [The nodes of one level do not depend on each other, so 
+  each thread processes a range of them. When cuts are computed, each 
+  thread uses a private copy of the manager, which saves the cutsets and
+  the new truth tables into the arrays of the thread. When the level is 
+  processed, the cutsets are copied into the shared memory in the order
+  of the nodes and the new truth tables are added to the shared table in
+  the same order. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Mf_ParJob_t_ Mf_ParJob_t;
+struct Mf_ParJob_t_
+{
+    Mf_Man_t *      p;              // the mapping manager
+    Vec_Int_t *     vLevel;         // the nodes of the level
+    int             iStart;         // the first node
+    int             iStop;          // the node following the last one
+    Vec_Int_t *     vCuts;          // the cutsets computed by the thread
+    Vec_Mem_t *     vTtMem;         // the truth tables computed by the thread
+    double          CutCount[4];    // cut counts
+    int             nCutCounts[MF_LEAF_MAX+1];
+};
+int Mf_ManComputeCutsJob( void * pArg )
+{
+    Mf_ParJob_t * pJob = (Mf_ParJob_t *)pArg;
+    Mf_Man_t Man = *pJob->p;
+    int i;
+    memset( Man.CutCount, 0, sizeof(Man.CutCount) );
+    memset( Man.nCutCounts, 0, sizeof(Man.nCutCounts) );
+    Man.vCutsLoc  = pJob->vCuts;
+    Man.vTtMemLoc = pJob->vTtMem;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        Mf_ObjMergeOrder( &Man, Vec_IntEntry(pJob->vLevel, i) );
+    memcpy( pJob->CutCount, Man.CutCount, sizeof(Man.CutCount) );
+    memcpy( pJob->nCutCounts, Man.nCutCounts, sizeof(Man.nCutCounts) );
+    return 1;
+}
+void Mf_ManTransferCuts( Mf_Man_t * p, Mf_ParJob_t * pJob, int nTtMem )
+{
+    Mf_Obj_t * pBest;
+    int i, k, iFunc, nInts, * pCut, * pCutSet;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+    {
+        pBest = Mf_ManObj( p, Vec_IntEntry(pJob->vLevel, i) );
+        pCutSet = Vec_IntEntryP( pJob->vCuts, pBest->iCutSet );
+        nInts = 1;
+        Mf_SetForEachCut( pCutSet, pCut, k )
+        {
+            nInts += Mf_CutSize(pCut) + 1;
+            if ( pJob->vTtMem == NULL || Abc_Lit2Var(Mf_CutFunc(pCut)) < nTtMem )
+                continue;
+            iFunc = Vec_MemHashInsert( p->vTtMem, Vec_MemReadEntry(pJob->vTtMem, Abc_Lit2Var(Mf_CutFunc(pCut)) - nTtMem) );
+            pCut[0] = Mf_CutSetBoth( Mf_CutSize(pCut), Abc_Var2Lit(iFunc, Abc_LitIsCompl(Mf_CutFunc(pCut))) );
+        }
+        pBest->iCutSet = Mf_ManAllocCutSet( p, nInts );
+        memcpy( Mf_ManCutSet(p, pBest->iCutSet), pCutSet, sizeof(int) * nInts );
+    }
+}
+void Mf_ManComputeLevels( Mf_Man_t * p, int (*pFuncJob)(void *), int fCuts )
+{
+    Mf_ParJob_t pJobs[100];
+    Vec_Ptr_t * vData = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vLevel;
+    int i, k, n, nTtMem, nJobsCur, nJobs = Abc_MinInt( p->pPars->nProcNum, 99 );
+    assert( nJobs >= 2 );
+    memset( pJobs, 0, sizeof(Mf_ParJob_t) * nJobs );
+    for ( i = 0; i < nJobs; i++ )
+    {
+        pJobs[i].p     = p;
+        pJobs[i].vCuts = fCuts ? Vec_IntAlloc( 1000 ) : NULL;
+        if ( fCuts && p->vTtMem )
+        {
+            pJobs[i].vTtMem = Vec_MemAlloc( Vec_MemEntrySize(p->vTtMem), 12 );
+            Vec_MemHashAlloc( pJobs[i].vTtMem, 1000 );
+        }
+    }
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+    {
+        nJobsCur = Vec_IntSize(vLevel) < 64 * nJobs ? 1 : nJobs;
+        nTtMem = p->vTtMem ? Vec_MemEntryNum(p->vTtMem) : 0;
+        Vec_PtrClear( vData );
+        for ( i = 0; i < nJobsCur; i++ )
+        {
+            pJobs[i].vLevel = vLevel;
+            pJobs[i].iStart = i * Vec_IntSize(vLevel) / nJobsCur;
+            pJobs[i].iStop  = (i + 1) * Vec_IntSize(vLevel) / nJobsCur;
+            if ( fCuts )
+                Vec_IntClear( pJobs[i].vCuts );
+            if ( pJobs[i].vTtMem )
+                Vec_MemHashClear( pJobs[i].vTtMem );
+            Vec_PtrPush( vData, pJobs + i );
+        }
+        if ( nJobsCur == 1 )
+            pFuncJob( pJobs );
+        else
+            Util_ProcessThreads( pFuncJob, vData, nJobs + 1, 0, 0 );
+        if ( !fCuts )
+            continue;
+        for ( i = 0; i < nJobsCur; i++ )
+        {
+            Mf_ManTransferCuts( p, pJobs + i, nTtMem );
+            for ( n = 0; n < 4; n++ )
+                p->CutCount[n] += pJobs[i].CutCount[n];
+            for ( n = 0; n <= MF_LEAF_MAX; n++ )
+                p->nCutCounts[n] += pJobs[i].nCutCounts[n];
+        }
+    }
+    for ( i = 0; i < nJobs; i++ )
+    {
+        Vec_IntFreeP( &pJobs[i].vCuts );
+        Vec_MemHashFree( pJobs[i].vTtMem );
+        Vec_MemFreeP( &pJobs[i].vTtMem );
+    }
+    Vec_PtrFree( vData );
+}
+
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    if ( p->vLevels )
+        Mf_ManComputeLevels( p, Mf_ManComputeCutsJob, 1 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1811,11 +1969,22 @@ void Mf_ManOptimization( Mf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+int Mf_ManComputeMappingJob( void * pArg )
+{
+    Mf_ParJob_t * pJob = (Mf_ParJob_t *)pArg;
+    int i;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        Mf_ObjComputeBestCut( pJob->p, Vec_IntEntry(pJob->vLevel, i) );
+    return 1;
+}
 void Mf_ManComputeMapping( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjComputeBestCut( p, i );
+    if ( p->vLevels && !p->fUseEla ) // area flow does not update the references
+        Mf_ManComputeLevels( p, Mf_ManComputeMappingJob, 0 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjComputeBestCut( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1830,6 +1999,8 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     pCls = pPars->fCoarsen ? Gia_ManDupMuxes(pGia, pPars->nCoarseLimit) : pGia;
     p = Mf_ManAlloc( pCls, pPars );
     p->pGia0 = pGia;
+    if ( pPars->nProcNum > 1 && !pPars->fGenCnf && !pPars->fGenLit )
+        p->vLevels = Gia_ManLevelizeCuts( pCls );
     if ( pPars->fVerbose && pPars->fCoarsen )
     {
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
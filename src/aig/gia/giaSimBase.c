@@ -21,7 +21,7 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
+#include "misc/util/utilSimd.h"
 #include "aig/miniaig/miniaig.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -92,29 +92,23 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
 }
 static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
-    word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
     word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+    word * pSims2 = pSims + nWords*i;
+    if ( Gia_ObjIsMuxId(p, i) )
+        Abc_SimdMux( pSims2, pSims + nWords*Gia_ObjFaninId2(p, i), Gia_ObjFaninC2(p, pObj), pSims1, Gia_ObjFaninC1(pObj), pSims0, Gia_ObjFaninC0(pObj), nWords );
+    else if ( Gia_ObjIsXor(pObj) )
+        Abc_SimdXor( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nWords );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Abc_SimdAnd( pSims2, pSims0, Gia_ObjFaninC0(pObj), pSims1, Gia_ObjFaninC1(pObj), nWords );
 }
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0     = pComps[Gia_ObjFaninC0(pObj)];
     word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
-    word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w]  = (pSims0[w] ^ Diff0);
+    word * pSims2  = pSims + nWords*i;
+    Abc_SimdCopy( pSims2, pSims0, Gia_ObjFaninC0(pObj), nWords );
 }
 static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -154,6 +148,96 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_WrdFree( vSims );
     return vSimsCo;
 }
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AIG using several threads.]
+
+  Description [The simulation words are divided into blocks, which are
+  simulated independently by the threads. Each block is a multiple of
+  eight words, so that the threads do not write into the same cache line.
+  The result is identical to that of Gia_ManSimPatSimOut().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_SimParBlock_t_ Gia_SimParBlock_t;
+struct Gia_SimParBlock_t_
+{
+    Gia_Man_t *    pGia;       // AIG manager
+    Vec_Wrd_t *    vSimsPi;    // input simulation info
+    Vec_Wrd_t *    vSims;      // object simulation info
+    int            nWords;     // the total number of words
+    int            iStart;     // the first word of the block
+    int            iStop;      // the word following the block
+};
+int Gia_ManSimPatSimBlock( void * pArg )
+{
+    Gia_SimParBlock_t * pBlock = (Gia_SimParBlock_t *)pArg;
+    Gia_Man_t * p = pBlock->pGia;
+    word * pSims  = Vec_WrdArray(pBlock->vSims) + pBlock->iStart;
+    word * pSimsPi = Vec_WrdArray(pBlock->vSimsPi) + pBlock->iStart;
+    int nWords = pBlock->nWords, nSize = pBlock->iStop - pBlock->iStart;
+    Gia_Obj_t * pObj; int i, Id;
+    Gia_ManForEachCiId( p, Id, i )
+        memcpy( pSims + nWords*Id, pSimsPi + nWords*i, sizeof(word)*nSize );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
+        word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
+        if ( Gia_ObjIsMuxId(p, i) )
+            Abc_SimdMux( pSims + nWords*i, pSims + nWords*Gia_ObjFaninId2(p, i), Gia_ObjFaninC2(p, pObj), pSims1, Gia_ObjFaninC1(pObj), pSims0, Gia_ObjFaninC0(pObj), nSize );
+        else if ( Gia_ObjIsXor(pObj) )
+            Abc_SimdXor( pSims + nWords*i, pSims0, pSims1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nSize );
+        else
+            Abc_SimdAnd( pSims + nWords*i, pSims0, Gia_ObjFaninC0(pObj), pSims1, Gia_ObjFaninC1(pObj), nSize );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        Id = Gia_ObjId(p, pObj);
+        Abc_SimdCopy( pSims + nWords*Id, pSims + nWords*Gia_ObjFaninId0(pObj, Id), Gia_ObjFaninC0(pObj), nSize );
+    }
+    return 1;
+}
+Vec_Wrd_t * Gia_ManSimPatSimOutPar( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts, int nProcs )
+{
+    Gia_SimParBlock_t * pBlocks;
+    Gia_Obj_t * pObj; Vec_Ptr_t * vData;
+    Vec_Wrd_t * vSims, * vSimsCo;
+    int i, nBlocks, nChunk, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    // the manager thread does not simulate
+    nBlocks = Abc_MinInt( Abc_MinInt(nProcs, 100) - 1, (nWords + 7) / 8 );
+    if ( nProcs <= 2 || nBlocks < 2 )
+        return Gia_ManSimPatSimOut( pGia, vSimsPi, fOuts );
+    nChunk  = 8 * ((nWords + 8 * nBlocks - 1) / (8 * nBlocks));
+    nBlocks = (nWords + nChunk - 1) / nChunk;
+    vSims   = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    pBlocks = ABC_CALLOC( Gia_SimParBlock_t, nBlocks );
+    vData   = Vec_PtrAlloc( nBlocks );
+    for ( i = 0; i < nBlocks; i++ )
+    {
+        pBlocks[i].pGia    = pGia;
+        pBlocks[i].vSimsPi = vSimsPi;
+        pBlocks[i].vSims   = vSims;
+        pBlocks[i].nWords  = nWords;
+        pBlocks[i].iStart  = i * nChunk;
+        pBlocks[i].iStop   = Abc_MinInt( (i + 1) * nChunk, nWords );
+        Vec_PtrPush( vData, pBlocks + i );
+    }
+    Util_ProcessThreads( Gia_ManSimPatSimBlock, vData, nProcs, 0, 0 );
+    Vec_PtrFree( vData );
+    ABC_FREE( pBlocks );
+    if ( !fOuts )
+        return vSims;
+    vSimsCo = Vec_WrdStart( Gia_ManCoNum(pGia) * nWords );
+    Gia_ManForEachCo( pGia, pObj, i )
+        memcpy( Vec_WrdEntryP(vSimsCo, i*nWords), Vec_WrdEntryP(vSims, Gia_ObjId(pGia, pObj)*nWords), sizeof(word)*nWords );
+    Vec_WrdFree( vSims );
+    return vSimsCo;
+}
+
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
     word pComps[2] = { ~(word)0, 0 };
@@ -537,26 +621,17 @@ static inline void Gia_ManSimPatSimAnd2( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninLit0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninLit1(pObj, i);
     word * pSims2 = pSims + nWords*(2*i+0); 
-    word * pSims3 = pSims + nWords*(2*i+1); int w;
+    word * pSims3 = pSims + nWords*(2*i+1);
     assert( !Gia_ObjIsXor(pObj) );
-//    if ( Gia_ObjIsXor(pObj) )
-//        for ( w = 0; w < nWords; w++ )
-//            pSims2[w] = pSims0[w] ^ pSims1[w];
-//    else
-    for ( w = 0; w < nWords; w++ )
-    {
-        pSims2[w] = pSims0[w] & pSims1[w];
-        pSims3[w] = ~pSims2[w];
-    }
-    //_mm256_storeu_ps( (float *)pSims2, _mm256_and_ps(_mm256_loadu_ps((float *)pSims0), _mm256_loadu_ps((float *)pSims1)) );
+    Abc_SimdAnd( pSims2, pSims0, 0, pSims1, 0, nWords );
+    Abc_SimdCopy( pSims3, pSims2, 1, nWords );
 }
 static inline void Gia_ManSimPatSimPo2( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
     word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninLit0(pObj, i);
-    word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w] = pSims0[w];
+    word * pSims2  = pSims + nWords*i;
+    Abc_SimdCopy( pSims2, pSims0, 0, nWords );
 }
 Vec_Wrd_t * Gia_ManSimPatSim2( Gia_Man_t * pGia )
 {
@@ -770,6 +845,70 @@ void Gia_ManSimProfile( Gia_Man_t * pGia )
         64*nWords, nUnique, 100.0*nUnique/Gia_ManCandNum(pGia), Gia_ManCandNum(pGia), nC0s, nC1s );
     Vec_WrdFree( vSims );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Measures simulation speed for each instruction set.]
+
+  Description [Simulates random patterns using the kernels of each
+  instruction set supported by the CPU, checks that the results match
+  those of the portable kernels, and prints patterns per second.
+  If nProcs is more than two, also measures multi-threaded simulation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimPatBench( Gia_Man_t * pGia, int nWords, int nRounds, int nProcs, int fVerbose )
+{
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(pGia) * nWords );
+    Vec_Wrd_t * vSims, * vSimsRef = NULL;
+    int Level, LevelOld = Abc_SimdLevel(), r;
+    for ( Level = ABC_SIMD_NONE; Level <= Abc_SimdLevelMax(); Level++ )
+    {
+        abctime clk = Abc_Clock(); double Time;
+        Abc_SimdSetLevel( Level );
+        vSims = Gia_ManSimPatSimOut( pGia, vSimsPi, 0 );
+        for ( r = 1; r < nRounds; r++ )
+        {
+            Vec_WrdFree( vSims );
+            vSims = Gia_ManSimPatSimOut( pGia, vSimsPi, 0 );
+        }
+        Time = 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC;
+        printf( "%-8s : Simulated %d rounds of %d patterns. ", Abc_SimdLevelName(Level), nRounds, 64*nWords );
+        printf( "Patterns/sec = %12.0f. ", Time > 0 ? 64.0*nWords*nRounds/Time : 0 );
+        printf( "Nodes*patterns/sec = %10.3e. ", Time > 0 ? 64.0*nWords*nRounds*Gia_ManAndNum(pGia)/Time : 0 );
+        if ( vSimsRef && !Vec_WrdEqual(vSims, vSimsRef) )
+            printf( "MISMATCH! " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        if ( vSimsRef == NULL )
+            vSimsRef = vSims;
+        else
+            Vec_WrdFree( vSims );
+    }
+    Abc_SimdSetLevel( LevelOld );
+    if ( nProcs > 2 )
+    {
+        abctime clk = Abc_Clock(); double Time;
+        vSims = Gia_ManSimPatSimOutPar( pGia, vSimsPi, 0, nProcs );
+        for ( r = 1; r < nRounds; r++ )
+        {
+            Vec_WrdFree( vSims );
+            vSims = Gia_ManSimPatSimOutPar( pGia, vSimsPi, 0, nProcs );
+        }
+        Time = 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC;
+        printf( "%-8s : Simulated %d rounds of %d patterns. ", "threads", nRounds, 64*nWords );
+        printf( "Patterns/sec = %12.0f. ", Time > 0 ? 64.0*nWords*nRounds/Time : 0 );
+        printf( "Nodes*patterns/sec = %10.3e. ", Time > 0 ? 64.0*nWords*nRounds*Gia_ManAndNum(pGia)/Time : 0 );
+        if ( !Vec_WrdEqual(vSims, vSimsRef) )
+            printf( "MISMATCH! " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        Vec_WrdFree( vSims );
+    }
+    Vec_WrdFree( vSimsRef );
+    Vec_WrdFree( vSimsPi );
+}
 void Gia_ManPatSatImprove( Gia_Man_t * p, int nWords0, int fVerbose )
 {
     extern Vec_Int_t * Cbs2_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
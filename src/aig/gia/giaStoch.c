@@ -21,6 +21,7 @@
 #include "gia.h"
 #include "aig/gia/giaAig.h"
 #include "proof/dch/dch.h"
+#include "opt/dar/dar.h"
 #include "base/main/main.h"
 #include "base/cmd/cmd.h"
 
@@ -1180,6 +1181,114 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the AIG by windows using several threads.]
+
+  Description [Divides the AIG into windows of about nWinSize nodes,
+  whose inputs and outputs are kept fixed. The windows are rewritten 
+  concurrently by Gia_ManCompress2(), each thread using its own rewriting
+  library, which is kept for all windows rewritten by the thread and 
+  freed at the end. The windows are stitched back in a fixed order and 
+  strashed, so the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_Dc2Win_t_ Gia_Dc2Win_t;
+struct Gia_Dc2Win_t_
+{
+    Gia_Man_t *  pIn;           // the window
+    Gia_Man_t *  pOut;          // the rewritten window
+    int          fUpdateLevel;  // the level update flag
+    void **      ppLibs;        // the rewriting libraries by thread (the first one is for the caller)
+};
+static int Gia_ManCompress2Win( void * pArg )
+{
+    Gia_Dc2Win_t * pWin = (Gia_Dc2Win_t *)pArg;
+    void ** ppLib = pWin->ppLibs + 1 + Util_PoolThreadId();
+    void * pLibOld = Dar_LibSwap( *ppLib );
+    pWin->pOut = Gia_ManCompress2( pWin->pIn, pWin->fUpdateLevel, 0 );
+    *ppLib = Dar_LibSwap( pLibOld );
+    if ( Gia_ManAndNum(pWin->pOut) > Gia_ManAndNum(pWin->pIn) )
+    {
+        Gia_ManStop( pWin->pOut );
+        pWin->pOut = Gia_ManDup( pWin->pIn );
+    }
+    return 0;
+}
+Gia_Man_t * Gia_ManCompress2Par( Gia_Man_t * p, int fUpdateLevel, int nWinSize, int nProcs, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Vec_Int_t * vLevels[2] = { NULL, NULL };
+    Vec_Wec_t * vAnds, * vIns, * vOuts;
+    Vec_Ptr_t * vAigs;
+    Util_Task_t ** pTasks;
+    Gia_Dc2Win_t * pWins;
+    Gia_Man_t * pNew;
+    void * pLibs[UTIL_POOL_THR_MAX+1] = { NULL };
+    int i, nWins, * pRefs;
+    if ( nProcs <= 1 || p->pManTime || Gia_ManAndNum(p) <= nWinSize )
+        return Gia_ManCompress2( p, fUpdateLevel, fVerbose );
+    // divide the AIG into windows
+    pRefs = p->pRefs; p->pRefs = NULL;
+    vAnds = Gia_ManStochNodes( p, nWinSize, 0 );
+    vIns  = Gia_ManStochInputs( p, vAnds );
+    vOuts = Gia_ManStochOutputs( p, vAnds );
+    ABC_FREE( p->pRefs ); p->pRefs = pRefs;
+    nWins = Vec_WecSize( vAnds );
+    pWins = ABC_CALLOC( Gia_Dc2Win_t, nWins );
+    pTasks = ABC_ALLOC( Util_Task_t *, nWins );
+    for ( i = 0; i < nWins; i++ )
+    {
+        pWins[i].pIn = Gia_ManDupDivideOne( p, Vec_WecEntry(vIns, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vOuts, i), vLevels, 0 );
+        pWins[i].fUpdateLevel = fUpdateLevel;
+        pWins[i].ppLibs = pLibs;
+    }
+    if ( fVerbose )
+    {
+        printf( "Rewriting %d windows with %d nodes on average using %d threads.  ", nWins, Gia_ManAndNum(p) / nWins, nProcs );
+        Abc_PrintTime( 1, "Dividing time", Abc_Clock() - clk );
+    }
+    // rewrite the windows
+    Util_PoolStart( nProcs );
+    for ( i = 0; i < nWins; i++ )
+        pTasks[i] = Util_PoolSubmit( Gia_ManCompress2Win, pWins + i );
+    vAigs = Vec_PtrAlloc( nWins );
+    for ( i = 0; i < nWins; i++ )
+    {
+        Util_TaskWait( pTasks[i], 0 );
+        Util_TaskFree( pTasks[i] );
+        Gia_ManStop( pWins[i].pIn );
+        Vec_PtrPush( vAigs, pWins[i].pOut );
+    }
+    for ( i = 0; i <= UTIL_POOL_THR_MAX; i++ )
+        if ( pLibs[i] )
+        {
+            void * pLibOld = Dar_LibSwap( pLibs[i] );
+            Dar_LibStop();
+            Dar_LibSwap( pLibOld );
+        }
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Rewriting time", Abc_Clock() - clk );
+    // stitch the windows
+    pNew = Gia_ManDupStitch( p, vIns, vAnds, vOuts, vAigs, 1 );
+    if ( fVerbose )
+    {
+        printf( "Reduced %d nodes to %d nodes.  ", Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clk );
+    }
+    Vec_PtrFreeFunc( vAigs, (void (*)(void *)) Gia_ManStop );
+    Vec_WecFree( vAnds );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    ABC_FREE( pTasks );
+    ABC_FREE( pWins );
+    return pNew;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
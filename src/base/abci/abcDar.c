@@ -1883,7 +1883,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int nProcs, int fChangePol, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1907,9 +1907,23 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // stream the fast CNF into the file without storing it
+    if ( fFastAlgo && strcmp(Extra_FileNameExtension(pFileName), "gz") )
+    {
+        int nVars, nClauses, nLiterals;
+        nVars = Cnf_DeriveFastWriteDimacs( pMan, 0, nProcs, fChangePol, pFileName, &nClauses, &nLiterals );
+        if ( nVars >= 0 )
+        {
+            Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        Aig_ManStop( pMan );
+        return NULL;
+    }
+
     // derive CNF
     if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
+        pCnf = Cnf_DeriveFastPar( pMan, 0, nProcs );
     else
         pCnf = Cnf_Derive( pMan, 0 );
 
@@ -20,6 +20,7 @@
 
 #include "misc/extra/extra.h"
 #include "misc/vec/vec.h"
+#include "misc/util/utilTruth.h"
 
 #include "bool/kit/kit.h"
 #include "bool/lucky/lucky.h"
@@ -51,6 +52,7 @@ struct Abc_TtStore_t_
 extern Abc_TtStore_t * Abc_TtStoreLoad( char * pFileName, int nVarNum );
 extern void            Abc_TtStoreFree( Abc_TtStore_t * p, int nVarNum );
 extern void            Abc_TtStoreWrite( char * pFileName, Abc_TtStore_t * p, int fBinary );
+extern Abc_TtStore_t * Abc_TruthStoreAlloc( int nVars, int nFuncs );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -174,7 +176,7 @@ void Abc_TruthNpnPrint( char * pCanonPermInit, unsigned uCanonPhase, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
+void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int nProcs, int fVerbose )
 {
     unsigned pAux[2048];
     word pAuxWord[1024], pAuxWord1[1024];
@@ -210,6 +212,8 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
         pAlgoName = "new cost-aware exact algorithm   ";
     else if ( NpnType == 12 )
         pAlgoName = "new hybrid fast (P) ";
+    else if ( NpnType == 13 )
+        pAlgoName = "new hybrid fast (B) ";
 
     assert( p->nVars <= 16 );
     if ( pAlgoName )
@@ -369,12 +373,64 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
     }
+    else if ( NpnType == 13 )
+    {
+        // the functions are stored in one chunk of memory, so they are canonicized together
+        Abc_TtNpnCache_t * pCache = Abc_TtNpnCacheStart( p->nVars );
+        unsigned * pPhases = ABC_ALLOC( unsigned, p->nFuncs );
+        char * pPerms = ABC_ALLOC( char, p->nFuncs * p->nVars );
+        Abc_TtCanonicizeBatch( pCache, p->pFuncs[0], p->nFuncs, p->nVars, pPhases, pPerms, nProcs );
+        for ( i = 0; fVerbose && i < p->nFuncs; i++ )
+        {
+            printf( "%7d : ", i );
+            Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pPerms + i * p->nVars, pPhases[i], p->nVars), printf( "\n" );
+        }
+        if ( fVerbose )
+            Abc_TtNpnCachePrint( pCache );
+        Abc_TtNpnCacheStop( pCache );
+        ABC_FREE( pPhases );
+        ABC_FREE( pPerms );
+    }
     else assert( 0 );
     clk = Abc_Clock() - clk;
     printf( "Classes =%9d  ", Abc_TruthNpnCountUnique(p) );
     Abc_PrintTime( 1, "Time", clk );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Generates a standard set of functions.]
+
+  Description [Returns all functions of nVars <= 4 variables or nFuncs
+  random functions of more variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_TtStore_t * Abc_TruthNpnGenerate( int nVars, int nFuncs )
+{
+    Abc_TtStore_t * p;
+    int i, w;
+    assert( nVars <= 16 );
+    if ( nVars <= 4 )
+        nFuncs = 1 << (1 << nVars);
+    p = Abc_TruthStoreAlloc( nVars, nFuncs );
+    Abc_RandomW( 1 );
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        if ( nVars <= 4 )
+            p->pFuncs[i][0] = (word)i;
+        else
+            for ( w = 0; w < p->nWords; w++ )
+                p->pFuncs[i][w] = Abc_RandomW( 0 );
+        if ( nVars < 6 )
+            p->pFuncs[i][0] = Abc_Tt6Stretch( p->pFuncs[i][0] & Abc_Tt6Mask(1 << nVars), nVars );
+    }
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Apply decomposition to truth tables.]
@@ -386,21 +442,24 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int nRandFuncs, int nProcs, int fDumpRes, int fBinary, int fVerbose )
 {
     Abc_TtStore_t * p;
     char * pFileNameOut;
 
-    // read info from file
-    p = Abc_TtStoreLoad( pFileName, nVarNum );
+    // read info from file or generate the functions
+    if ( pFileName == NULL )
+        p = Abc_TruthNpnGenerate( nVarNum, nRandFuncs );
+    else
+        p = Abc_TtStoreLoad( pFileName, nVarNum );
     if ( p == NULL )
         return;
 
     // consider functions from the file
-    Abc_TruthNpnPerform( p, NpnType, fVerbose );
+    Abc_TruthNpnPerform( p, NpnType, nProcs, fVerbose );
 
     // write the result
-    if ( fDumpRes )
+    if ( fDumpRes && pFileName )
     {
         if ( fBinary )
             pFileNameOut = Extra_FileNameGenericAppend( pFileName, "_out.tt" );
@@ -412,7 +471,7 @@ void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes,
     }
 
     // delete data-structure
-    Abc_TtStoreFree( p, nVarNum );
+    Abc_TtStoreFree( p, pFileName ? nVarNum : -1 );
 //    printf( "Finished computing canonical forms for functions from file \"%s\".\n", pFileName );
 }
 
@@ -428,12 +487,14 @@ void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes,
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int nRandFuncs, int nProcs, int fDumpRes, int fBinary, int fVerbose )
 {
-    if ( fVerbose )
+    if ( fVerbose && pFileName )
         printf( "Using truth tables from file \"%s\"...\n", pFileName );
-    if ( NpnType >= 0 && NpnType <= 12 )
-        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
+    else if ( fVerbose )
+        printf( "Using %s functions of %d variables...\n", nVarNum <= 4 ? "all" : "random", nVarNum );
+    if ( NpnType >= 0 && NpnType <= 13 )
+        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, nRandFuncs, nProcs, fDumpRes, fBinary, fVerbose );
     else
         printf( "Unknown canonical form value (%d).\n", NpnType );
     fflush( stdout );
@@ -29,6 +29,7 @@
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +39,7 @@ ABC_NAMESPACE_IMPL_START
 
 static int CmdCommandTime          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandSleep         ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandProfile       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEcho          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandQuit          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAbcrc         ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -93,6 +95,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "sleep",         CmdCommandSleep,           0 );
+    Cmd_CommandAdd( pAbc, "Basic", "profile",       CmdCommandProfile,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "echo",          CmdCommandEcho,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "quit",          CmdCommandQuit,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "abcrc",         CmdCommandAbcrc,           0 );
@@ -125,6 +128,10 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Various", "&solver",     CmdCommandSolver,          0 );
 
     Cmd_CommandAdd( pAbc, "Various", "load_plugin", Cmd_CommandAbcLoadPlugIn,  0 );
+
+    // start the profiler if requested by the environment
+    if ( getenv("ABC_PROFILE") && getenv("ABC_PROFILE")[0] )
+        Abc_ProfStart( getenv("ABC_PROFILE") );
 }
 
 /**Function********************************************************************
@@ -143,6 +150,8 @@ void Cmd_End( Abc_Frame_t * pAbc )
     st__generator * gen;
     char * pKey, * pValue;
     Cmd_HistoryWrite( pAbc, ABC_INFINITY );
+    // write the trace if the profiler is still recording
+    Abc_ProfStop();
 
 //    st__free_table( pAbc->tCommands, (void (*)()) 0, CmdCommandFree );
 //    st__free_table( pAbc->tAliases,  (void (*)()) 0, CmdCommandAliasFree );
@@ -232,6 +241,85 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
     return 1;
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Controls the built-in profiler.]
+
+  Description [When the profiler is on, each command is recorded with
+  its wall time, CPU time, the change of the peak memory, the number of
+  SAT calls and the size of the current networks before and after it.
+  The phases marked by the algorithms are recorded inside the commands.
+  The trace is written in the Chrome trace event format when the profiler
+  is stopped or ABC exits. Setting environment variable ABC_PROFILE to a
+  file name starts the profiler when ABC starts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandProfile( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileName;
+    int c, fStop = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "sh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 's':
+            fStop ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( fStop )
+    {
+        if ( argc != globalUtilOptind )
+            goto usage;
+        pFileName = Abc_UtilStrsav( (char *)Abc_ProfFileName() );
+        if ( pFileName == NULL )
+        {
+            fprintf( pAbc->Err, "The profiler is not running.\n" );
+            return 1;
+        }
+        if ( Abc_ProfStop() )
+            fprintf( pAbc->Out, "The trace is written into file \"%s\".\n", pFileName );
+        ABC_FREE( pFileName );
+        return 0;
+    }
+    if ( argc == globalUtilOptind )
+    {
+        if ( Abc_ProfFileName() )
+            fprintf( pAbc->Out, "The profiler is recording into file \"%s\" (%d events).\n", Abc_ProfFileName(), Abc_ProfEventNum() );
+        else
+            fprintf( pAbc->Out, "The profiler is not running.\n" );
+        return 0;
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !Abc_ProfStart( argv[globalUtilOptind] ) )
+    {
+        fprintf( pAbc->Err, "The profiler is already recording into file \"%s\".\n", Abc_ProfFileName() );
+        return 1;
+    }
+    return 0;
+
+  usage:
+    fprintf( pAbc->Err, "usage: profile [-sh] <file_name>\n" );
+    fprintf( pAbc->Err, "\t              records the commands and their phases as a Chrome trace\n" );
+    fprintf( pAbc->Err, "\t              (wall/CPU time, peak memory, SAT calls, network size)\n" );
+    fprintf( pAbc->Err, "\t              without arguments, prints the status of the profiler\n" );
+    fprintf( pAbc->Err, "\t-s          : stops recording and writes the trace [default = %s]\n", fStop? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h          : toggle printing the command usage\n" );
+    fprintf( pAbc->Err, "\t<file_name> : starts recording; the trace is written into this file\n" );
+    fprintf( pAbc->Err, "\t              when recording stops or ABC exits (see also ABC_PROFILE)\n" );
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    []
@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "base/main/mainInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilProf.h"
 #include "cmdInt.h"
 #include <ctype.h>
 
@@ -83,6 +84,45 @@ int cmdCheckShellEscape( Abc_Frame_t * pAbc, int argc, char ** argv)
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Records one command in the trace.]
+
+  Description [Adds the command line, the return value and the size of
+  the current networks before and after the command to the event.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void CmdProfileRecordSizes( Abc_Frame_t * pAbc, int * pSizes )
+{
+    pSizes[0] = pAbc->pNtkCur ? Abc_NtkNodeNum(pAbc->pNtkCur) : -1;
+    pSizes[1] = pAbc->pGia    ? Gia_ManAndNum(pAbc->pGia)     : -1;
+}
+static void CmdProfileRecordCommand( Abc_Frame_t * pAbc, int argc, char ** argv, int fError, Abc_ProfStamp_t * pBeg, int * pSizesBeg )
+{
+    Abc_ProfStamp_t End;
+    Vec_Str_t * vLine = Vec_StrAlloc( 100 );
+    Vec_Str_t * vArgs = Vec_StrAlloc( 200 );
+    int i, pSizesEnd[2];
+    Abc_ProfStamp( &End );
+    CmdProfileRecordSizes( pAbc, pSizesEnd );
+    for ( i = 0; i < argc; i++ )
+    {
+        if ( i ) Vec_StrPush( vLine, ' ' );
+        Vec_StrPrintStr( vLine, argv[i] );
+    }
+    Vec_StrPush( vLine, '\0' );
+    Vec_StrPrintF( vArgs, "\"status\":%d,\"ntk_nodes_before\":%d,\"ntk_nodes_after\":%d,\"gia_ands_before\":%d,\"gia_ands_after\":%d",
+        fError, pSizesBeg[0], pSizesEnd[0], pSizesBeg[1], pSizesEnd[1] );
+    Vec_StrPush( vArgs, '\0' );
+    Abc_ProfAddEvent( argv[0], "command", pBeg, &End, Vec_StrArray(vLine), Vec_StrArray(vArgs) );
+    Vec_StrFree( vLine );
+    Vec_StrFree( vArgs );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Executes one command.]
@@ -106,6 +146,8 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     char * value;
     int fError;
     double clk;
+    Abc_ProfStamp_t ProfBeg;
+    int pProfSizes[2];
 
     if ( argc == 0 )
         return 0;
@@ -152,10 +194,18 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     }
 
     // execute the command
+    ProfBeg.WallUs = ~(word)0;
+    if ( Abc_ProfEnabled )
+    {
+        Abc_ProfStamp( &ProfBeg );
+        CmdProfileRecordSizes( pAbc, pProfSizes );
+    }
     clk = Extra_CpuTimeDouble();
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
+    if ( Abc_ProfEnabled && ProfBeg.WallUs != ~(word)0 )
+        CmdProfileRecordCommand( pAbc, argc, argv, fError, &ProfBeg, pProfSizes );
 
     // automatic execution of arbitrary command after each command 
     // usually this is a passive command ... 
@@ -213,6 +213,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
 //    Abc_HManStop();
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
+    Util_PoolStop();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
@@ -20,6 +20,7 @@
 
 #include "base/abc/abc.h"
 #include "mainInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
  
@@ -107,6 +108,7 @@ void Abc_FrameAddInitializer( Abc_FrameInitializer_t* p )
 void Abc_FrameInit( Abc_Frame_t * pAbc )
 {
     Abc_FrameInitializer_t* p;
+    Abc_SimdInit();
     Cmd_Init( pAbc );
     Cmd_CommandExecute( pAbc, "set checkread" ); 
     Io_Init( pAbc );
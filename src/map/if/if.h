@@ -153,6 +153,7 @@ struct If_Par_t_
     int                fDumpFile;     // dumping truth tables into a file
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
+    int                nProcs;        // the number of worker threads
     char *             pLutStruct;    // LUT structure
     int                fEnableStructN;// LUT structure using a new method
     float              WireDelay;     // wire delay
@@ -218,6 +219,8 @@ struct If_Man_t_
     Vec_Ptr_t *        vCos;          // the primary outputs
     Vec_Ptr_t *        vObjs;         // all objects
     Vec_Ptr_t *        vObjsRev;      // reverse topological order of objects
+    Vec_Vec_t *        vLevels;       // AND nodes by level (for multi-threaded mapping)
+    int                fCutSetsExt;   // cutsets are allocated and released by the caller
     Vec_Ptr_t *        vTemp;         // temporary array
     int                nObjs[IF_VOID];// the number of objects by type
     // various data
@@ -605,6 +608,8 @@ extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nC
 extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
+extern If_DsdMan_t *   If_DsdManCacheStart( char * pDirName, int nVars, int LutSize );
+extern void            If_DsdManCacheUpdate( If_DsdMan_t * p );
 extern void            If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew );
 extern void            If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
@@ -718,6 +723,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern Vec_Vec_t *     If_ManLevelizeNodes( If_Man_t * p );
+extern int             If_ManCrossCutLevel( If_Man_t * p, Vec_Vec_t * vLevels );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
@@ -85,7 +85,13 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( p->pPars->nProcs > 1 && p->nChoices == 0 && p->pManTim == NULL )
+    {
+        p->vLevels = If_ManLevelizeNodes( p );
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevel(p, p->vLevels)) );
+    }
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -41,6 +41,15 @@
 
 #endif
 
+#ifdef WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -48,7 +57,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define DSD_VERSION "dsd1"
+#define DSD_VERSION     "dsd2"
+#define DSD_VERSION_OLD "dsd1"
+#define DSD_ENDIAN      0x01020304
 
 // network types
 typedef enum { 
@@ -73,6 +84,19 @@ struct If_DsdObj_t_
     unsigned       pFans[0];       // fanins
 };
 
+typedef struct If_DsdHead_t_ If_DsdHead_t;
+struct If_DsdHead_t_
+{
+    char           pVersion[4];    // format version
+    unsigned       uEndian;        // byte order tag
+    int            nVars;          // max var number
+    int            LutSize;        // LUT size
+    int            nObjs;          // object number
+    int            nObjWords;      // words in the object section
+    word           nBytes;         // the size of data after the header
+    word           Checksum;       // checksum of data after the header
+};
+
 struct If_DsdMan_t_
 {
     char *         pStore;         // input/output file
@@ -101,6 +125,8 @@ struct If_DsdMan_t_
     char *         pCellStr;       // symbolic cell description
     int            nObjsPrev;      // previous number of objects
     int            fNewAsUseless;  // set new as useless
+    int            fCache;         // update the input/output file when freeing
+    int            nObjsStore;     // the number of objects in the input/output file
     int            nUniqueHits;    // statistics
     int            nUniqueMisses;  // statistics
     abctime        timeDsd;        // statistics
@@ -334,6 +360,8 @@ void If_DsdManFree( If_DsdMan_t * p, int fVerbose )
 {
     int v;
 //    If_DsdManDumpDsd( p );
+    if ( p->fCache )
+        If_DsdManCacheUpdate( p );
     if ( fVerbose )
         If_DsdManPrint( p, NULL, 0, 0, 0, 0, 0 );
     if ( fVerbose )
@@ -1039,91 +1067,303 @@ int If_DsdObjFindOrAdd( If_DsdMan_t * p, int Type, int * pLits, int nLits, word
 
   Synopsis    [Saving/loading DSD manager.]
 
-  Description []
+  Description [The file is an image that can be mapped into memory: a 
+  fixed-size header followed by sections padded to 8 bytes, which are 
+  copied into the manager as whole arrays. The header records the byte 
+  order, the size of the data, and its checksum, so that an incomplete 
+  or incompatible file is rejected instead of being misread.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+static inline void If_DsdImagePush( Vec_Str_t * vImage, void * pData, word nBytes )
 {
-    If_DsdObj_t * pObj; 
-    Vec_Int_t * vSets;
-    word * pTruth; 
-    int i, v, Num;
-    FILE * pFile = fopen( pFileName ? pFileName : p->pStore, "wb" );
+    Vec_StrPushBuffer( vImage, (char *)pData, (int)nBytes );
+    while ( Vec_StrSize(vImage) % 8 )
+        Vec_StrPush( vImage, 0 );
+}
+static inline void * If_DsdImageNext( char ** ppCur, char * pEnd, word nBytes )
+{
+    char * pData = *ppCur;
+    nBytes = (nBytes + 7) & ~(word)7;
+    if ( (word)(pEnd - pData) < nBytes )
+        return NULL;
+    *ppCur += nBytes;
+    return pData;
+}
+static word If_DsdImageChecksum( char * pData, word nBytes )
+{
+    word * pWords = (word *)pData, Sum = ABC_CONST(0xCBF29CE484222325);
+    word i, nWords = nBytes / 8;
+    for ( i = 0; i < nWords; i++ )
+        Sum = (Sum ^ pWords[i]) * ABC_CONST(0x100000001B3);
+    return Sum;
+}
+static char * If_DsdImageRead( char * pFileName, word * pnBytes, int * pfMapped )
+{
+    char * pImage;
+    FILE * pFile;
+    int RetValue;
+#ifndef WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        pImage = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( pImage != (char *)MAP_FAILED )
+        {
+            close( fd );
+            *pnBytes = (word)Stat.st_size;
+            *pfMapped = 1;
+            return pImage;
+        }
+    }
+    close( fd );
+#endif
+    pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
+        return NULL;
+    *pnBytes = (word)Extra_FileSize( pFileName );
+    pImage = ABC_ALLOC( char, *pnBytes + 8 );
+    RetValue = fread( pImage, *pnBytes, 1, pFile );
+    fclose( pFile );
+    if ( *pnBytes && RetValue != 1 )
     {
-        printf( "Writing DSD manager file \"%s\" has failed.\n", pFileName ? pFileName : p->pStore );
-        return;
+        ABC_FREE( pImage );
+        return NULL;
     }
-    fwrite( DSD_VERSION, 4, 1, pFile );
-    Num = p->nVars;
-    fwrite( &Num, 4, 1, pFile );
-    Num = p->LutSize;
-    fwrite( &Num, 4, 1, pFile );
-    Num = Vec_PtrSize(&p->vObjs);
-    fwrite( &Num, 4, 1, pFile );
-    Vec_PtrForEachEntryStart( If_DsdObj_t *, &p->vObjs, pObj, i, 2 )
+    *pfMapped = 0;
+    return pImage;
+}
+static void If_DsdImageRelease( char * pImage, word nBytes, int fMapped )
+{
+#ifndef WIN32
+    if ( fMapped )
     {
-        Num = If_DsdObjWordNum( pObj->nFans );
-        fwrite( &Num, 4, 1, pFile );
-        fwrite( pObj, sizeof(word)*Num, 1, pFile );
-        if ( pObj->Type == IF_DSD_PRIME )
-            fwrite( Vec_IntEntryP(&p->vTruths, i), 4, 1, pFile );
+        munmap( pImage, (size_t)nBytes );
+        return;
     }
+#endif
+    ABC_FREE( pImage );
+}
+static int If_DsdManProcessId()
+{
+#ifdef WIN32
+    return (int)_getpid();
+#else
+    return (int)getpid();
+#endif
+}
+void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+{
+    If_DsdHead_t * pHead;
+    If_DsdObj_t * pObj; 
+    Vec_Str_t * vImage;
+    Vec_Int_t * vSets, * vOffs;
+    char * pName = pFileName ? pFileName : p->pStore;
+    char * pTemp = ABC_ALLOC( char, strlen(pName) + 20 );
+    int i, v, Num[4], nObjWords = 0;
+    FILE * pFile;
+    // build the image
+    vImage = Vec_StrAlloc( 1 << 16 );
+    Vec_StrFill( vImage, sizeof(If_DsdHead_t), 0 );
+    If_DsdVecForEachNode( &p->vObjs, pObj, i )
+        nObjWords += If_DsdObjWordNum( pObj->nFans );
+    If_DsdImagePush( vImage, Vec_IntArray(&p->vTruths), sizeof(int) * Vec_IntSize(&p->vTruths) );
+    If_DsdVecForEachNode( &p->vObjs, pObj, i )
+        Vec_StrPushBuffer( vImage, (char *)pObj, sizeof(word) * If_DsdObjWordNum(pObj->nFans) );
+    vOffs = Vec_IntAlloc( 1000 );
     for ( v = 3; v <= p->nVars; v++ )
     {
-        int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtMem[v]);
-        Num = Vec_MemEntryNum(p->vTtMem[v]);
-        fwrite( &Num, 4, 1, pFile );
-        Vec_MemForEachEntry( p->vTtMem[v], pTruth, i )
-            fwrite( pTruth, nBytes, 1, pFile );
-        Num = Vec_PtrSize(p->vTtDecs[v]);
-        fwrite( &Num, 4, 1, pFile );
+        Num[0] = Vec_MemEntryNum(p->vTtMem[v]);
+        Num[1] = Vec_PtrSize(p->vTtDecs[v]);
+        If_DsdImagePush( vImage, Num, 8 );
+        for ( i = 0; i < Num[0]; i++ )
+            Vec_StrPushBuffer( vImage, (char *)Vec_MemReadEntry(p->vTtMem[v], i), sizeof(word) * Vec_MemEntrySize(p->vTtMem[v]) );
+        Vec_IntClear( vOffs );
+        Vec_IntPush( vOffs, 0 );
+        Vec_PtrForEachEntry( Vec_Int_t *, p->vTtDecs[v], vSets, i )
+            Vec_IntPush( vOffs, Vec_IntEntryLast(vOffs) + Vec_IntSize(vSets) );
+        If_DsdImagePush( vImage, Vec_IntArray(vOffs), sizeof(int) * Vec_IntSize(vOffs) );
         Vec_PtrForEachEntry( Vec_Int_t *, p->vTtDecs[v], vSets, i )
+            Vec_StrPushBuffer( vImage, (char *)Vec_IntArray(vSets), sizeof(int) * Vec_IntSize(vSets) );
+        If_DsdImagePush( vImage, NULL, 0 );
+    }
+    Vec_IntFree( vOffs );
+    Num[0] = p->nConfigWords;
+    Num[1] = p->nTtBits;
+    Num[2] = p->vConfigs ? Vec_WrdSize(p->vConfigs) : 0;
+    Num[3] = p->pCellStr ? strlen(p->pCellStr) : 0;
+    If_DsdImagePush( vImage, Num, 16 );
+    if ( Num[2] )
+        If_DsdImagePush( vImage, Vec_WrdArray(p->vConfigs), sizeof(word) * Num[2] );
+    if ( Num[3] )
+        If_DsdImagePush( vImage, p->pCellStr, Num[3] );
+    // fill in the header
+    pHead = (If_DsdHead_t *)Vec_StrArray( vImage );
+    memcpy( pHead->pVersion, DSD_VERSION, 4 );
+    pHead->uEndian   = DSD_ENDIAN;
+    pHead->nVars     = p->nVars;
+    pHead->LutSize   = p->LutSize;
+    pHead->nObjs     = Vec_PtrSize(&p->vObjs);
+    pHead->nObjWords = nObjWords;
+    pHead->nBytes    = Vec_StrSize(vImage) - sizeof(If_DsdHead_t);
+    pHead->Checksum  = If_DsdImageChecksum( Vec_StrArray(vImage) + sizeof(If_DsdHead_t), pHead->nBytes );
+    // write into a temporary file and rename it, so that other processes never see a partial file
+    sprintf( pTemp, "%s.%d.tmp", pName, If_DsdManProcessId() );
+    pFile = fopen( pTemp, "wb" );
+    if ( pFile == NULL || fwrite( Vec_StrArray(vImage), Vec_StrSize(vImage), 1, pFile ) != 1 )
+    {
+        printf( "Writing DSD manager file \"%s\" has failed.\n", pName );
+        if ( pFile )
+            fclose( pFile ), remove( pTemp );
+    }
+    else
+    {
+        fclose( pFile );
+#ifdef WIN32
+        remove( pName );
+#endif
+        if ( rename( pTemp, pName ) )
         {
-            Num = Vec_IntSize(vSets);
-            fwrite( &Num, 4, 1, pFile );
-            fwrite( Vec_IntArray(vSets), sizeof(int)*Num, 1, pFile );
+            printf( "Writing DSD manager file \"%s\" has failed.\n", pName );
+            remove( pTemp );
         }
+        else
+            p->nObjsStore = Vec_PtrSize(&p->vObjs);
     }
-    Num = p->nConfigWords;
-    fwrite( &Num, 4, 1, pFile );
-    Num = p->nTtBits;
-    fwrite( &Num, 4, 1, pFile );
-    Num = p->vConfigs ? Vec_WrdSize(p->vConfigs) : 0;
-    fwrite( &Num, 4, 1, pFile );
-    if ( Num )
-        fwrite( Vec_WrdArray(p->vConfigs), sizeof(word)*Num, 1, pFile );
-    Num = p->pCellStr ? strlen(p->pCellStr) : 0;
-    fwrite( &Num, 4, 1, pFile );
-    if ( Num )
-        fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
-    fclose( pFile );
+    Vec_StrFree( vImage );
+    ABC_FREE( pTemp );
 }
-If_DsdMan_t * If_DsdManLoad( char * pFileName )
+static If_DsdMan_t * If_DsdManLoadImage( char * pFileName, char * pImage, word nImage )
 {
+    If_DsdHead_t * pHead = (If_DsdHead_t *)pImage;
+    char * pCur = pImage + sizeof(If_DsdHead_t), * pEnd = pImage + nImage;
     If_DsdMan_t * p;
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
-    char pBuffer[10];
+    word * pObjWords, * pTruths, * pConfigs;
+    int * pTruthIds, * pNum, * pOffs, * pData;
     unsigned * pSpot;
-    word * pTruth;
-    int i, v, Num, Num2, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
+    char * pCellStr;
+    int i, k, v, Num, nEntry, iWord = 0;
+    if ( nImage < sizeof(If_DsdHead_t) || strncmp(pHead->pVersion, DSD_VERSION, 4) )
     {
-        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
+        printf( "Unrecognized format of file \"%s\".\n", pFileName );
         return NULL;
     }
-    RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    if ( pHead->uEndian != DSD_ENDIAN )
     {
-        printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        printf( "File \"%s\" was written on a computer with a different byte order.\n", pFileName );
         return NULL;
     }
+    if ( pHead->nBytes != nImage - sizeof(If_DsdHead_t) || pHead->Checksum != If_DsdImageChecksum(pCur, pHead->nBytes) || 
+         pHead->nVars > DAU_MAX_VAR || pHead->nObjs < 2 )
+    {
+        printf( "File \"%s\" is incomplete or corrupted.\n", pFileName );
+        return NULL;
+    }
+    p = If_DsdManAlloc( pHead->nVars, 0 );
+    ABC_FREE( p->pStore );
+    p->pStore = Abc_UtilStrsav( pFileName );
+    p->LutSize = pHead->LutSize;
+    if ( p->LutSize )
+        p->pSat = If_ManSatBuildXY( p->LutSize );
+    // objects
+    pTruthIds = (int *)If_DsdImageNext( &pCur, pEnd, sizeof(int) * pHead->nObjs );
+    pObjWords = (word *)If_DsdImageNext( &pCur, pEnd, sizeof(word) * pHead->nObjWords );
+    if ( pTruthIds == NULL || pObjWords == NULL )
+        goto corrupted;
+    Vec_PtrFillExtra( &p->vObjs, pHead->nObjs, NULL );
+    Vec_IntFill( &p->vNexts, pHead->nObjs, 0 );
+    Vec_IntFill( &p->vTruths, pHead->nObjs, -1 );
+    p->nBins = Abc_PrimeCudd( 2*pHead->nObjs );
+    p->pBins = ABC_REALLOC( unsigned, p->pBins, p->nBins );
+    memset( p->pBins, 0, sizeof(unsigned) * p->nBins );
+    for ( i = 2; i < pHead->nObjs; i++ )
+    {
+        pObj = (If_DsdObj_t *)(pObjWords + iWord);
+        if ( iWord + (int)(sizeof(If_DsdObj_t) / 8) > pHead->nObjWords || (int)pObj->Id != i )
+            goto corrupted;
+        Num = If_DsdObjWordNum( pObj->nFans );
+        if ( iWord + Num > pHead->nObjWords )
+            goto corrupted;
+        for ( k = 0; k < (int)pObj->nFans; k++ )
+            if ( Abc_Lit2Var(pObj->pFans[k]) >= i )
+                goto corrupted;
+        iWord += Num;
+        pObj = (If_DsdObj_t *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * Num );
+        memcpy( pObj, pObjWords + iWord - Num, sizeof(word) * Num );
+        Vec_PtrWriteEntry( &p->vObjs, i, pObj );
+        if ( pObj->Type == IF_DSD_PRIME )
+            Vec_IntWriteEntry( &p->vTruths, i, pTruthIds[i] );
+        pSpot = If_DsdObjHashLookup( p, pObj->Type, (int *)pObj->pFans, pObj->nFans, If_DsdObjTruthId(p, pObj) );
+        if ( *pSpot != 0 )
+            goto corrupted;
+        *pSpot = pObj->Id;
+    }
+    assert( p->nUniqueMisses == Vec_PtrSize(&p->vObjs) - 2 );
+    p->nUniqueMisses = 0;
+    // truth tables and their decompositions
+    for ( v = 3; v <= p->nVars; v++ )
+    {
+        nEntry = Vec_MemEntrySize( p->vTtMem[v] );
+        if ( (pNum = (int *)If_DsdImageNext( &pCur, pEnd, 8 )) == NULL ||
+             (pTruths = (word *)If_DsdImageNext( &pCur, pEnd, sizeof(word) * nEntry * (word)pNum[0] )) == NULL ||
+             (pOffs = (int *)If_DsdImageNext( &pCur, pEnd, sizeof(int) * ((word)pNum[1] + 1) )) == NULL || 
+             (pData = (int *)If_DsdImageNext( &pCur, pEnd, sizeof(int) * (word)pOffs[pNum[1]] )) == NULL )
+            goto corrupted;
+        for ( i = 0; i < pNum[0]; i++ )
+            Vec_MemHashInsert( p->vTtMem[v], pTruths + i * nEntry );
+        if ( pNum[0] != Vec_MemEntryNum(p->vTtMem[v]) )
+            goto corrupted;
+        for ( i = 0; i < pNum[1]; i++ )
+        {
+            Num = pOffs[i+1] - pOffs[i];
+            if ( Num < 0 || pOffs[i+1] > pOffs[pNum[1]] )
+                goto corrupted;
+            vSets = Vec_IntAlloc( Num );
+            memcpy( Vec_IntArray(vSets), pData + pOffs[i], sizeof(int) * Num );
+            vSets->nSize = Num;
+            Vec_PtrPush( p->vTtDecs[v], vSets );
+        }
+    }
+    // configurations and the cell
+    if ( (pNum = (int *)If_DsdImageNext( &pCur, pEnd, 16 )) == NULL ||
+         (pConfigs = (word *)If_DsdImageNext( &pCur, pEnd, sizeof(word) * (word)pNum[2] )) == NULL ||
+         (pCellStr = (char *)If_DsdImageNext( &pCur, pEnd, (word)pNum[3] )) == NULL )
+        goto corrupted;
+    p->nConfigWords = pNum[0];
+    p->nTtBits      = pNum[1];
+    if ( pNum[2] )
+    {
+        p->vConfigs = Vec_WrdStart( pNum[2] );
+        memcpy( Vec_WrdArray(p->vConfigs), pConfigs, sizeof(word) * pNum[2] );
+    }
+    if ( pNum[3] )
+    {
+        p->pCellStr = ABC_CALLOC( char, pNum[3] + 1 );
+        memcpy( p->pCellStr, pCellStr, pNum[3] );
+    }
+    p->nObjsStore = Vec_PtrSize(&p->vObjs);
+    return p;
+corrupted:
+    printf( "File \"%s\" is incomplete or corrupted.\n", pFileName );
+    If_DsdManFree( p, 0 );
+    return NULL;
+}
+static If_DsdMan_t * If_DsdManLoadOld( char * pFileName, FILE * pFile )
+{
+    If_DsdMan_t * p;
+    If_DsdObj_t * pObj; 
+    Vec_Int_t * vSets;
+    unsigned * pSpot;
+    word * pTruth;
+    int i, v, Num, Num2, RetValue;
     RetValue = fread( &Num, 4, 1, pFile );
     p = If_DsdManAlloc( Num, 0 );
     ABC_FREE( p->pStore );
@@ -1196,8 +1436,96 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
     }
     fclose( pFile );
+    p->nObjsStore = Vec_PtrSize(&p->vObjs);
     return p;
 }
+If_DsdMan_t * If_DsdManLoad( char * pFileName )
+{
+    If_DsdMan_t * p;
+    char pBuffer[10], * pImage;
+    word nImage;
+    int fMapped, RetValue;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
+        return NULL;
+    }
+    RetValue = fread( pBuffer, 4, 1, pFile );
+    if ( RetValue == 1 && !strncmp(pBuffer, DSD_VERSION_OLD, 4) )
+        return If_DsdManLoadOld( pFileName, pFile );
+    fclose( pFile );
+    pImage = If_DsdImageRead( pFileName, &nImage, &fMapped );
+    if ( pImage == NULL )
+    {
+        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
+        return NULL;
+    }
+    p = If_DsdManLoadImage( pFileName, pImage, nImage );
+    If_DsdImageRelease( pImage, nImage, fMapped );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the DSD manager kept in the cache directory.]
+
+  Description [The file name depends on the manager parameters, so that
+  runs with different parameters do not overwrite each other's files. 
+  The file is updated when the manager is freed, if new structures have 
+  been added. Before updating, the structures added to the file by other 
+  processes since it was read are merged into the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_DsdMan_t * If_DsdManCacheStart( char * pDirName, int nVars, int LutSize )
+{
+    If_DsdMan_t * p = NULL;
+    char * pFileName = ABC_ALLOC( char, strlen(pDirName) + 20 );
+    FILE * pFile;
+    sprintf( pFileName, "%s/%02d_%02d.dsd", pDirName, nVars, LutSize );
+    if ( (pFile = fopen( pFileName, "rb" )) )
+    {
+        fclose( pFile );
+        p = If_DsdManLoad( pFileName );
+        if ( p && (p->nVars != nVars || p->LutSize != LutSize) )
+        {
+            If_DsdManFree( p, 0 );
+            p = NULL;
+        }
+    }
+    if ( p == NULL )
+    {
+        p = If_DsdManAlloc( nVars, LutSize );
+        ABC_FREE( p->pStore );
+        p->pStore = pFileName;
+    }
+    else
+        ABC_FREE( pFileName );
+    p->fCache = 1;
+    return p;
+}
+void If_DsdManCacheUpdate( If_DsdMan_t * p )
+{
+    If_DsdMan_t * pStore = NULL;
+    FILE * pFile;
+    if ( Vec_PtrSize(&p->vObjs) == p->nObjsStore )
+        return;
+    if ( (pFile = fopen( p->pStore, "rb" )) )
+    {
+        fclose( pFile );
+        pStore = If_DsdManLoad( p->pStore );
+    }
+    if ( pStore && pStore->nVars == p->nVars && pStore->LutSize == p->LutSize && pStore->nTtBits == p->nTtBits && 
+         pStore->nConfigWords == p->nConfigWords && Vec_PtrSize(&pStore->vObjs) != p->nObjsStore )
+        If_DsdManMerge( p, pStore );
+    if ( pStore )
+        If_DsdManFree( pStore, 0 );
+    If_DsdManSave( p, NULL );
+}
 void If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew )
 {
     If_DsdObj_t * pObj; 
@@ -182,7 +182,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    pCutSet = p->fCutSetsExt ? pObj->pCutSet : If_ManSetupNodeCutSet( p, pObj );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -508,7 +508,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
     // free the cuts
-    If_ManDerefNodeCutSet( p, pObj );
+    if ( !p->fCutSetsExt )
+        If_ManDerefNodeCutSet( p, pObj );
 }
 
 /**Function*************************************************************
@@ -596,6 +597,132 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping pass can use several threads.]
+
+  Description [Only delay-oriented passes are mapped concurrently because
+  area recovery updates the reference counters of the nodes in the order
+  of their IDs. Cut functions and user-defined costs are not supported.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingCanPar( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( Mode != 0 || p->vLevels == NULL )
+        return 0;
+    if ( pPars->fTruth || pPars->fUseDsd || pPars->fUseTtPerm || pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || 
+         pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D || pPars->nGateSize > 0 || 
+         pPars->fLiftLeaves || pPars->fPower || pPars->pFuncCost || pPars->pFuncUser || p->vCuts )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps a range of nodes of one level.]
+
+  Description [Each thread uses a private copy of the manager to collect
+  statistics. The cutsets of the nodes are allocated by the caller.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct If_ParJob_t_ If_ParJob_t;
+struct If_ParJob_t_
+{
+    If_Man_t *         p;             // the mapping manager
+    Vec_Ptr_t *        vLevel;        // the nodes of the level
+    int                iStart;        // the first node
+    int                iStop;         // the node following the last one
+    int                Mode;          // the mapping mode
+    int                fPreprocess;   // the preprocessing flag
+    int                fFirst;        // the first pass flag
+    int                nCutsMerged;   // the number of cuts merged
+    int                nCutsTotal;    // the total number of cuts
+};
+int If_ManPerformMappingJob( void * pArg )
+{
+    If_ParJob_t * pJob = (If_ParJob_t *)pArg;
+    If_Man_t Man = *pJob->p;
+    int i;
+    Man.nCutsMerged = Man.nCutsTotal = 0;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        If_ObjPerformMappingAnd( &Man, (If_Obj_t *)Vec_PtrEntry(pJob->vLevel, i), pJob->Mode, pJob->fPreprocess, pJob->fFirst );
+    pJob->nCutsMerged = Man.nCutsMerged;
+    pJob->nCutsTotal  = Man.nCutsTotal;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass using several threads.]
+
+  Description [Maps the nodes level by level. The nodes of one level do 
+  not depend on each other, so each thread maps a range of them. The 
+  cutsets are allocated before the level is mapped and released after 
+  it is mapped. Since every node is mapped in the same way as in the 
+  sequential pass, the resulting mapping is the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingLevels( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_ParJob_t pJobs[100];
+    Vec_Ptr_t * vData = Vec_PtrAlloc( 100 );
+    Vec_Ptr_t * vLevel;
+    If_Obj_t * pObj;
+    int i, k, nJobs = Abc_MinInt( p->pPars->nProcs, 99 );
+    assert( nJobs >= 2 );
+    p->fCutSetsExt = 1;
+    Vec_VecForEachLevel( p->vLevels, vLevel, k )
+    {
+        Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+            If_ManSetupNodeCutSet( p, pObj );
+        if ( Vec_PtrSize(vLevel) < 64 * nJobs )
+        {
+            Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+                If_ObjPerformMappingAnd( p, pObj, Mode, fPreprocess, fFirst );
+        }
+        else
+        {
+            Vec_PtrClear( vData );
+            for ( i = 0; i < nJobs; i++ )
+            {
+                pJobs[i].p           = p;
+                pJobs[i].vLevel      = vLevel;
+                pJobs[i].iStart      = i * Vec_PtrSize(vLevel) / nJobs;
+                pJobs[i].iStop       = (i + 1) * Vec_PtrSize(vLevel) / nJobs;
+                pJobs[i].Mode        = Mode;
+                pJobs[i].fPreprocess = fPreprocess;
+                pJobs[i].fFirst      = fFirst;
+                Vec_PtrPush( vData, pJobs + i );
+            }
+            Util_ProcessThreads( If_ManPerformMappingJob, vData, nJobs + 1, 0, 0 );
+            for ( i = 0; i < nJobs; i++ )
+            {
+                p->nCutsMerged += pJobs[i].nCutsMerged;
+                p->nCutsTotal  += pJobs[i].nCutsTotal;
+            }
+        }
+        Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+            If_ManDerefNodeCutSet( p, pObj );
+    }
+    p->fCutSetsExt = 0;
+    Vec_PtrFree( vData );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -662,6 +789,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPerformMappingCanPar( p, Mode ) )
+        If_ManPerformMappingLevels( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
@@ -349,6 +349,68 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the AND nodes by level.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Vec_t * If_ManLevelizeNodes( If_Man_t * p )
+{
+    Vec_Vec_t * vLevels;
+    If_Obj_t * pObj;
+    int i;
+    vLevels = Vec_VecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_VecPush( vLevels, pObj->Level, pObj );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut when the nodes are mapped by level.]
+
+  Description [Assumes that the cutsets of all nodes of a level are 
+  allocated before the level is mapped and released after it is mapped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p, Vec_Vec_t * vLevels )
+{
+    Vec_Ptr_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, nCutSize = 0, nCutSizeMax = 0;
+    Vec_VecForEachLevel( vLevels, vLevel, k )
+    {
+        nCutSize += Vec_PtrSize(vLevel);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+        {
+            assert( !pObj->fRepr );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
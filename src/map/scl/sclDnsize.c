@@ -27,6 +27,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the number of nodes whose windows are evaluated together
+#define SCL_SIZE_BATCH  1024
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -90,23 +93,21 @@ void Abc_SclFindWindow( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int_t ** p
 
 /**Function*************************************************************
 
-  Synopsis    [Returns 1 if the node can be improved.]
+  Synopsis    [Finds the best smaller gate for the node.]
 
-  Description [Updated the node to have a new gate.]
+  Description [Returns the gate or -1 if there is no improvement. 
+  The gate assignment and the timing information are not changed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+int Abc_SclFindSmallerCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest )
 {
-    Abc_Obj_t * pTemp;
     SC_Cell * pCellOld, * pCellNew;
     float dGain, dGainBest;
-    int i, k, gateBest;
-    abctime clk;
-clk = Abc_Clock();
+    int i, gateBest;
 //    printf( "%d -> %d\n", Vec_IntSize(vNodes), Vec_IntSize(vEvals) );
     // save old gate, timing, fanin load
     pCellOld = Abc_SclObjCell( pObj );
@@ -123,12 +124,12 @@ clk = Abc_Clock();
         if ( i > Notches )
             break;
         // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        Abc_SclManTryCell( p, pObj, pCellNew );
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vNodes );
         // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        Abc_SclManTryCell( p, NULL, NULL );
         Abc_SclLoadRestore( p, pObj );
         // evaluate gain
         dGain = Abc_SclEvalPerformLegal( p, vEvals, p->MaxDelay0 );
@@ -141,26 +142,65 @@ clk = Abc_Clock();
             gateBest = pCellNew->Id;
         }
     } 
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vNodes );
+    *pGainBest = dGainBest;
+    return gateBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the node to have a new gate.]
+
+  Description [Returns 1 if the node was updated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclApplySmallerCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, int gateBest )
+{
+    Abc_Obj_t * pTemp;
+    SC_Cell * pCellOld, * pCellNew;
+    int k;
+    if ( gateBest < 0 )
+        return 0;
+    pCellOld = Abc_SclObjCell( pObj );
+    pCellNew = SC_LibCell( p->pLib, gateBest );
+    Abc_SclObjSetCell( pObj, pCellNew );
+    p->SumArea += pCellNew->area - pCellOld->area;
+//    printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
+//    printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
+    // mark used nodes with the current trav ID
+    Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
+        Abc_NodeSetTravIdCurrent( pTemp );
+    // update load and timing...
+    Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+    Abc_SclTimeIncInsert( p, pObj );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node can be improved.]
+
+  Description [Updated the node to have a new gate.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+{
+    float dGainBest;
+    int gateBest;
+    abctime clk;
+clk = Abc_Clock();
+    gateBest = Abc_SclFindSmallerCell( p, pObj, vNodes, vEvals, Notches, DelayGap, &dGainBest );
 p->timeSize += Abc_Clock() - clk;
-    if ( gateBest >= 0 )
-    {
-        pCellNew = SC_LibCell( p->pLib, gateBest );
-        Abc_SclObjSetCell( pObj, pCellNew );
-        p->SumArea += pCellNew->area - pCellOld->area;
-//        printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
-//        printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
-        // mark used nodes with the current trav ID
-        Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
-            Abc_NodeSetTravIdCurrent( pTemp );
-        // update load and timing...
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        Abc_SclTimeIncInsert( p, pObj );
-        return 1;
-    }
-    return 0;
+    return Abc_SclApplySmallerCell( p, pObj, vNodes, gateBest );
 }
 
 /**Function*************************************************************
@@ -197,6 +237,81 @@ int Abc_SclCheckOverlap( Abc_Ntk_t * pNtk, Vec_Int_t * vNodes )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of downsizing using several threads.]
+
+  Description [The nodes are taken from the queue in the same order as 
+  in the serial round and a node is skipped if its window overlaps with
+  the window of a node updated in this round. The difference is that 
+  the smaller gates are found in advance for a batch of nodes by several
+  threads. Updating a node changes only its gate and the loads of its 
+  fanins, which belong to its window, while the timing is restored after
+  each evaluation. So the gates found in advance for the nodes, whose 
+  windows do not overlap with the updated ones, are the same as those 
+  found by the serial round.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclDnsizeRoundPar( SC_Man * p, SC_SizePars * pPars, Vec_Int_t * vTryLater, int * pnAttempt, int * pnOverlap, int * pnChanges )
+{
+    Vec_Int_t * vNodes  = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vEvals  = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vPivots = Vec_IntAlloc( SCL_SIZE_BATCH );
+    Vec_Int_t * vGates  = Vec_IntAlloc( SCL_SIZE_BATCH );
+    Vec_Flt_t * vGains  = Vec_FltAlloc( SCL_SIZE_BATCH );
+    Vec_Wec_t * vWins   = Vec_WecAlloc( 2 * SCL_SIZE_BATCH );
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj;
+    abctime clk;
+    int k, fOverlap;
+    while ( Vec_QueSize(p->vNodeByGain) > 0 )
+    {
+        // collect the windows of the next nodes
+        clk = Abc_Clock();
+        Vec_IntClear( vPivots );
+        Vec_WecClear( vWins );
+        while ( Vec_QueSize(p->vNodeByGain) > 0 && Vec_IntSize(vPivots) < SCL_SIZE_BATCH )
+        {
+            pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
+            Abc_SclFindWindow( pObj, &vNodes, &vEvals );
+            // the windows overlapping with the updated ones are left empty
+            fOverlap = Abc_SclCheckOverlap( p->pNtk, vNodes );
+            Vec_IntPush( vPivots, Abc_ObjId(pObj) );
+            vLevel = Vec_WecPushLevel( vWins );
+            if ( !fOverlap )
+                Vec_IntAppend( vLevel, vNodes );
+            vLevel = Vec_WecPushLevel( vWins );
+            if ( !fOverlap )
+                Vec_IntAppend( vLevel, vEvals );
+        }
+        p->timeCone += Abc_Clock() - clk;
+        // find the smaller gates
+        clk = Abc_Clock();
+        Abc_SclEvalWindows( p, vPivots, vWins, pPars->Notches, pPars->DelayGap, 0, vGates, vGains );
+        p->timeSize += Abc_Clock() - clk;
+        // update the nodes in the original order
+        Abc_NtkForEachObjVec( vPivots, p->pNtk, pObj, k )
+        {
+            vLevel = Vec_WecEntry( vWins, 2*k );
+            if ( Vec_IntSize(vLevel) == 0 || Abc_SclCheckOverlap( p->pNtk, vLevel ) )
+                (*pnOverlap)++, Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
+            else 
+                *pnChanges += Abc_SclApplySmallerCell( p, pObj, vLevel, Vec_IntEntry(vGates, k) );
+            (*pnAttempt)++;
+        }
+    }
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vEvals );
+    Vec_IntFree( vPivots );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+    Vec_WecFree( vWins );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print cumulative statistics.]
@@ -263,6 +378,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst );
     p->pFuncFanin = (float (*)(void *, Abc_Obj_t *, Abc_Obj_t *, int, int))pFuncFanin;
     p->timeTotal  = Abc_Clock();
+    Abc_SclManViewsStart( p, pPars->nProcs );
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
 
@@ -280,17 +396,22 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             int nAttempt = 0, nOverlap = 0, nChanges = 0;
             Vec_IntClear( vTryLater );
             Abc_NtkIncrementTravId( pNtk );
-            while ( Vec_QueSize(p->vNodeByGain) > 0 )
+            if ( p->pViews && !p->pFuncFanin )
+                Abc_SclDnsizeRoundPar( p, pPars, vTryLater, &nAttempt, &nOverlap, &nChanges );
+            else
             {
-                clk = Abc_Clock();
-                pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
-                Abc_SclFindWindow( pObj, &vNodes, &vEvals );
-                p->timeCone += Abc_Clock() - clk;
-                if ( Abc_SclCheckOverlap( p->pNtk, vNodes ) )
-                    nOverlap++, Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
-                else 
-                    nChanges += Abc_SclCheckImprovement( p, pObj, vNodes, vEvals, pPars->Notches, pPars->DelayGap );
-                nAttempt++;
+                while ( Vec_QueSize(p->vNodeByGain) > 0 )
+                {
+                    clk = Abc_Clock();
+                    pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
+                    Abc_SclFindWindow( pObj, &vNodes, &vEvals );
+                    p->timeCone += Abc_Clock() - clk;
+                    if ( Abc_SclCheckOverlap( p->pNtk, vNodes ) )
+                        nOverlap++, Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
+                    else 
+                        nChanges += Abc_SclCheckImprovement( p, pObj, vNodes, vEvals, pPars->Notches, pPars->DelayGap );
+                    nAttempt++;
+                }
             }
             Abc_NtkForEachObjVec( vTryLater, pNtk, pObj, k )
                 Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
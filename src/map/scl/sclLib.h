@@ -33,6 +33,10 @@
 #include <math.h>
 #include "misc/vec/vec.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 ABC_NAMESPACE_HEADER_START
 
 
@@ -95,6 +99,7 @@ struct SC_SizePars_
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
+    int        nProcs;           // the number of threads
     int        fVerbose;
     int        fVeryVerbose;
 };
@@ -161,6 +166,7 @@ struct SC_Surface_
     Vec_Int_t      vIndex1I;       // Vec<float>       -- correspondes to "index_2" in the liberty file (for timing: load)
     Vec_Ptr_t      vDataI;         // Vec<Vec<float> > -- 'data[i0][i1]' gives value at '(index0[i0], index1[i1])' 
     float          approx[3][6];
+    float *        pFlat;          // index0, index1 and data[i0][i1] copied into one array (see Abc_SclLibPrepareLookup)
 };
 
 struct SC_Timing_ 
@@ -172,6 +178,7 @@ struct SC_Timing_
     SC_Surface     pCellFall;
     SC_Surface     pRiseTrans;     // -- Used to compute output slew
     SC_Surface     pFallTrans;
+    int            fPaired;        // -- the delay and transition tables of each edge have the same indexes
 };
 
 struct SC_Timings_ 
@@ -399,6 +406,7 @@ static inline void Abc_SclSurfaceFree( SC_Surface * p )
     Vec_VecErase( (Vec_Vec_t *)&p->vData );
     Vec_VecErase( (Vec_Vec_t *)&p->vDataI );
     ABC_FREE( p->pName );
+    ABC_FREE( p->pFlat );
 //    ABC_FREE( p );
 }
 static inline void Abc_SclTimingFree( SC_Timing * p )
@@ -472,6 +480,88 @@ static inline void Abc_SclLibFree( SC_Lib * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Lookup table delay computation using the flat tables.]
+
+  Description [Performs the same computation as Scl_LibLookup() on the
+  copy of the table prepared by Abc_SclLibPrepareLookup(), which avoids 
+  following the pointers to the rows. Scl_LibLookupPair() looks up two 
+  tables with the same indexes, such as the delay and transition tables 
+  of one edge, finding the sample points only once and interpolating 
+  in both tables together.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline float Scl_LibLookupFlat( SC_Surface * p, float slew, float load )
+{
+    int n0 = Vec_FltSize(&p->vIndex0), n1 = Vec_FltSize(&p->vIndex1);
+    float * pIndex0 = p->pFlat, * pIndex1 = p->pFlat + n0, * pDataS, * pDataS1;
+    float sfrac, lfrac, p0, p1;
+    int s, l;
+    if ( n0 == 1 && n1 == 1 )
+        return p->pFlat[2];
+    for ( s = 1; s < n0-1; s++ )
+        if ( pIndex0[s] > slew )
+            break;
+    s--;
+    for ( l = 1; l < n1-1; l++ )
+        if ( pIndex1[l] > load )
+            break;
+    l--;
+    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+    pDataS  = p->pFlat + n0 + n1 + s * n1;
+    pDataS1 = pDataS + n1;
+    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
+    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+    return p0 + sfrac * (p1 - p0);
+}
+static inline void Scl_LibLookupPair( SC_Surface * p, SC_Surface * q, float slew, float load, float * pRes )
+{
+    int n0 = Vec_FltSize(&p->vIndex0), n1 = Vec_FltSize(&p->vIndex1);
+    float * pIndex0 = p->pFlat, * pIndex1 = p->pFlat + n0, * pDataP, * pDataQ;
+    float sfrac, lfrac, r[4];
+    int s, l;
+    if ( n0 == 1 && n1 == 1 )
+    {
+        pRes[0] = p->pFlat[2];
+        pRes[1] = q->pFlat[2];
+        return;
+    }
+    for ( s = 1; s < n0-1; s++ )
+        if ( pIndex0[s] > slew )
+            break;
+    s--;
+    for ( l = 1; l < n1-1; l++ )
+        if ( pIndex1[l] > load )
+            break;
+    l--;
+    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+    pDataP = p->pFlat + n0 + n1 + s * n1 + l;
+    pDataQ = q->pFlat + n0 + n1 + s * n1 + l;
+    // interpolate along the load in rows s and s+1 of both tables
+#if defined(__SSE2__)
+    {
+        __m128 a = _mm_set_ps( pDataQ[n1], pDataQ[0], pDataP[n1], pDataP[0] );
+        __m128 b = _mm_set_ps( pDataQ[n1+1], pDataQ[1], pDataP[n1+1], pDataP[1] );
+        _mm_storeu_ps( r, _mm_add_ps(a, _mm_mul_ps(_mm_set1_ps(lfrac), _mm_sub_ps(b, a))) );
+    }
+#else
+    r[0] = pDataP[0]  + lfrac * (pDataP[1]    - pDataP[0]);
+    r[1] = pDataP[n1] + lfrac * (pDataP[n1+1] - pDataP[n1]);
+    r[2] = pDataQ[0]  + lfrac * (pDataQ[1]    - pDataQ[0]);
+    r[3] = pDataQ[n1] + lfrac * (pDataQ[n1+1] - pDataQ[n1]);
+#endif
+    // interpolate along the slew
+    pRes[0] = r[0] + sfrac * (r[1] - r[0]);
+    pRes[1] = r[2] + sfrac * (r[3] - r[2]);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Lookup table delay computation.]
@@ -489,6 +579,9 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
     float sfrac, lfrac, p0, p1;
     int s, l;
 
+    if ( p->pFlat )
+        return Scl_LibLookupFlat( p, slew, load );
+
     // handle constant table
     if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
     {
@@ -525,6 +618,29 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 }
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    if ( pTime->fPaired )
+    {
+        float Rise[2], Fall[2]; // delay and transition
+        if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+        {
+            Scl_LibLookupPair( &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->rise, pLoad->rise, Rise );
+            Scl_LibLookupPair( &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->fall, pLoad->fall, Fall );
+            pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Rise[0] );
+            pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Fall[0] );
+            pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Rise[1] );
+            pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Fall[1] );
+        }
+        if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+        {
+            Scl_LibLookupPair( &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->fall, pLoad->rise, Rise );
+            Scl_LibLookupPair( &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->rise, pLoad->fall, Fall );
+            pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Rise[0] );
+            pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Fall[0] );
+            pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Rise[1] );
+            pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Fall[1] );
+        }
+        return;
+    }
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
         pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
@@ -742,6 +858,7 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 
 /*=== sclLiberty.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts );
+extern SC_Lib *      Abc_SclReadLibertyImage( char * pFileName, char * pImageName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
@@ -759,6 +876,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern void          Abc_SclLibPrepareLookup( SC_Lib * p );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
@@ -739,6 +739,7 @@ void Abc_SclLibNormalizeSurface( SC_Surface * p, float Time, float Load )
 {
     Vec_Flt_t * vArray;
     int i, k; float Entry;
+    ABC_FREE( p->pFlat );
     Vec_FltForEachEntry( &p->vIndex0, Entry, i ) // slew
         Vec_FltWriteEntry( &p->vIndex0, i, Time * Entry );
     Vec_FltForEachEntry( &p->vIndex1, Entry, i ) // load
@@ -780,10 +781,76 @@ void Abc_SclLibNormalize( SC_Lib * p )
             Abc_SclLibNormalizeSurface( &pTiming->pCellFall, Time, Load );
             Abc_SclLibNormalizeSurface( &pTiming->pRiseTrans, Time, Load );
             Abc_SclLibNormalizeSurface( &pTiming->pFallTrans, Time, Load );
+            pTiming->fPaired = 0;
         }
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the tables for fast lookups.]
+
+  Description [Copies the indexes and the data of each table into one 
+  array, which is used by Scl_LibLookup() when present, and marks the 
+  edges whose delay and transition tables have the same indexes, for 
+  which Scl_LibPinArrival() looks up both tables together. The values 
+  computed do not change. Does nothing for the tables already prepared.
+  Should be called before the library is used by several threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclLibPrepareSurface( SC_Surface * p )
+{
+    Vec_Flt_t * vArray;
+    int n0 = Vec_FltSize(&p->vIndex0), n1 = Vec_FltSize(&p->vIndex1), i;
+    if ( p->pFlat != NULL )
+        return;
+    // the tables with one sample point along one axis are looked up by the original code
+    if ( !(n0 == 1 && n1 == 1) && (n0 < 2 || n1 < 2) )
+        return;
+    if ( Vec_PtrSize(&p->vData) != n0 )
+        return;
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vArray, i )
+        if ( Vec_FltSize(vArray) != n1 )
+            return;
+    p->pFlat = ABC_ALLOC( float, n0 + n1 + n0 * n1 );
+    memcpy( p->pFlat, Vec_FltArray(&p->vIndex0), sizeof(float) * n0 );
+    memcpy( p->pFlat + n0, Vec_FltArray(&p->vIndex1), sizeof(float) * n1 );
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vArray, i )
+        memcpy( p->pFlat + n0 + n1 + i * n1, Vec_FltArray(vArray), sizeof(float) * n1 );
+}
+static int Abc_SclLibSurfacesPaired( SC_Surface * p, SC_Surface * q )
+{
+    if ( p->pFlat == NULL || q->pFlat == NULL )
+        return 0;
+    if ( Vec_FltSize(&p->vIndex0) != Vec_FltSize(&q->vIndex0) || Vec_FltSize(&p->vIndex1) != Vec_FltSize(&q->vIndex1) )
+        return 0;
+    return !memcmp( p->pFlat, q->pFlat, sizeof(float) * (Vec_FltSize(&p->vIndex0) + Vec_FltSize(&p->vIndex1)) );
+}
+void Abc_SclLibPrepareLookup( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pTimings;
+    SC_Timing * pTiming;
+    int i, k, m, n;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPinOut( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pTimings, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pTimings->vTimings, pTiming, n )
+    {
+        Abc_SclLibPrepareSurface( &pTiming->pCellRise );
+        Abc_SclLibPrepareSurface( &pTiming->pCellFall );
+        Abc_SclLibPrepareSurface( &pTiming->pRiseTrans );
+        Abc_SclLibPrepareSurface( &pTiming->pFallTrans );
+        pTiming->fPaired = Abc_SclLibSurfacesPaired( &pTiming->pCellRise, &pTiming->pRiseTrans ) && 
+                           Abc_SclLibSurfacesPaired( &pTiming->pCellFall, &pTiming->pFallTrans );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives simple GENLIB library.]
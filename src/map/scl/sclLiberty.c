@@ -19,10 +19,16 @@
 ***********************************************************************/
 #include <string.h>
 #ifdef _WIN32
+#include <windows.h>
 #include <shlwapi.h>
+#include <process.h>
 #pragma comment(lib, "shlwapi.lib")
 #else 
 #include <fnmatch.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 #include "misc/zlib/zlib.h"
@@ -1770,7 +1776,19 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts )
+/**Function*************************************************************
+
+  Synopsis    [Parses the Liberty file and builds the library.]
+
+  Description [If pvStr is not NULL, also returns the library in the 
+  binary SCL format, which should be freed by the caller.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static SC_Lib * Abc_SclReadLibertyInt( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts, Vec_Str_t ** pvStr )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
@@ -1787,13 +1805,211 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, S
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
+    {
+        Vec_StrFree( vStr );
         return NULL;
+    }
     pLib->pFileName = Abc_UtilStrsav( pFileName );
     Abc_SclLibNormalize( pLib );
-    Vec_StrFree( vStr );
+    if ( pvStr )
+        *pvStr = vStr;
+    else
+        Vec_StrFree( vStr );
 //    printf( "Average slew = %.2f ps\n", Abc_SclComputeAverageSlew(pLib) );
     return pLib;
 }
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts )
+{
+    return Abc_SclReadLibertyInt( pFileName, fVerbose, fVeryVerbose, dont_use, fSkipMultiOuts, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading Liberty library through the compiled image.]
+
+  Description [The image is a file holding the library in the binary SCL 
+  format produced by the Liberty parser, preceded by a fixed-size header. 
+  The header records the byte order, the format version, the size and the 
+  hash of the contents of the Liberty file, the hash of the options that 
+  change the parsing result, and the checksum of the SCL data. If the 
+  header matches the Liberty file, the image is mapped into memory and 
+  the library is built directly from it without parsing the text. 
+  Otherwise, the Liberty file is parsed and the image is written anew.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SCL_IMAGE_MAGIC   "SCLIMG01"
+#define SCL_IMAGE_HEADER  8  // the number of words in the header
+
+static char * Scl_LibertyImageRead( char * pFileName, word * pnBytes, int * pfMapped )
+{
+    char * pImage;
+    FILE * pFile;
+    int RetValue;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        pImage = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( pImage != (char *)MAP_FAILED )
+        {
+            close( fd );
+            *pnBytes = (word)Stat.st_size;
+            *pfMapped = 1;
+            return pImage;
+        }
+    }
+    close( fd );
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    *pnBytes = (word)Scl_LibertyFileSize( pFileName );
+    pImage = ABC_ALLOC( char, *pnBytes + 8 );
+    RetValue = fread( pImage, *pnBytes, 1, pFile );
+    fclose( pFile );
+    if ( *pnBytes && RetValue != 1 )
+    {
+        ABC_FREE( pImage );
+        return NULL;
+    }
+    *pfMapped = 0;
+    return pImage;
+}
+static void Scl_LibertyImageRelease( char * pImage, word nBytes, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pImage, (size_t)nBytes );
+        return;
+    }
+#endif
+    ABC_FREE( pImage );
+}
+static word Scl_LibertyImageHash( word Hash, char * pData, word nBytes )
+{
+    word i, Word, nWords = nBytes / 8;
+    for ( i = 0; i < nWords; i++ )
+    {
+        memcpy( &Word, pData + 8 * i, 8 );
+        Hash = (Hash ^ Word) * ABC_CONST(0x100000001B3);
+    }
+    for ( i = 8 * nWords; i < nBytes; i++ )
+        Hash = (Hash ^ (word)(unsigned char)pData[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+static word Scl_LibertyImageOptHash( SC_DontUse dont_use, int fSkipMultiOuts )
+{
+    word Hash = Scl_LibertyImageHash( ABC_CONST(0xCBF29CE484222325), (char *)&fSkipMultiOuts, sizeof(int) );
+    int i;
+    for ( i = 0; i < dont_use.size; i++ )
+        Hash = Scl_LibertyImageHash( Hash, dont_use.dont_use_list[i], (word)strlen(dont_use.dont_use_list[i]) + 1 );
+    return Hash;
+}
+static int Scl_LibertyImageRename( char * pTempName, char * pImageName )
+{
+#ifdef _WIN32
+    // rename() fails on Windows when the target exists
+    return MoveFileExA( pTempName, pImageName, MOVEFILE_REPLACE_EXISTING ) ? 0 : -1;
+#else
+    return rename( pTempName, pImageName );
+#endif
+}
+static void Scl_LibertyImageWrite( char * pImageName, word * pHeader, Vec_Str_t * vStr )
+{
+    char * pTempName = ABC_ALLOC( char, strlen(pImageName) + 20 );
+    FILE * pFile;
+    int RetValue = 1;
+    // write into a temporary file and rename it, so that concurrent jobs never see a partial image
+#ifdef _WIN32
+    sprintf( pTempName, "%s.tmp%d", pImageName, (int)_getpid() );
+#else
+    sprintf( pTempName, "%s.tmp%d", pImageName, (int)getpid() );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the library image.\n", pTempName );
+        ABC_FREE( pTempName );
+        return;
+    }
+    RetValue &= fwrite( pHeader, sizeof(word), SCL_IMAGE_HEADER, pFile ) == SCL_IMAGE_HEADER;
+    RetValue &= fwrite( Vec_StrArray(vStr), 1, (size_t)Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+    RetValue &= fclose( pFile ) == 0;
+    if ( !RetValue || Scl_LibertyImageRename( pTempName, pImageName ) != 0 )
+    {
+        printf( "Writing the library image into file \"%s\" has failed.\n", pImageName );
+        remove( pTempName );
+    }
+    ABC_FREE( pTempName );
+}
+SC_Lib * Abc_SclReadLibertyImage( char * pFileName, char * pImageName, int fVerbose, int fVeryVerbose, SC_DontUse dont_use, int fSkipMultiOuts )
+{
+    abctime clk = Abc_Clock();
+    SC_Lib * pLib = NULL;
+    Vec_Str_t * vStr = NULL;
+    word Header[SCL_IMAGE_HEADER], nLibBytes, nImageBytes;
+    char * pLibData, * pImage;
+    int fLibMapped, fImageMapped;
+    // hash the contents of the Liberty file
+    pLibData = Scl_LibertyImageRead( pFileName, &nLibBytes, &fLibMapped );
+    if ( pLibData == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    memset( Header, 0, sizeof(Header) );
+    memcpy( Header, SCL_IMAGE_MAGIC, 8 );
+    Header[1] = ABC_CONST(0x0102030405060708);
+    Header[2] = ABC_SCL_CUR_VERSION;
+    Header[3] = nLibBytes;
+    Header[4] = Scl_LibertyImageHash( ABC_CONST(0xCBF29CE484222325), pLibData, nLibBytes );
+    Header[5] = Scl_LibertyImageOptHash( dont_use, fSkipMultiOuts );
+    Scl_LibertyImageRelease( pLibData, nLibBytes, fLibMapped );
+    // try the image
+    pImage = Scl_LibertyImageRead( pImageName, &nImageBytes, &fImageMapped );
+    if ( pImage != NULL )
+    {
+        word * pHeader = (word *)pImage;
+        if ( nImageBytes >= sizeof(Header) && !memcmp(pHeader, Header, 6 * sizeof(word)) &&
+             pHeader[6] == nImageBytes - sizeof(Header) && pHeader[6] < (word)ABC_INFINITY &&
+             pHeader[7] == Scl_LibertyImageHash( ABC_CONST(0xCBF29CE484222325), pImage + sizeof(Header), pHeader[6] ) )
+        {
+            // use the mapped data in place as the SCL string
+            Vec_Str_t vData = { (int)pHeader[6], (int)pHeader[6], pImage + sizeof(Header) };
+            pLib = Abc_SclReadFromStr( &vData );
+        }
+        Scl_LibertyImageRelease( pImage, nImageBytes, fImageMapped );
+        if ( pLib != NULL )
+        {
+            pLib->pFileName = Abc_UtilStrsav( pFileName );
+            Abc_SclLibNormalize( pLib );
+            if ( fVerbose )
+            {
+                printf( "Library \"%s\" from \"%s\" has %d cells (loaded from image \"%s\").  ", 
+                    pLib->pName, pFileName, SC_LibCellNum(pLib), pImageName );
+                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            }
+            return pLib;
+        }
+    }
+    // parse the Liberty file and save the image
+    pLib = Abc_SclReadLibertyInt( pFileName, fVerbose, fVeryVerbose, dont_use, fSkipMultiOuts, &vStr );
+    if ( pLib == NULL )
+        return NULL;
+    Header[6] = (word)Vec_StrSize(vStr);
+    Header[7] = Scl_LibertyImageHash( ABC_CONST(0xCBF29CE484222325), Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+    Scl_LibertyImageWrite( pImageName, Header, vStr );
+    Vec_StrFree( vStr );
+    return pLib;
+}
 
 /**Function*************************************************************
 
@@ -34,6 +34,19 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest number of nodes processed by one thread
+#define SCL_PAR_CHUNK  256
+
+typedef struct Abc_SclTimeTask_t_ Abc_SclTimeTask_t;
+struct Abc_SclTimeTask_t_
+{
+    SC_Man *       p;             // the timing manager
+    Vec_Int_t *    vNodes;        // the nodes of one level
+    int            iBeg;          // the first node
+    int            iEnd;          // the last node (exclusive)
+    int            fDept;         // computing departure times
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -366,7 +379,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         p->nEstNodes++;
     }
     // get the library cell
-    pCell = Abc_SclObjCell( pObj );
+    pCell = Abc_SclManObjCell( p, pObj );
     // compute for each fanin
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -412,16 +425,120 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+/**Function*************************************************************
+
+  Synopsis    [Timing computation using several threads.]
+
+  Description [Abc_SclTimeNtkLevelize() puts the CIs and the constant 
+  nodes on level 0 and the other nodes on levels 1 and above. 
+  Abc_SclTimeNtkPar() computes the arrival times of the nodes level by
+  level or their departure times in the reverse order. The nodes of 
+  one level do not depend on each other and are divided among the 
+  threads. Unlike the serial code, where each node updates the 
+  departure times of its fanins, the departure time of a node is 
+  computed from its fanouts, similar to the incremental update, so 
+  that the threads write only to their own nodes. The maximum does not
+  depend on the order, so the results are the same as in the serial 
+  code.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wec_t * Abc_SclTimeNtkLevelize( SC_Man * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vLevel = Vec_IntStart( p->nObjs );
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level;
+    Abc_NtkForEachObj( p->pNtk, pObj, i )
+    {
+        if ( !Abc_ObjIsCi(pObj) && !Abc_ObjIsNode(pObj) )
+            continue;
+        Level = 0;
+        if ( Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 )
+            Abc_ObjForEachFanin( pObj, pFanin, k )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) + 1 );
+        Vec_IntWriteEntry( vLevel, i, Level );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+static int Abc_SclTimeNtkParTask( void * pArg )
+{
+    Abc_SclTimeTask_t * pTask = (Abc_SclTimeTask_t *)pArg;
+    Abc_Obj_t * pObj;
+    int i;
+    for ( i = pTask->iBeg; i < pTask->iEnd; i++ )
+    {
+        pObj = Abc_NtkObj( pTask->p->pNtk, Vec_IntEntry(pTask->vNodes, i) );
+        if ( pTask->fDept )
+            Abc_SclDeptObj( pTask->p, pObj );
+        else
+            Abc_SclTimeNode( pTask->p, pObj, 0 );
+    }
+    return 1;
+}
+static void Abc_SclTimeNtkPar( SC_Man * p, Vec_Wec_t * vLevels, int fDept )
+{
+    Abc_SclTimeTask_t * pTasks = ABC_CALLOC( Abc_SclTimeTask_t, p->nProcs );
+    Util_Task_t ** ppTasks = ABC_ALLOC( Util_Task_t *, p->nProcs );
+    Vec_Int_t * vLevel;
+    int i, t, nTasks;
+    Util_PoolStart( p->nProcs );
+    for ( i = 0; i < Vec_WecSize(vLevels); i++ )
+    {
+        // the arrival times of level 0 are computed by the caller
+        if ( !fDept && i == 0 )
+            continue;
+        vLevel = Vec_WecEntry( vLevels, fDept ? Vec_WecSize(vLevels) - 1 - i : i );
+        nTasks = Abc_MinInt( p->nProcs, (Vec_IntSize(vLevel) + SCL_PAR_CHUNK - 1) / SCL_PAR_CHUNK );
+        for ( t = 0; t < nTasks; t++ )
+        {
+            pTasks[t].p      = p;
+            pTasks[t].vNodes = vLevel;
+            pTasks[t].iBeg   = (int)((iword)Vec_IntSize(vLevel) * t / nTasks);
+            pTasks[t].iEnd   = (int)((iword)Vec_IntSize(vLevel) * (t+1) / nTasks);
+            pTasks[t].fDept  = fDept;
+        }
+        if ( nTasks < 2 )
+        {
+            if ( nTasks == 1 )
+                Abc_SclTimeNtkParTask( pTasks );
+            continue;
+        }
+        for ( t = 0; t < nTasks; t++ )
+            ppTasks[t] = Util_PoolSubmit( Abc_SclTimeNtkParTask, pTasks + t );
+        for ( t = 0; t < nTasks; t++ )
+        {
+            Util_TaskWait( ppTasks[t], 0 );
+            Util_TaskFree( ppTasks[t] );
+        }
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pTasks );
+}
+
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
+    Vec_Wec_t * vLevels = NULL;
     float D;
     int i;
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
     p->nEstNodes = 0;
+    // the nodes of one level can be processed in parallel unless 
+    // the load estimation or the fanin call-back are used
+    if ( p->nProcs > 1 && !p->EstLoadMax && !p->pFuncFanin )
+        vLevels = Abc_SclTimeNtkLevelize( p );
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
+    if ( vLevels )
+        Abc_SclTimeNtkPar( p, vLevels, 0 );
+    else
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
@@ -436,9 +553,13 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( fReverse )
     {
         p->nEstNodes = 0;
+        if ( vLevels )
+            Abc_SclTimeNtkPar( p, vLevels, 1 );
+        else
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
             Abc_SclTimeNode( p, pObj, 1 );
     }
+    Vec_WecFreeP( &vLevels );
 }
 
 /**Function*************************************************************
@@ -648,6 +769,7 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
 SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    Abc_SclLibPrepareLookup( pLib );
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -716,6 +838,52 @@ void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int f
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the runtime of the full timing update.]
+
+  Description [Recomputes the arrival and departure times nRounds times 
+  using one thread and then using nProcs threads, and checks that the 
+  results are the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeBench( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int nRounds, int nProcs )
+{
+    SC_Man * p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    SC_Pair * pTimes = ABC_ALLOC( SC_Pair, p->nObjs );
+    SC_Pair * pDepts = ABC_ALLOC( SC_Pair, p->nObjs );
+    int i, k, nNodes = Abc_NtkNodeNum(pNtk), nProcsAll[2] = { 1, nProcs };
+    abctime clk;
+    for ( k = 0; k < 2; k++ )
+    {
+        if ( k == 1 && nProcs < 2 )
+            break;
+        p->nProcs = nProcsAll[k];
+        clk = Abc_Clock();
+        for ( i = 0; i < nRounds; i++ )
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, 1, 0 );
+        clk = Abc_Clock() - clk;
+        printf( "Threads = %2d.  Rounds = %4d.  Nodes = %8d.  Time per round = %9.3f ms  (%7.3f ns per node).  ", 
+            p->nProcs, nRounds, nNodes, 1000.0 * clk / CLOCKS_PER_SEC / Abc_MaxInt(nRounds, 1), 
+            1.0e9 * clk / CLOCKS_PER_SEC / Abc_MaxInt(nRounds, 1) / Abc_MaxInt(nNodes, 1) );
+        ABC_PRT( "Total", clk );
+        if ( k == 0 )
+        {
+            memcpy( pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs );
+            memcpy( pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs );
+        }
+        else if ( memcmp(pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs) || memcmp(pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs) )
+            printf( "The results computed by %d threads are different.\n", nProcs );
+    }
+    ABC_FREE( pTimes );
+    ABC_FREE( pDepts );
+    Abc_SclManFree( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Printing out fanin information.]
@@ -82,6 +82,11 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    int            nProcs;        // the number of threads used by the full timing update
+    // evaluation of candidate gates
+    Abc_Obj_t *    pTrialObj;     // the node whose gate is being tried
+    SC_Cell *      pTrialCell;    // the gate tried at this node
+    SC_Man **      pViews;        // timing views used by the threads
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -110,6 +115,8 @@ static inline SC_Lib  * Abc_SclObjLib( Abc_Obj_t * p )
 static inline int       Abc_SclObjCellId( Abc_Obj_t * p )                           { return Vec_IntEntry( p->pNtk->vGates, Abc_ObjId(p) );                               }
 static inline SC_Cell * Abc_SclObjCell( Abc_Obj_t * p )                             { int c = Abc_SclObjCellId(p); return c == -1 ? NULL:SC_LibCell(Abc_SclObjLib(p), c); }
 static inline void      Abc_SclObjSetCell( Abc_Obj_t * p, SC_Cell * pCell )         { Vec_IntWriteEntry( p->pNtk->vGates, Abc_ObjId(p), pCell->Id );                      }
+static inline SC_Cell * Abc_SclManObjCell( SC_Man * p, Abc_Obj_t * pObj )           { return pObj == p->pTrialObj ? p->pTrialCell : Abc_SclObjCell(pObj);                }
+static inline void      Abc_SclManTryCell( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pCell ) { p->pTrialObj = pObj; p->pTrialCell = pCell;                                 }
 
 static inline SC_Pair * Abc_SclObjLoad( SC_Man * p, Abc_Obj_t * pObj )              { return p->pLoads + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )              { return p->pDepts + Abc_ObjId(pObj);  }
@@ -134,6 +141,104 @@ static inline void      Abc_SclManSetFaninCallBack( SC_Man * p, void * pCallBack
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Constructor/destructor of timing views.]
+
+  Description [A timing view has its own loads, departures, arrivals 
+  and slews, and shares the network, the library and the gate 
+  assignment with the manager. It is used by a thread to try the gates 
+  of a node without changing the manager. Before the windows are 
+  evaluated, the parameters of the manager are copied by 
+  Abc_SclManViewSyncPars() and the timing data of each window is copied
+  by Abc_SclManViewSync().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline SC_Man * Abc_SclManViewAlloc( SC_Man * p )
+{
+    SC_Man * pView = ABC_CALLOC( SC_Man, 1 );
+    pView->pLib       = p->pLib;
+    pView->pNtk       = p->pNtk;
+    pView->nObjs      = p->nObjs;
+    pView->pLoads     = ABC_CALLOC( SC_Pair, p->nObjs );
+    pView->pDepts     = ABC_CALLOC( SC_Pair, p->nObjs );
+    pView->pTimes     = ABC_CALLOC( SC_Pair, p->nObjs );
+    pView->pSlews     = ABC_CALLOC( SC_Pair, p->nObjs );
+    pView->vLoads2    = Vec_FltAlloc( 1000 );
+    pView->vLoads3    = Vec_FltAlloc( 1000 );
+    pView->vTimes2    = Vec_FltAlloc( 1000 );
+    pView->vTimes3    = Vec_FltAlloc( 1000 );
+    return pView;
+}
+static inline void Abc_SclManViewFree( SC_Man * pView )
+{
+    Vec_FltFreeP( &pView->vLoads2 );
+    Vec_FltFreeP( &pView->vLoads3 );
+    Vec_FltFreeP( &pView->vTimes2 );
+    Vec_FltFreeP( &pView->vTimes3 );
+    ABC_FREE( pView->pLoads );
+    ABC_FREE( pView->pDepts );
+    ABC_FREE( pView->pTimes );
+    ABC_FREE( pView->pSlews );
+    ABC_FREE( pView );
+}
+static inline void Abc_SclManViewsStart( SC_Man * p, int nProcs )
+{
+    int i;
+    assert( p->pViews == NULL );
+    p->nProcs = nProcs;
+    if ( nProcs < 2 )
+        return;
+    p->pViews = ABC_ALLOC( SC_Man *, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+        p->pViews[i] = Abc_SclManViewAlloc( p );
+}
+static inline void Abc_SclManViewsStop( SC_Man * p )
+{
+    int i;
+    if ( p->pViews == NULL )
+        return;
+    for ( i = 0; i < p->nProcs; i++ )
+        Abc_SclManViewFree( p->pViews[i] );
+    ABC_FREE( p->pViews );
+}
+static inline void Abc_SclManViewSyncPars( SC_Man * pView, SC_Man * p )
+{
+    assert( pView->pNtk == p->pNtk && pView->nObjs == p->nObjs );
+    pView->pWLoadUsed = p->pWLoadUsed;
+    pView->pPiDrive   = p->pPiDrive;
+    pView->EstLoadMax = p->EstLoadMax;
+    pView->EstLoadAve = p->EstLoadAve;
+    pView->EstLinear  = p->EstLinear;
+    pView->SumArea0   = p->SumArea0;
+    pView->MaxDelay0  = p->MaxDelay0;
+    pView->MaxDelay   = p->MaxDelay;
+}
+static inline void Abc_SclManViewSync( SC_Man * pView, SC_Man * p, Vec_Int_t * vCone )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Id;
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+    {
+        Id = Abc_ObjId(pObj);
+        pView->pLoads[Id] = p->pLoads[Id];
+        pView->pDepts[Id] = p->pDepts[Id];
+        pView->pTimes[Id] = p->pTimes[Id];
+        pView->pSlews[Id] = p->pSlews[Id];
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            Id = Abc_ObjId(pFanin);
+            pView->pLoads[Id] = p->pLoads[Id];
+            pView->pTimes[Id] = p->pTimes[Id];
+            pView->pSlews[Id] = p->pSlews[Id];
+        }
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Constructor/destructor of STA manager.]
@@ -200,6 +305,7 @@ static inline void Abc_SclManFree( SC_Man * p )
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         pObj->iData = 0;
     // other
+    Abc_SclManViewsStop( p );
     p->pNtk->pSCLib = NULL;
     Vec_IntFreeP( &p->pNtk->vGates );
     Vec_IntFreeP( &p->vNodeIter );
@@ -552,6 +658,7 @@ extern int           Abc_SclCheckNtk( Abc_Ntk_t * p, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclPerformBuffering( Abc_Ntk_t * p, int DegreeR, int Degree, int fUseInvs, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclBufPerform( Abc_Ntk_t * pNtk, int FanMin, int FanMax, int fBufPis, int fSkipDup, int fVerbose );
 /*=== sclDnsize.c ===============================================================*/
+extern int           Abc_SclFindSmallerCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest );
 extern void          Abc_SclDnsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars, void * pFuncFanin );
 /*=== sclLoad.c ===============================================================*/
 extern Vec_Flt_t *   Abc_SclFindWireCaps( SC_WireLoad * pWL, int nFanoutMax );
@@ -571,9 +678,12 @@ extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
 extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimeBench( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int nRounds, int nProcs );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
+extern int           Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest );
+extern void          Abc_SclEvalWindows( SC_Man * p, Vec_Int_t * vPivots, Vec_Wec_t * vWins, int Notches, int DelayGap, int fUpsize, Vec_Int_t * vGates, Vec_Flt_t * vGains );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars, void * pFuncFanin );
 /*=== sclUtil.c ===============================================================*/
 extern void          Abc_SclMioGates2SclGates( SC_Lib * pLib, Abc_Ntk_t * p );
@@ -27,6 +27,25 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest number of windows evaluated by one thread
+#define SCL_SIZE_CHUNK  16
+
+typedef struct Abc_SclSizeTask_t_ Abc_SclSizeTask_t;
+struct Abc_SclSizeTask_t_
+{
+    SC_Man *       p;             // the timing manager
+    SC_Man *       pView;         // the timing view (or NULL if the manager is used)
+    Vec_Int_t *    vPivots;       // the nodes to resize
+    Vec_Wec_t *    vWins;         // the recomputed and the evaluated nodes of each window
+    Vec_Int_t *    vGates;        // the best gate of each node
+    Vec_Flt_t *    vGains;        // the gain of the best gate
+    int            iBeg;          // the first window
+    int            iEnd;          // the last window (exclusive)
+    int            Notches;       // the limit on the resizing steps
+    int            DelayGap;      // the delay gap
+    int            fUpsize;       // increasing the gate sizes
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -292,12 +311,12 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
         if ( k > Notches )
             break;
         // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        Abc_SclManTryCell( p, pObj, pCellNew );
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vRecalcs );
         // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        Abc_SclManTryCell( p, NULL, NULL );
         Abc_SclLoadRestore( p, pObj );
         // save best gain
         dGain = Abc_SclEvalPerform( p, vEvals );
@@ -315,13 +334,103 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     }
 //    printf( "Best = %.2f   ", dGainBest );
 //    printf( "\n" );
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vRecalcs );
     *pGainBest = dGainBest;
     return gateBest;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the best gates for the nodes in several windows.]
+
+  Description [The window of the i-th node in vPivots consists of the 
+  nodes, whose timing is recomputed (entry 2*i of vWins), and the nodes,
+  whose timing is evaluated (entry 2*i+1 of vWins). The windows with no
+  nodes are skipped. Returns the best gate of each node (or -1) in vGates
+  and its gain in vGains. Trying the gates of a node does not change the
+  gate assignment or the timing information, so each node is evaluated 
+  in the same context. If the timing views are available, the windows 
+  are divided into contiguous ranges evaluated by several threads, each
+  using its own view. The results do not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclEvalWindowsTask( void * pArg )
+{
+    Abc_SclSizeTask_t * pTask = (Abc_SclSizeTask_t *)pArg;
+    SC_Man * p = pTask->pView ? pTask->pView : pTask->p;
+    Vec_Int_t * vRecalcs, * vEvals;
+    Abc_Obj_t * pObj;
+    float dGainBest = 0;
+    int i, gateBest;
+    for ( i = pTask->iBeg; i < pTask->iEnd; i++ )
+    {
+        vRecalcs = Vec_WecEntry( pTask->vWins, 2*i );
+        vEvals   = Vec_WecEntry( pTask->vWins, 2*i+1 );
+        if ( Vec_IntSize(vRecalcs) == 0 )
+            continue;
+        pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(pTask->vPivots, i) );
+        if ( pTask->pView )
+            Abc_SclManViewSync( pTask->pView, pTask->p, vRecalcs );
+        if ( pTask->fUpsize )
+            gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, pTask->Notches, pTask->DelayGap, &dGainBest );
+        else
+            gateBest = Abc_SclFindSmallerCell( p, pObj, vRecalcs, vEvals, pTask->Notches, pTask->DelayGap, &dGainBest );
+        Vec_IntWriteEntry( pTask->vGates, i, gateBest );
+        Vec_FltWriteEntry( pTask->vGains, i, dGainBest );
+    }
+    return 1;
+}
+void Abc_SclEvalWindows( SC_Man * p, Vec_Int_t * vPivots, Vec_Wec_t * vWins, int Notches, int DelayGap, int fUpsize, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Abc_SclSizeTask_t * pTasks;
+    Util_Task_t ** ppTasks;
+    int t, nWins = Vec_IntSize(vPivots);
+    int nTasks = (p->pViews && !p->pFuncFanin) ? Abc_MinInt( p->nProcs, nWins / SCL_SIZE_CHUNK ) : 1;
+    assert( Vec_WecSize(vWins) == 2 * nWins );
+    Vec_IntFill( vGates, nWins, -1 );
+    Vec_FltFill( vGains, nWins, 0 );
+    nTasks  = Abc_MaxInt( nTasks, 1 );
+    pTasks  = ABC_CALLOC( Abc_SclSizeTask_t, nTasks );
+    for ( t = 0; t < nTasks; t++ )
+    {
+        pTasks[t].p        = p;
+        pTasks[t].pView    = nTasks > 1 ? p->pViews[t] : NULL;
+        if ( pTasks[t].pView )
+            Abc_SclManViewSyncPars( pTasks[t].pView, p );
+        pTasks[t].vPivots  = vPivots;
+        pTasks[t].vWins    = vWins;
+        pTasks[t].vGates   = vGates;
+        pTasks[t].vGains   = vGains;
+        pTasks[t].iBeg     = (int)((iword)nWins * t / nTasks);
+        pTasks[t].iEnd     = (int)((iword)nWins * (t+1) / nTasks);
+        pTasks[t].Notches  = Notches;
+        pTasks[t].DelayGap = DelayGap;
+        pTasks[t].fUpsize  = fUpsize;
+    }
+    if ( nTasks == 1 )
+    {
+        Abc_SclEvalWindowsTask( pTasks );
+        ABC_FREE( pTasks );
+        return;
+    }
+    ppTasks = ABC_ALLOC( Util_Task_t *, nTasks );
+    Util_PoolStart( p->nProcs );
+    for ( t = 0; t < nTasks; t++ )
+        ppTasks[t] = Util_PoolSubmit( Abc_SclEvalWindowsTask, pTasks + t );
+    for ( t = 0; t < nTasks; t++ )
+    {
+        Util_TaskWait( ppTasks[t], 0 );
+        Util_TaskFree( ppTasks[t] );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pTasks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the set of gates to upsize.]
@@ -596,16 +705,19 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
 int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
 {
     SC_Cell * pCellOld, * pCellNew;
-    Vec_Int_t * vRecalcs, * vEvals;
+    Vec_Int_t * vRecalcs, * vEvals, * vPivots, * vGates;
+    Vec_Flt_t * vGains;
+    Vec_Wec_t * vWins;
     Vec_Ptr_t * vFanouts;
     Abc_Obj_t * pObj;
     float dGainBest, dGainBest2;
     int i, gateBest, Limit, Counter, iIterLast;
 
-    // compute savings due to upsizing each node
+    // collect the windows of the nodes to be upsized
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
-    Vec_QueClear( p->vNodeByGain );
+    vPivots = Vec_IntAlloc( 100 );
+    vWins = Vec_WecAlloc( 100 );
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
@@ -616,7 +728,22 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
         Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
         assert( Vec_IntSize(vEvals) > 0 );
         //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
-        gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
+        Vec_IntPush( vPivots, Abc_ObjId(pObj) );
+        Vec_IntAppend( Vec_WecPushLevel(vWins), vRecalcs );
+        Vec_IntAppend( Vec_WecPushLevel(vWins), vEvals );
+    }
+    Vec_IntFree( vRecalcs );
+    Vec_IntFree( vEvals );
+
+    // compute savings due to upsizing each node
+    vGates = Vec_IntAlloc( Vec_IntSize(vPivots) );
+    vGains = Vec_FltAlloc( Vec_IntSize(vPivots) );
+    Abc_SclEvalWindows( p, vPivots, vWins, Notches, DelayGap, 1, vGates, vGains );
+    Vec_QueClear( p->vNodeByGain );
+    Abc_NtkForEachObjVec( vPivots, p->pNtk, pObj, i )
+    {
+        gateBest  = Vec_IntEntry( vGates, i );
+        dGainBest = Vec_FltEntry( vGains, i );
         // remember savings
         if ( gateBest >= 0 )
         {
@@ -626,8 +753,10 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
             Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
         }
     }
-    Vec_IntFree( vRecalcs );
-    Vec_IntFree( vEvals );
+    Vec_IntFree( vPivots );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+    Vec_WecFree( vWins );
     if ( Vec_QueSize(p->vNodeByGain) == 0 )
         return 0;
 /*
@@ -893,6 +1022,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
     p->pFuncFanin = (float (*)(void *, Abc_Obj_t *, Abc_Obj_t *, int, int))pFuncFanin;    
     p->timeTotal  = Abc_Clock();
+    Abc_SclManViewsStart( p, pPars->nProcs );
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
     p->BestDelay  = p->MaxDelay0;
@@ -554,7 +554,22 @@ extern unsigned Abc_Random( int fReset );
 extern word     Abc_RandomW( int fReset );
 
 // pthreads
-extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+#define UTIL_POOL_THR_MAX 100  // the largest number of threads in the pool
+typedef struct Util_Task_t_ Util_Task_t;
+extern void          Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+extern void          Util_PoolStart( int nThreads );
+extern void          Util_PoolStop();
+extern int           Util_PoolThreadNum();
+extern int           Util_PoolThreadId();
+extern int           Util_PoolCanceled();
+extern Util_Task_t * Util_PoolSubmit( int (*pUserFunc)(void *), void * pData );
+extern int           Util_TaskWait( Util_Task_t * pTask, int TimeOut );
+extern int           Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks, int TimeOut );
+extern int           Util_TaskIsDone( Util_Task_t * pTask );
+extern int           Util_TaskResult( Util_Task_t * pTask );
+extern void          Util_TaskCancel( Util_Task_t * pTask );
+extern void          Util_TaskFree( Util_Task_t * pTask );
+extern void          Util_PoolBench( int nTasks, int nWork, int nProcs, int fVerbose );
 
 ABC_NAMESPACE_HEADER_END
 
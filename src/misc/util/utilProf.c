@@ -0,0 +1,286 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Built-in profiler.]
+
+  Synopsis    [Recording commands and phases as a Chrome trace.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(_WIN32)
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#include "misc/vec/vec.h"
+#include "utilProf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the largest nesting depth of the phases
+#define ABC_PROF_DEPTH  64
+
+int                      Abc_ProfEnabled = 0;
+
+static char *            s_pProfFile   = NULL;   // the output file name
+static Vec_Str_t *       s_vProfEvents = NULL;   // the recorded events in JSON
+static int               s_nProfEvents = 0;      // the number of recorded events
+static abctime           s_ProfClkBeg  = 0;      // the start of profiling
+static volatile word     s_nSatCalls   = 0;      // the number of SAT calls
+static int               s_nProfPhases = 0;      // the number of open phases
+static char *            s_pProfPhaseNames[ABC_PROF_DEPTH];
+static Abc_ProfStamp_t   s_ProfPhaseStamps[ABC_PROF_DEPTH];
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts recording the trace.]
+
+  Description [The trace is written into the given file when the
+  recording stops. Returns 0 if the profiler is already recording.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ProfStart( const char * pFileName )
+{
+    if ( Abc_ProfEnabled )
+        return 0;
+    s_pProfFile   = Abc_UtilStrsav( (char *)pFileName );
+    s_vProfEvents = Vec_StrAlloc( 1 << 16 );
+    s_nProfEvents = 0;
+    s_nProfPhases = 0;
+    s_nSatCalls   = 0;
+    s_ProfClkBeg  = Abc_Clock();
+    Abc_ProfEnabled = 1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops recording and writes the trace.]
+
+  Description [The file is in the Chrome trace event format, which can be
+  loaded into chrome://tracing, Perfetto and similar viewers. Returns 0
+  if the profiler is not recording or the file cannot be written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ProfStop()
+{
+    FILE * pFile;
+    int RetValue = 1;
+    if ( !Abc_ProfEnabled )
+        return 0;
+    // close the phases left open
+    while ( s_nProfPhases > 0 )
+        Abc_ProfPhaseEndInt();
+    Abc_ProfEnabled = 0;
+    pFile = fopen( s_pProfFile, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the trace.\n", s_pProfFile );
+        RetValue = 0;
+    }
+    else
+    {
+        fprintf( pFile, "{\"traceEvents\":[\n" );
+        fwrite( Vec_StrArray(s_vProfEvents), 1, (size_t)Vec_StrSize(s_vProfEvents), pFile );
+        fprintf( pFile, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+        fclose( pFile );
+    }
+    Vec_StrFree( s_vProfEvents );
+    ABC_FREE( s_pProfFile );
+    return RetValue;
+}
+const char * Abc_ProfFileName()
+{
+    return Abc_ProfEnabled ? s_pProfFile : NULL;
+}
+int Abc_ProfEventNum()
+{
+    return Abc_ProfEnabled ? s_nProfEvents : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the resources used by the process.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfStamp( Abc_ProfStamp_t * p )
+{
+    p->WallUs    = (word)((double)(Abc_Clock() - s_ProfClkBeg) * 1000000 / CLOCKS_PER_SEC);
+    p->nSatCalls = s_nSatCalls;
+#if defined(_WIN32)
+    p->CpuUs     = (word)((double)clock() * 1000000 / CLOCKS_PER_SEC);
+    p->PeakKb    = 0;
+#else
+    {
+        struct rusage ru;
+        getrusage( RUSAGE_SELF, &ru );
+        p->CpuUs  = (word)ru.ru_utime.tv_sec * 1000000 + (word)ru.ru_utime.tv_usec;
+        p->CpuUs += (word)ru.ru_stime.tv_sec * 1000000 + (word)ru.ru_stime.tv_usec;
+#if defined(__APPLE__)
+        p->PeakKb = (word)ru.ru_maxrss / 1024;
+#else
+        p->PeakKb = (word)ru.ru_maxrss;
+#endif
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one complete event to the trace.]
+
+  Description [The event covers the interval between the two stamps.
+  The optional string pLine (for example, the command line) is added
+  to the arguments of the event as "line". The optional pArgs are the
+  JSON members added to the arguments, for example, "\"nodes\":100".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_ProfPrintJson( Vec_Str_t * vStr, const char * pStr )
+{
+    Vec_StrPush( vStr, '\"' );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            Vec_StrPushTwo( vStr, '\\', *pStr );
+        else if ( *pStr == '\n' )
+            Vec_StrPushTwo( vStr, '\\', 'n' );
+        else if ( *pStr == '\t' )
+            Vec_StrPushTwo( vStr, '\\', 't' );
+        else if ( (unsigned char)*pStr >= 0x20 )
+            Vec_StrPush( vStr, *pStr );
+    }
+    Vec_StrPush( vStr, '\"' );
+}
+void Abc_ProfAddEvent( const char * pName, const char * pCat, Abc_ProfStamp_t * pBeg, Abc_ProfStamp_t * pEnd, const char * pLine, const char * pArgs )
+{
+    Vec_Str_t * vStr = s_vProfEvents;
+    if ( !Abc_ProfEnabled || pEnd->WallUs < pBeg->WallUs )
+        return;
+    if ( s_nProfEvents++ > 0 )
+        Vec_StrPrintStr( vStr, ",\n" );
+    Vec_StrPrintStr( vStr, "{\"name\":" );
+    Abc_ProfPrintJson( vStr, pName );
+    Vec_StrPrintStr( vStr, ",\"cat\":" );
+    Abc_ProfPrintJson( vStr, pCat );
+    Vec_StrPrintF( vStr, ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.0f,\"dur\":%.0f",
+        (double)pBeg->WallUs, (double)(pEnd->WallUs - pBeg->WallUs) );
+    Vec_StrPrintF( vStr, ",\"args\":{\"cpu_ms\":%.3f,\"peak_rss_kb\":%.0f,\"peak_rss_delta_kb\":%.0f,\"sat_calls\":%.0f",
+        (double)(pEnd->CpuUs - pBeg->CpuUs) / 1000, (double)pEnd->PeakKb,
+        (double)(pEnd->PeakKb - pBeg->PeakKb), (double)(pEnd->nSatCalls - pBeg->nSatCalls) );
+    if ( pLine )
+    {
+        Vec_StrPrintStr( vStr, ",\"line\":" );
+        Abc_ProfPrintJson( vStr, pLine );
+    }
+    if ( pArgs && pArgs[0] )
+    {
+        Vec_StrPush( vStr, ',' );
+        Vec_StrPrintStr( vStr, pArgs );
+    }
+    Vec_StrPrintStr( vStr, "}}" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens and closes a phase.]
+
+  Description [Should be called through Abc_ProfPhaseBegin() and
+  Abc_ProfPhaseEnd(), which do nothing when the profiler is off.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfPhaseBeginInt( const char * pName )
+{
+    if ( s_nProfPhases >= ABC_PROF_DEPTH )
+    {
+        s_nProfPhases++;
+        return;
+    }
+    s_pProfPhaseNames[s_nProfPhases] = Abc_UtilStrsav( (char *)pName );
+    Abc_ProfStamp( s_ProfPhaseStamps + s_nProfPhases );
+    s_nProfPhases++;
+}
+void Abc_ProfPhaseEndInt()
+{
+    Abc_ProfStamp_t End;
+    if ( s_nProfPhases == 0 )
+        return;
+    if ( --s_nProfPhases >= ABC_PROF_DEPTH )
+        return;
+    Abc_ProfStamp( &End );
+    Abc_ProfAddEvent( s_pProfPhaseNames[s_nProfPhases], "phase", s_ProfPhaseStamps + s_nProfPhases, &End, NULL, NULL );
+    ABC_FREE( s_pProfPhaseNames[s_nProfPhases] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts one SAT call.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfSatCallInt()
+{
+#if defined(__GNUC__)
+    __atomic_fetch_add( &s_nSatCalls, 1, __ATOMIC_RELAXED );
+#else
+    s_nSatCalls++;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,84 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Built-in profiler.]
+
+  Synopsis    [Recording commands and phases as a Chrome trace.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilProf_h
+#define ABC__misc__util__utilProf_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the resources used by the process at some moment
+typedef struct Abc_ProfStamp_t_ Abc_ProfStamp_t;
+struct Abc_ProfStamp_t_
+{
+    word             WallUs;     // wall time since the start of profiling (microseconds)
+    word             CpuUs;      // user and system time of all threads (microseconds)
+    word             PeakKb;     // peak resident set size (kilobytes)
+    word             nSatCalls;  // the number of SAT calls
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// set when the profiler is recording; checked before doing any other work
+extern int Abc_ProfEnabled;
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilProf.c ===========================================================*/
+extern int                Abc_ProfStart( const char * pFileName );
+extern int                Abc_ProfStop();
+extern const char *       Abc_ProfFileName();
+extern int                Abc_ProfEventNum();
+extern void               Abc_ProfStamp( Abc_ProfStamp_t * p );
+extern void               Abc_ProfAddEvent( const char * pName, const char * pCat, Abc_ProfStamp_t * pBeg, Abc_ProfStamp_t * pEnd, const char * pLine, const char * pArgs );
+extern void               Abc_ProfPhaseBeginInt( const char * pName );
+extern void               Abc_ProfPhaseEndInt();
+extern void               Abc_ProfSatCallInt();
+
+// phases are nested intervals inside a command; they should be
+// started and finished by the thread that is running the command
+static inline void Abc_ProfPhaseBegin( const char * pName ) { if ( Abc_ProfEnabled ) Abc_ProfPhaseBeginInt( pName ); }
+static inline void Abc_ProfPhaseEnd()                       { if ( Abc_ProfEnabled ) Abc_ProfPhaseEndInt();         }
+// called by the SAT solvers at the beginning of each SAT call (thread-safe)
+static inline void Abc_ProfSatCall()                        { if ( Abc_ProfEnabled ) Abc_ProfSatCallInt();          }
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -22,6 +22,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <errno.h>
+#include <time.h>
 
 #ifdef ABC_USE_PTHREADS
 
@@ -42,6 +44,7 @@ using namespace std;
 #endif
 
 #include "misc/vec/vec.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -55,9 +58,17 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    []
-
-  Description []
+  Synopsis    [Persistent thread pool.]
+
+  Description [The pool is shared by the whole process. It is started on 
+  demand and grows when a caller asks for more threads. Each worker has 
+  a deque of tasks: the owner takes the most recent task, while the idle 
+  workers steal the oldest tasks of the others. The idle workers sleep 
+  on a condition variable. A task submitted by a worker goes to its own 
+  deque, and a worker waiting for a task keeps running other tasks, so 
+  that the tasks can submit and wait for other tasks. A task that is 
+  canceled before it starts is skipped, and a running task can check 
+  Util_PoolCanceled() to stop early.]
                
   SideEffects []
 
@@ -67,6 +78,36 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
+struct Util_Task_t_
+{
+    int          Result;
+    int          fCancel;
+};
+
+void Util_PoolStart( int nThreads )                   {}
+void Util_PoolStop()                                  {}
+int  Util_PoolThreadNum()                             { return 0; }
+int  Util_PoolThreadId()                              { return -1; }
+int  Util_PoolCanceled()                              { return 0; }
+int  Util_TaskWait( Util_Task_t * p, int TimeOut )    { return 1; }
+int  Util_TaskIsDone( Util_Task_t * p )               { return 1; }
+int  Util_TaskResult( Util_Task_t * p )               { return p->Result; }
+void Util_TaskCancel( Util_Task_t * p )               { p->fCancel = 1; }
+void Util_TaskFree( Util_Task_t * p )                 { ABC_FREE( p ); }
+Util_Task_t * Util_PoolSubmit( int (*pUserFunc)(void *), void * pData )
+{
+    Util_Task_t * p = ABC_CALLOC( Util_Task_t, 1 );
+    p->Result = pUserFunc( pData );
+    return p;
+}
+int Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks, int TimeOut )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] )
+            return i;
+    return -1;
+}
 void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
 {
     void * pData; int i;
@@ -76,112 +117,558 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
 
 #else // pthreads are used
 
-#define PAR_THR_MAX 100
-typedef struct Util_ThData_t_
+// task states
+#define UTIL_TASK_QUEUED   0
+#define UTIL_TASK_DONE     1
+
+struct Util_Task_t_
 {
-    void *       pUserData;
     int        (*pUserFunc)(void *);
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
-} Util_ThData_t;
+    void *       pUserData;
+    int          Result;         // the value returned by the user function (-1 if canceled)
+    int          Status;         // changed under the pool mutex
+    int          iDeque;         // the deque where the task was queued
+    atomic_bool  fCancel;
+};
 
-void * Util_Thread( void * pArg )
+typedef struct Util_Deque_t_
+{
+    pthread_mutex_t  Mutex;
+    Util_Task_t **   pTasks;     // circular buffer
+    int              nCap;
+    int              iHead;      // the oldest task
+    int              nSize;
+} Util_Deque_t;
+
+typedef struct Util_Worker_t_
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+    int              iThread;
+    Util_Task_t *    pCurrent;   // the task being run
+} Util_Worker_t;
 
-    Util_ThData_t * pThData = (Util_ThData_t *)pArg;
+typedef struct Util_Pool_t_
+{
+    pthread_mutex_t  Mutex;      // protects the counters and the task states
+    pthread_cond_t   CondWork;   // signaled when a task is submitted
+    pthread_cond_t   CondDone;   // broadcast when a task is finished
+    pthread_key_t    Key;        // the worker data of the current thread
+    pthread_t        Threads[UTIL_POOL_THR_MAX];
+    Util_Worker_t    Workers[UTIL_POOL_THR_MAX];
+    Util_Deque_t     Deques[UTIL_POOL_THR_MAX];
+    atomic_int       nThreads;
+    int              nPending;   // the tasks in the deques
+    int              iNext;      // the deque for the next external task
+    int              fStop;
+} Util_Pool_t;
+
+static Util_Pool_t *   s_pPool = NULL;
+static pthread_mutex_t s_PoolMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void Util_DequePush( Util_Deque_t * p, Util_Task_t * pTask )
+{
+    pthread_mutex_lock( &p->Mutex );
+    if ( p->nSize == p->nCap )
+    {
+        int i, nCapNew = Abc_MaxInt( 16, 2 * p->nCap );
+        Util_Task_t ** pTasks = ABC_ALLOC( Util_Task_t *, nCapNew );
+        for ( i = 0; i < p->nSize; i++ )
+            pTasks[i] = p->pTasks[(p->iHead + i) % p->nCap];
+        ABC_FREE( p->pTasks );
+        p->pTasks = pTasks;
+        p->nCap   = nCapNew;
+        p->iHead  = 0;
+    }
+    p->pTasks[(p->iHead + p->nSize++) % p->nCap] = pTask;
+    pthread_mutex_unlock( &p->Mutex );
+}
+static Util_Task_t * Util_DequePop( Util_Deque_t * p, int fSteal )
+{
+    Util_Task_t * pTask = NULL;
+    pthread_mutex_lock( &p->Mutex );
+    if ( p->nSize > 0 && fSteal )
+    {
+        pTask = p->pTasks[p->iHead];
+        p->iHead = (p->iHead + 1) % p->nCap;
+        p->nSize--;
+    }
+    else if ( p->nSize > 0 )
+        pTask = p->pTasks[(p->iHead + --p->nSize) % p->nCap];
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+static int Util_DequeRemove( Util_Deque_t * p, Util_Task_t * pTask )
+{
+    int i, k, fFound = 0;
+    pthread_mutex_lock( &p->Mutex );
+    for ( i = 0; i < p->nSize; i++ )
+        if ( p->pTasks[(p->iHead + i) % p->nCap] == pTask )
+            break;
+    if ( i < p->nSize )
+    {
+        for ( k = i + 1; k < p->nSize; k++ )
+            p->pTasks[(p->iHead + k - 1) % p->nCap] = p->pTasks[(p->iHead + k) % p->nCap];
+        p->nSize--;
+        fFound = 1;
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return fFound;
+}
+static Util_Task_t * Util_PoolGrab( Util_Pool_t * p, int iThread )
+{
+    Util_Task_t * pTask = NULL;
+    int k, nThreads = atomic_load_explicit( &p->nThreads, memory_order_acquire );
+    if ( iThread >= 0 )
+        pTask = Util_DequePop( p->Deques + iThread, 0 );
+    for ( k = 1; !pTask && k <= nThreads; k++ )
+        pTask = Util_DequePop( p->Deques + (Abc_MaxInt(iThread, 0) + k) % nThreads, 1 );
+    if ( pTask )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->nPending--;
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return pTask;
+}
+static void Util_PoolRun( Util_Pool_t * p, Util_Worker_t * pWorker, Util_Task_t * pTask )
+{
+    if ( atomic_load_explicit(&pTask->fCancel, memory_order_acquire) )
+        pTask->Result = -1;
+    else
+    {
+        Util_Task_t * pPrev = pWorker->pCurrent;
+        pWorker->pCurrent = pTask;
+        pTask->Result = pTask->pUserFunc( pTask->pUserData );
+        pWorker->pCurrent = pPrev;
+    }
+    pthread_mutex_lock( &p->Mutex );
+    pTask->Status = UTIL_TASK_DONE;
+    pthread_cond_broadcast( &p->CondDone );
+    pthread_mutex_unlock( &p->Mutex );
+}
+static void * Util_PoolThread( void * pArg )
+{
+    Util_Worker_t * pWorker = (Util_Worker_t *)pArg;
+    Util_Pool_t * p = s_pPool;
+    Util_Task_t * pTask;
+    pthread_setspecific( p->Key, pWorker );
     while ( 1 )
     {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->pUserData == NULL )
+        if ( (pTask = Util_PoolGrab(p, pWorker->iThread)) )
+        {
+            Util_PoolRun( p, pWorker, pTask );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nPending == 0 && !p->fStop )
+            pthread_cond_wait( &p->CondWork, &p->Mutex );
+        if ( p->nPending == 0 && p->fStop )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            pthread_mutex_unlock( &p->Mutex );
+            break;
         }
-        pThData->pUserFunc( pThData->pUserData );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+        pthread_mutex_unlock( &p->Mutex );
     }
-    assert( 0 );
     return NULL;
 }
+static void Util_PoolDeadline( struct timespec * pTime, int TimeOut )
+{
+    clock_gettime( CLOCK_REALTIME, pTime );
+    pTime->tv_sec  += TimeOut / 1000;
+    pTime->tv_nsec += (long)(TimeOut % 1000) * 1000000;
+    if ( pTime->tv_nsec >= 1000000000 )
+        pTime->tv_sec++, pTime->tv_nsec -= 1000000000;
+}
 
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Starts the pool with at least the given number of threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolStart( int nThreads )
 {
-    //abctime clkStart = Abc_Clock();
-    Util_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack = NULL;
+    Util_Pool_t * p;
     int i, status;
-    fflush( stdout );
-    if ( nProcs <= 2 ) {
-        void * pData; int i;
-        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-            pUserFunc( pData );
+    nThreads = Abc_MinInt( nThreads, UTIL_POOL_THR_MAX );
+    // the tasks use the vector kernels selected before the threads start
+    Abc_SimdInit();
+    pthread_mutex_lock( &s_PoolMutex );
+    if ( s_pPool == NULL )
+    {
+        p = ABC_CALLOC( Util_Pool_t, 1 );
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->CondWork, NULL );
+        pthread_cond_init( &p->CondDone, NULL );
+        pthread_key_create( &p->Key, NULL );
+        for ( i = 0; i < UTIL_POOL_THR_MAX; i++ )
+            pthread_mutex_init( &p->Deques[i].Mutex, NULL );
+        atomic_store_explicit( &p->nThreads, 0, memory_order_release );
+        s_pPool = p;
+    }
+    p = s_pPool;
+    for ( i = atomic_load_explicit(&p->nThreads, memory_order_acquire); i < nThreads; i++ )
+    {
+        p->Workers[i].iThread  = i;
+        p->Workers[i].pCurrent = NULL;
+        status = pthread_create( p->Threads + i, NULL, Util_PoolThread, (void *)(p->Workers + i) );  assert( status == 0 );
+        atomic_store_explicit( &p->nThreads, i + 1, memory_order_release );
+    }
+    pthread_mutex_unlock( &s_PoolMutex );
+}
+void Util_PoolStop()
+{
+    Util_Pool_t * p;
+    int i, nThreads;
+    pthread_mutex_lock( &s_PoolMutex );
+    if ( (p = s_pPool) == NULL )
+    {
+        pthread_mutex_unlock( &s_PoolMutex );
         return;
     }
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    nThreads = atomic_load_explicit( &p->nThreads, memory_order_acquire );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( p->Threads[i], NULL );
+    for ( i = 0; i < UTIL_POOL_THR_MAX; i++ )
     {
-        ThData[i].pUserData = NULL;
-        ThData[i].pUserFunc = pUserFunc;
-        ThData[i].iThread   = i;
-        ThData[i].nTimeOut  = TimeOut;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Util_Thread, (void *)(ThData + i) );  assert( status == 0 );
+        assert( p->Deques[i].nSize == 0 );
+        ABC_FREE( p->Deques[i].pTasks );
+        pthread_mutex_destroy( &p->Deques[i].Mutex );
     }
+    pthread_key_delete( p->Key );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_cond_destroy( &p->CondWork );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+    s_pPool = NULL;
+    pthread_mutex_unlock( &s_PoolMutex );
+}
+int Util_PoolThreadNum()
+{
+    return s_pPool ? atomic_load_explicit( &s_pPool->nThreads, memory_order_acquire ) : 0;
+}
+int Util_PoolThreadId()
+{
+    Util_Worker_t * pWorker = s_pPool ? (Util_Worker_t *)pthread_getspecific( s_pPool->Key ) : NULL;
+    return pWorker ? pWorker->iThread : -1;
+}
+int Util_PoolCanceled()
+{
+    Util_Worker_t * pWorker = s_pPool ? (Util_Worker_t *)pthread_getspecific( s_pPool->Key ) : NULL;
+    return pWorker && pWorker->pCurrent && atomic_load_explicit( &pWorker->pCurrent->fCancel, memory_order_acquire );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits a task to the pool.]
+
+  Description [Returns the handle used to wait for the task, to cancel it, 
+  and to read its result. The handle is freed by Util_TaskFree().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Task_t * Util_PoolSubmit( int (*pUserFunc)(void *), void * pData )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    Util_Worker_t * pWorker;
+    Util_Pool_t * p;
+    int iDeque;
+    if ( s_pPool == NULL )
+        Util_PoolStart( 1 );
+    p = s_pPool;
+    pTask->pUserFunc = pUserFunc;
+    pTask->pUserData = pData;
+    pTask->Result    = -1;
+    pTask->Status    = UTIL_TASK_QUEUED;
+    atomic_store_explicit( &pTask->fCancel, false, memory_order_release );
+    pWorker = (Util_Worker_t *)pthread_getspecific( p->Key );
+    pthread_mutex_lock( &p->Mutex );
+    iDeque = pWorker ? pWorker->iThread : p->iNext++ % atomic_load_explicit( &p->nThreads, memory_order_acquire );
+    pthread_mutex_unlock( &p->Mutex );
+    pTask->iDeque = iDeque;
+    Util_DequePush( p->Deques + iDeque, pTask );
+    pthread_mutex_lock( &p->Mutex );
+    p->nPending++;
+    pthread_cond_signal( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+
+/**Function*************************************************************
 
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+  Synopsis    [Waits for the tasks.]
+
+  Description [The timeout is in milliseconds (0 means no limit). 
+  Util_TaskWait() returns 1 if the task is finished. Util_TaskWaitAny() 
+  returns the index of a finished task among the non-NULL ones, or -1 
+  if the time is out. A worker that waits without a timeout runs the 
+  awaited tasks that are still queued (their own waits do the same for 
+  their subtasks). It never runs unrelated tasks, which could take much 
+  longer than the awaited ones.]
+               
+  SideEffects []
 
-    // look at the threads
-    vStack = Vec_PtrDup( (Vec_Ptr_t *)vData );
-    while ( Vec_PtrSize(vStack) > 0 )
+  SeeAlso     []
+
+***********************************************************************/
+static int Util_TaskFindDone( Util_Task_t ** ppTasks, int nTasks )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] && ppTasks[i]->Status == UTIL_TASK_DONE )
+            return i;
+    return -1;
+}
+static Util_Task_t * Util_TaskTakeQueued( Util_Pool_t * p, Util_Task_t ** ppTasks, int nTasks )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] && Util_DequeRemove(p->Deques + ppTasks[i]->iDeque, ppTasks[i]) )
+        {
+            pthread_mutex_lock( &p->Mutex );
+            p->nPending--;
+            pthread_mutex_unlock( &p->Mutex );
+            return ppTasks[i];
+        }
+    return NULL;
+}
+int Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks, int TimeOut )
+{
+    Util_Pool_t * p = s_pPool;
+    Util_Worker_t * pWorker = (Util_Worker_t *)pthread_getspecific( p->Key );
+    struct timespec Deadline;
+    int i, iTask = -1, status = 0;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] )
+            break;
+    if ( i == nTasks )
+        return -1;
+    if ( TimeOut > 0 )
+        Util_PoolDeadline( &Deadline, TimeOut );
+    pthread_mutex_lock( &p->Mutex );
+    while ( (iTask = Util_TaskFindDone(ppTasks, nTasks)) == -1 && status != ETIMEDOUT )
     {
-        for ( i = 0; i < nProcs; i++ )
+        if ( pWorker && TimeOut == 0 )
         {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
+            // an awaited task cannot be queued again after it is taken
+            Util_Task_t * pAwaited;
+            pthread_mutex_unlock( &p->Mutex );
+            pAwaited = Util_TaskTakeQueued( p, ppTasks, nTasks );
+            if ( pAwaited )
+                Util_PoolRun( p, pWorker, pAwaited );
+            pthread_mutex_lock( &p->Mutex );
+            if ( pAwaited )
                 continue;
-            ThData[i].pUserData = Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-            break;
+            if ( (iTask = Util_TaskFindDone(ppTasks, nTasks)) >= 0 )
+                break;
         }
+        if ( TimeOut > 0 )
+            status = pthread_cond_timedwait( &p->CondDone, &p->Mutex, &Deadline );
+        else
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
     }
-    Vec_PtrFree( vStack );    
-    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
+    pthread_mutex_unlock( &p->Mutex );
+    return iTask;
+}
+int Util_TaskWait( Util_Task_t * pTask, int TimeOut )
+{
+    return Util_TaskWaitAny( &pTask, 1, TimeOut ) == 0;
+}
+int Util_TaskIsDone( Util_Task_t * pTask )
+{
+    int fDone;
+    pthread_mutex_lock( &s_pPool->Mutex );
+    fDone = (pTask->Status == UTIL_TASK_DONE);
+    pthread_mutex_unlock( &s_pPool->Mutex );
+    return fDone;
+}
+int Util_TaskResult( Util_Task_t * pTask )
+{
+    assert( Util_TaskIsDone(pTask) );
+    return pTask->Result;
+}
+void Util_TaskCancel( Util_Task_t * pTask )
+{
+    atomic_store_explicit( &pTask->fCancel, true, memory_order_release );
+}
+void Util_TaskFree( Util_Task_t * pTask )
+{
+    if ( !Util_TaskIsDone(pTask) )
     {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
+        Util_TaskCancel( pTask );
+        Util_TaskWait( pTask, 0 );
     }
+    ABC_FREE( pTask );
+}
 
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].pUserData = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
-    }
+/**Function*************************************************************
+
+  Synopsis    [Runs the user function for each entry of the array.]
+
+  Description [Uses at most nProcs-1 threads (the caller is counted as 
+  the manager thread, as before, but it now processes the entries too).
+  The entries are handed out one at a time by an atomic counter.]
+               
+  SideEffects []
+
+  SeeAlso     []
 
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
+***********************************************************************/
+typedef struct Util_Batch_t_
+{
+    int        (*pUserFunc)(void *);
+    Vec_Ptr_t *  vData;
+    atomic_int   iNext;
+} Util_Batch_t;
 
-    //if ( fVerbose )
-    //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
+static int Util_BatchRun( void * pArg )
+{
+    Util_Batch_t * pBatch = (Util_Batch_t *)pArg;
+    int i;
+    while ( (i = atomic_fetch_add(&pBatch->iNext, 1)) < Vec_PtrSize(pBatch->vData) )
+        pBatch->pUserFunc( Vec_PtrEntry(pBatch->vData, i) );
+    return 1;
+}
+void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+{
+    Util_Task_t * pTasks[UTIL_POOL_THR_MAX];
+    Util_Batch_t Batch;
+    int i, nTasks;
+    fflush( stdout );
+    if ( nProcs <= 2 ) {
+        void * pData; int i;
+        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+            pUserFunc( pData );
+        return;
+    }
+    // subtract manager thread
+    nProcs--;
+    assert( nProcs >= 1 && nProcs <= UTIL_POOL_THR_MAX );
+    Batch.pUserFunc = pUserFunc;
+    Batch.vData     = (Vec_Ptr_t *)vData;
+    atomic_store_explicit( &Batch.iNext, 0, memory_order_release );
+    nTasks = Abc_MinInt( nProcs - 1, Vec_PtrSize(Batch.vData) - 1 );
+    if ( nTasks > 0 )
+        Util_PoolStart( nTasks );
+    for ( i = 0; i < nTasks; i++ )
+        pTasks[i] = Util_PoolSubmit( Util_BatchRun, &Batch );
+    Util_BatchRun( &Batch );
+    // the tasks that did not start have nothing to do
+    for ( i = 0; i < nTasks; i++ )
+        Util_TaskCancel( pTasks[i] );
+    for ( i = 0; i < nTasks; i++ )
+        Util_TaskFree( pTasks[i] );
 }
 
 #endif // pthreads are used
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of the thread pool.]
+
+  Description [Runs nTasks tasks, each performing nWork steps of 
+  arithmetic: one by one (submit and wait), all at once (futures), 
+  and as batches of Util_ProcessThreads() calls.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Util_BenchTask_t_
+{
+    int          nWork;
+    unsigned     Value;
+} Util_BenchTask_t;
+
+static int Util_BenchRun( void * pArg )
+{
+    Util_BenchTask_t * p = (Util_BenchTask_t *)pArg;
+    unsigned Value = p->Value;
+    int i;
+    for ( i = 0; i < p->nWork; i++ )
+        Value = 1664525 * Value + 1013904223;
+    p->Value = Value;
+    return 1;
+}
+static void Util_BenchPrint( char * pName, int nTasks, abctime clk )
+{
+    double Secs = 1.0 * Abc_MaxInt( 1, (int)clk ) / CLOCKS_PER_SEC;
+    printf( "%-24s : tasks = %8d   tasks/sec = %12.0f   usec/task = %9.3f   ", pName, nTasks, nTasks / Secs, 1000000.0 * Secs / nTasks );
+    Abc_PrintTime( 1, "Time", clk );
+}
+void Util_PoolBench( int nTasks, int nWork, int nProcs, int fVerbose )
+{
+    Util_BenchTask_t * pData = ABC_CALLOC( Util_BenchTask_t, nTasks );
+    Util_Task_t ** ppTasks = ABC_ALLOC( Util_Task_t *, nTasks );
+    Vec_Ptr_t * vData = Vec_PtrAlloc( nTasks );
+    int i, nBatch = Abc_MaxInt( 1, nProcs - 1 );
+    abctime clk;
+    for ( i = 0; i < nTasks; i++ )
+    {
+        pData[i].nWork = nWork;
+        pData[i].Value = i;
+    }
+    Util_PoolStart( Abc_MaxInt(1, nProcs - 1) );
+    printf( "Running %d tasks of %d steps each using %d threads (pool size = %d).\n", nTasks, nWork, nProcs, Util_PoolThreadNum() );
+    // each task is submitted and waited for
+    clk = Abc_Clock();
+    for ( i = 0; i < nTasks; i++ )
+    {
+        Util_Task_t * pTask = Util_PoolSubmit( Util_BenchRun, pData + i );
+        Util_TaskWait( pTask, 0 );
+        Util_TaskFree( pTask );
+    }
+    Util_BenchPrint( "Submit and wait", nTasks, Abc_Clock() - clk );
+    // all tasks are submitted and then waited for
+    clk = Abc_Clock();
+    for ( i = 0; i < nTasks; i++ )
+        ppTasks[i] = Util_PoolSubmit( Util_BenchRun, pData + i );
+    for ( i = 0; i < nTasks; i++ )
+    {
+        Util_TaskWait( ppTasks[i], 0 );
+        Util_TaskFree( ppTasks[i] );
+    }
+    Util_BenchPrint( "Submit all, wait all", nTasks, Abc_Clock() - clk );
+    // the tasks are processed by Util_ProcessThreads() in groups of nProcs-1
+    clk = Abc_Clock();
+    for ( i = 0; i < nTasks; i++ )
+    {
+        Vec_PtrPush( vData, pData + i );
+        if ( Vec_PtrSize(vData) < nBatch && i < nTasks - 1 )
+            continue;
+        Util_ProcessThreads( Util_BenchRun, vData, nProcs, 0, 0 );
+        Vec_PtrClear( vData );
+    }
+    Util_BenchPrint( "Util_ProcessThreads()", nTasks, Abc_Clock() - clk );
+    // all tasks are processed by one call to Util_ProcessThreads()
+    clk = Abc_Clock();
+    for ( i = 0; i < nTasks; i++ )
+        Vec_PtrPush( vData, pData + i );
+    Util_ProcessThreads( Util_BenchRun, vData, nProcs, 0, 0 );
+    Util_BenchPrint( "Util_ProcessThreads() x1", nTasks, Abc_Clock() - clk );
+    if ( fVerbose )
+    {
+        unsigned Sum = 0;
+        for ( i = 0; i < nTasks; i++ )
+            Sum ^= pData[i].Value;
+        printf( "Checksum = %08x.\n", Sum );
+    }
+    Vec_PtrFree( vData );
+    ABC_FREE( ppTasks );
+    ABC_FREE( pData );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
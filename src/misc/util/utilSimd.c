@@ -0,0 +1,1090 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized bit-parallel kernels.]
+
+  Synopsis    [Runtime-dispatched SSE2/AVX2/AVX-512 kernels with a portable fallback.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "misc/util/abc_global.h"
+#include "utilSimd.h"
+#include "utilTruth.h"
+
+// the vector kernels are compiled for x86 with GCC/Clang, which can target
+// instruction sets beyond the compilation flags on a per-function basis
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_USE_NO_SIMD)
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static void Abc_SimdTtFlipWord( word * p, int nWords, int iVar );
+static void Abc_SimdTtSwapAdjacentWord( word * p, int nWords, int iVar );
+static void Abc_SimdTtSwapVarsWord( word * p, int nWords, int iVar, int jVar );
+static void Abc_SimdTtCofactorWord( word * pOut, word * pIn, int nWords, int iVar, int fCof1 );
+
+static Abc_SimdFuncs_t   s_SimdFuncs[4] = { { Abc_SimdCopyWord, Abc_SimdAndWord, Abc_SimdXorWord, Abc_SimdMuxWord,
+                             Abc_SimdTtFlipWord, Abc_SimdTtSwapAdjacentWord, Abc_SimdTtSwapVarsWord, Abc_SimdTtCofactorWord } };
+static int               s_SimdLevel = ABC_SIMD_NONE;
+
+// the kernels of the current level (the portable ones until Abc_SimdInit() is called)
+Abc_SimdFuncs_t *        Abc_SimdFuncsCur = s_SimdFuncs;
+
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t    s_SimdOnce = PTHREAD_ONCE_INIT;
+#else
+static int               s_SimdOnce = 0;
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Portable truth table kernels.]
+
+  Description [The truth tables have nWords >= 2 words, which is a power
+  of 2. The vector kernels fall back on these when the blocks are smaller
+  than one vector.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdTtFlipWord( word * p, int nWords, int iVar )
+{
+    int w, i, Step;
+    if ( iVar <= 5 )
+    {
+        int Shift = 1 << iVar;
+        for ( w = 0; w < nWords; w++ )
+            p[w] = ((p[w] << Shift) & s_Truths6[iVar]) | ((p[w] & s_Truths6[iVar]) >> Shift);
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i++ )
+            ABC_SWAP( word, p[w+i], p[w+Step+i] );
+}
+static void Abc_SimdTtSwapAdjacentWord( word * p, int nWords, int iVar )
+{
+    int w, i, Step;
+    if ( iVar < 5 )
+    {
+        int Shift = 1 << iVar;
+        for ( w = 0; w < nWords; w++ )
+            p[w] = (p[w] & s_PMasks[iVar][0]) | ((p[w] & s_PMasks[iVar][1]) << Shift) | ((p[w] & s_PMasks[iVar][2]) >> Shift);
+        return;
+    }
+    if ( iVar == 5 )
+    {
+        unsigned * pU = (unsigned *)p;
+        for ( w = 0; w < 2*nWords; w += 4 )
+            ABC_SWAP( unsigned, pU[w+1], pU[w+2] );
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    for ( w = 0; w < nWords; w += 4*Step )
+        for ( i = 0; i < Step; i++ )
+            ABC_SWAP( word, p[w+Step+i], p[w+2*Step+i] );
+}
+static void Abc_SimdTtSwapVarsWord( word * p, int nWords, int iVar, int jVar )
+{
+    int w, i, j;
+    if ( jVar <= 5 )
+    {
+        word * pMasks = s_PPMasks[iVar][jVar];
+        int Shift = (1 << jVar) - (1 << iVar);
+        for ( w = 0; w < nWords; w++ )
+            p[w] = (p[w] & pMasks[0]) | ((p[w] & pMasks[1]) << Shift) | ((p[w] & pMasks[2]) >> Shift);
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        int jStep = 1 << (jVar - 6), Shift = 1 << iVar;
+        for ( w = 0; w < nWords; w += 2*jStep )
+            for ( j = w; j < w + jStep; j++ )
+            {
+                word Low2High = (p[j] & s_Truths6[iVar]) >> Shift;
+                word High2Low = (p[j+jStep] << Shift) & s_Truths6[iVar];
+                p[j]       = (p[j] & ~s_Truths6[iVar]) | High2Low;
+                p[j+jStep] = (p[j+jStep] & s_Truths6[iVar]) | Low2High;
+            }
+        return;
+    }
+    {
+        int iStep = 1 << (iVar - 6), jStep = 1 << (jVar - 6);
+        for ( w = 0; w < nWords; w += 2*jStep )
+            for ( i = 0; i < jStep; i += 2*iStep )
+                for ( j = 0; j < iStep; j++ )
+                    ABC_SWAP( word, p[w+iStep+i+j], p[w+jStep+i+j] );
+    }
+}
+static void Abc_SimdTtCofactorWord( word * pOut, word * pIn, int nWords, int iVar, int fCof1 )
+{
+    int w, i, Step;
+    if ( iVar <= 5 )
+    {
+        int Shift = 1 << iVar;
+        if ( fCof1 )
+            for ( w = 0; w < nWords; w++ )
+                pOut[w] = (pIn[w] & s_Truths6[iVar]) | ((pIn[w] & s_Truths6[iVar]) >> Shift);
+        else
+            for ( w = 0; w < nWords; w++ )
+                pOut[w] = ((pIn[w] & s_Truths6Neg[iVar]) << Shift) | (pIn[w] & s_Truths6Neg[iVar]);
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i++ )
+        {
+            word Entry = pIn[w + (fCof1 ? Step : 0) + i];
+            pOut[w+i] = pOut[w+Step+i] = Entry;
+        }
+}
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [SSE2 kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("sse2")))
+static void Abc_SimdCopySse2( word * pOut, word * pIn0, int fCompl0, int nWords )
+{
+    __m128i M0 = _mm_set1_epi64x( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_xor_si128(_mm_loadu_si128((__m128i *)(pIn0 + w)), M0) );
+    Abc_SimdCopyWord( pOut + w, pIn0 + w, fCompl0, nWords - w );
+}
+__attribute__((target("sse2")))
+static void Abc_SimdAndSse2( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords )
+{
+    __m128i M0 = _mm_set1_epi64x( fCompl0 ? -1 : 0 );
+    __m128i M1 = _mm_set1_epi64x( fCompl1 ? -1 : 0 ); int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i a = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pIn0 + w)), M0 );
+        __m128i b = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pIn1 + w)), M1 );
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_and_si128(a, b) );
+    }
+    Abc_SimdAndWord( pOut + w, pIn0 + w, fCompl0, pIn1 + w, fCompl1, nWords - w );
+}
+__attribute__((target("sse2")))
+static void Abc_SimdXorSse2( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m128i M = _mm_set1_epi64x( fCompl ? -1 : 0 ); int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i a = _mm_loadu_si128( (__m128i *)(pIn0 + w) );
+        __m128i b = _mm_loadu_si128( (__m128i *)(pIn1 + w) );
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_xor_si128(_mm_xor_si128(a, b), M) );
+    }
+    Abc_SimdXorWord( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("sse2")))
+static void Abc_SimdMuxSse2( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords )
+{
+    __m128i MC = _mm_set1_epi64x( fComplC ? -1 : 0 );
+    __m128i M1 = _mm_set1_epi64x( fCompl1 ? -1 : 0 );
+    __m128i M0 = _mm_set1_epi64x( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i c = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pInC + w)), MC );
+        __m128i a = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pIn1 + w)), M1 );
+        __m128i b = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pIn0 + w)), M0 );
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_xor_si128(b, _mm_and_si128(c, _mm_xor_si128(a, b))) );
+    }
+    Abc_SimdMuxWord( pOut + w, pInC + w, fComplC, pIn1 + w, fCompl1, pIn0 + w, fCompl0, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdCopyAvx2( word * pOut, word * pIn0, int fCompl0, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pIn0 + w)), M0) );
+    Abc_SimdCopyWord( pOut + w, pIn0 + w, fCompl0, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdAndAvx2( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 );
+    __m256i M1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 ); int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), M0 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), M1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(a, b) );
+    }
+    Abc_SimdAndWord( pOut + w, pIn0 + w, fCompl0, pIn1 + w, fCompl1, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m256i M = _mm256_set1_epi64x( fCompl ? -1 : 0 ); int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(a, b), M) );
+    }
+    Abc_SimdXorWord( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdMuxAvx2( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords )
+{
+    __m256i MC = _mm256_set1_epi64x( fComplC ? -1 : 0 );
+    __m256i M1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    __m256i M0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i c = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pInC + w)), MC );
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), M1 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), M0 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(b, _mm256_and_si256(c, _mm256_xor_si256(a, b))) );
+    }
+    Abc_SimdMuxWord( pOut + w, pInC + w, fComplC, pIn1 + w, fCompl1, pIn0 + w, fCompl0, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdCopyAvx512( word * pOut, word * pIn0, int fCompl0, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_loadu_si512((void *)(pIn0 + w)), M0) );
+    Abc_SimdCopyAvx2( pOut + w, pIn0 + w, fCompl0, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdAndAvx512( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 );
+    __m512i M1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 ); int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), M0 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), M1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(a, b) );
+    }
+    Abc_SimdAndAvx2( pOut + w, pIn0 + w, fCompl0, pIn1 + w, fCompl1, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m512i M = _mm512_set1_epi64( fCompl ? -1 : 0 ); int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_xor_si512(a, b), M) );
+    }
+    Abc_SimdXorAvx2( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdMuxAvx512( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords )
+{
+    __m512i MC = _mm512_set1_epi64( fComplC ? -1 : 0 );
+    __m512i M1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    __m512i M0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 ); int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i c = _mm512_xor_si512( _mm512_loadu_si512((void *)(pInC + w)), MC );
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), M1 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), M0 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(b, _mm512_and_si512(c, _mm512_xor_si512(a, b))) );
+    }
+    Abc_SimdMuxAvx2( pOut + w, pInC + w, fComplC, pIn1 + w, fCompl1, pIn0 + w, fCompl0, nWords - w );
+}
+
+// unaligned loads and stores
+#define ABC_LD128(p)     _mm_loadu_si128( (__m128i *)(p) )
+#define ABC_ST128(p, a)  _mm_storeu_si128( (__m128i *)(p), a )
+#define ABC_LD256(p)     _mm256_loadu_si256( (__m256i *)(p) )
+#define ABC_ST256(p, a)  _mm256_storeu_si256( (__m256i *)(p), a )
+#define ABC_LD512(p)     _mm512_loadu_si512( (void *)(p) )
+#define ABC_ST512(p, a)  _mm512_storeu_si512( (void *)(p), a )
+
+/**Function*************************************************************
+
+  Synopsis    [SSE2 truth table kernels.]
+
+  Description [The variables inside a word are handled by shifts within
+  the 64-bit lanes. The variables above 5 move the blocks of 2^(iVar-6)
+  words; the blocks of one word are handled by shuffles/unpacks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("sse2")))
+static void Abc_SimdTtFlipSse2( word * p, int nWords, int iVar )
+{
+    int w, i, Step;
+    if ( iVar <= 5 )
+    {
+        __m128i M = _mm_set1_epi64x( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 2 )
+        {
+            __m128i a = ABC_LD128( p + w );
+            ABC_ST128( p + w, _mm_or_si128(_mm_and_si128(_mm_sll_epi64(a, S), M), _mm_srl_epi64(_mm_and_si128(a, M), S)) );
+        }
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    if ( Step == 1 )
+    {
+        for ( w = 0; w < nWords; w += 2 )
+            ABC_ST128( p + w, _mm_shuffle_epi32(ABC_LD128(p + w), 0x4E) );
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 2 )
+        {
+            __m128i a = ABC_LD128( p + w + i );
+            ABC_ST128( p + w + i, ABC_LD128(p + w + Step + i) );
+            ABC_ST128( p + w + Step + i, a );
+        }
+}
+__attribute__((target("sse2")))
+static void Abc_SimdTtSwapAdjacentSse2( word * p, int nWords, int iVar )
+{
+    int w, i, Step;
+    if ( iVar < 5 )
+    {
+        __m128i M0 = _mm_set1_epi64x( (long long)s_PMasks[iVar][0] );
+        __m128i M1 = _mm_set1_epi64x( (long long)s_PMasks[iVar][1] );
+        __m128i M2 = _mm_set1_epi64x( (long long)s_PMasks[iVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 2 )
+        {
+            __m128i a = ABC_LD128( p + w );
+            ABC_ST128( p + w, _mm_or_si128(_mm_and_si128(a, M0), _mm_or_si128(_mm_sll_epi64(_mm_and_si128(a, M1), S), _mm_srl_epi64(_mm_and_si128(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar == 5 )
+    {
+        for ( w = 0; w < nWords; w += 2 )
+            ABC_ST128( p + w, _mm_shuffle_epi32(ABC_LD128(p + w), 0xD8) );
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    if ( Step == 1 )
+    {
+        for ( w = 0; w < nWords; w += 4 )
+        {
+            __m128i a = ABC_LD128( p + w );
+            __m128i b = ABC_LD128( p + w + 2 );
+            ABC_ST128( p + w,     _mm_unpacklo_epi64(a, b) );
+            ABC_ST128( p + w + 2, _mm_unpackhi_epi64(a, b) );
+        }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 4*Step )
+        for ( i = 0; i < Step; i += 2 )
+        {
+            __m128i a = ABC_LD128( p + w + Step + i );
+            ABC_ST128( p + w + Step + i, ABC_LD128(p + w + 2*Step + i) );
+            ABC_ST128( p + w + 2*Step + i, a );
+        }
+}
+__attribute__((target("sse2")))
+static void Abc_SimdTtSwapVarsSse2( word * p, int nWords, int iVar, int jVar )
+{
+    int w, i, j;
+    if ( jVar <= 5 )
+    {
+        __m128i M0 = _mm_set1_epi64x( (long long)s_PPMasks[iVar][jVar][0] );
+        __m128i M1 = _mm_set1_epi64x( (long long)s_PPMasks[iVar][jVar][1] );
+        __m128i M2 = _mm_set1_epi64x( (long long)s_PPMasks[iVar][jVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( (1 << jVar) - (1 << iVar) );
+        for ( w = 0; w < nWords; w += 2 )
+        {
+            __m128i a = ABC_LD128( p + w );
+            ABC_ST128( p + w, _mm_or_si128(_mm_and_si128(a, M0), _mm_or_si128(_mm_sll_epi64(_mm_and_si128(a, M1), S), _mm_srl_epi64(_mm_and_si128(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m128i T = _mm_set1_epi64x( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        int jStep = 1 << (jVar - 6);
+        if ( jStep == 1 && nWords == 2 )
+        {
+            Abc_SimdTtSwapVarsWord( p, nWords, iVar, jVar );
+            return;
+        }
+        for ( w = 0; w < nWords; w += jStep == 1 ? 4 : 2*jStep )
+            for ( j = 0; j < jStep; j += 2 )
+            {
+                // collect the words with jVar = 0 and jVar = 1 into two vectors
+                __m128i a  = ABC_LD128( p + w + j );
+                __m128i b  = ABC_LD128( p + w + j + (jStep == 1 ? 2 : jStep) );
+                __m128i Lo = jStep == 1 ? _mm_unpacklo_epi64(a, b) : a;
+                __m128i Hi = jStep == 1 ? _mm_unpackhi_epi64(a, b) : b;
+                __m128i L2H = _mm_srl_epi64( _mm_and_si128(Lo, T), S );
+                __m128i H2L = _mm_and_si128( _mm_sll_epi64(Hi, S), T );
+                Lo = _mm_or_si128( _mm_andnot_si128(T, Lo), H2L );
+                Hi = _mm_or_si128( _mm_and_si128(Hi, T), L2H );
+                ABC_ST128( p + w + j, jStep == 1 ? _mm_unpacklo_epi64(Lo, Hi) : Lo );
+                ABC_ST128( p + w + j + (jStep == 1 ? 2 : jStep), jStep == 1 ? _mm_unpackhi_epi64(Lo, Hi) : Hi );
+            }
+        return;
+    }
+    {
+        int iStep = 1 << (iVar - 6), jStep = 1 << (jVar - 6);
+        for ( w = 0; w < nWords; w += 2*jStep )
+            for ( i = 0; i < jStep; i += 2*iStep )
+            {
+                if ( iStep == 1 )
+                {
+                    __m128i a = ABC_LD128( p + w + i );
+                    __m128i b = ABC_LD128( p + w + jStep + i );
+                    ABC_ST128( p + w + i,         _mm_unpacklo_epi64(a, b) );
+                    ABC_ST128( p + w + jStep + i, _mm_unpackhi_epi64(a, b) );
+                    continue;
+                }
+                for ( j = 0; j < iStep; j += 2 )
+                {
+                    __m128i a = ABC_LD128( p + w + iStep + i + j );
+                    ABC_ST128( p + w + iStep + i + j, ABC_LD128(p + w + jStep + i + j) );
+                    ABC_ST128( p + w + jStep + i + j, a );
+                }
+            }
+    }
+}
+__attribute__((target("sse2")))
+static void Abc_SimdTtCofactorSse2( word * pOut, word * pIn, int nWords, int iVar, int fCof1 )
+{
+    int w, i, Step;
+    if ( iVar <= 5 )
+    {
+        __m128i M = _mm_set1_epi64x( (long long)(fCof1 ? s_Truths6[iVar] : s_Truths6Neg[iVar]) );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 2 )
+        {
+            __m128i a = _mm_and_si128( ABC_LD128(pIn + w), M );
+            ABC_ST128( pOut + w, _mm_or_si128(a, fCof1 ? _mm_srl_epi64(a, S) : _mm_sll_epi64(a, S)) );
+        }
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    if ( Step == 1 )
+    {
+        for ( w = 0; w < nWords; w += 2 )
+        {
+            __m128i a = ABC_LD128( pIn + w );
+            ABC_ST128( pOut + w, fCof1 ? _mm_unpackhi_epi64(a, a) : _mm_unpacklo_epi64(a, a) );
+        }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 2 )
+        {
+            __m128i a = ABC_LD128( pIn + w + (fCof1 ? Step : 0) + i );
+            ABC_ST128( pOut + w + i, a );
+            ABC_ST128( pOut + w + Step + i, a );
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 truth table kernels.]
+
+  Description [The blocks smaller than 4 words are handled by SSE2,
+  except for flipping, which uses cross-lane permutations.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdTtFlipAvx2( word * p, int nWords, int iVar )
+{
+    int w, i, Step;
+    if ( nWords < 4 )
+    {
+        Abc_SimdTtFlipSse2( p, nWords, iVar );
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m256i M = _mm256_set1_epi64x( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 4 )
+        {
+            __m256i a = ABC_LD256( p + w );
+            ABC_ST256( p + w, _mm256_or_si256(_mm256_and_si256(_mm256_sll_epi64(a, S), M), _mm256_srl_epi64(_mm256_and_si256(a, M), S)) );
+        }
+        return;
+    }
+    Step = 1 << (iVar - 6);
+    if ( Step == 1 )
+    {
+        for ( w = 0; w < nWords; w += 4 )
+            ABC_ST256( p + w, _mm256_permute4x64_epi64(ABC_LD256(p + w), 0xB1) );
+        return;
+    }
+    if ( Step == 2 )
+    {
+        for ( w = 0; w < nWords; w += 4 )
+            ABC_ST256( p + w, _mm256_permute4x64_epi64(ABC_LD256(p + w), 0x4E) );
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 4 )
+        {
+            __m256i a = ABC_LD256( p + w + i );
+            ABC_ST256( p + w + i, ABC_LD256(p + w + Step + i) );
+            ABC_ST256( p + w + Step + i, a );
+        }
+}
+__attribute__((target("avx2")))
+static void Abc_SimdTtSwapAdjacentAvx2( word * p, int nWords, int iVar )
+{
+    int w, i, Step = iVar > 5 ? 1 << (iVar - 6) : 0;
+    if ( nWords < 4 || (iVar > 5 && Step < 4) )
+    {
+        Abc_SimdTtSwapAdjacentSse2( p, nWords, iVar );
+        return;
+    }
+    if ( iVar < 5 )
+    {
+        __m256i M0 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][0] );
+        __m256i M1 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][1] );
+        __m256i M2 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 4 )
+        {
+            __m256i a = ABC_LD256( p + w );
+            ABC_ST256( p + w, _mm256_or_si256(_mm256_and_si256(a, M0), _mm256_or_si256(_mm256_sll_epi64(_mm256_and_si256(a, M1), S), _mm256_srl_epi64(_mm256_and_si256(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar == 5 )
+    {
+        for ( w = 0; w < nWords; w += 4 )
+            ABC_ST256( p + w, _mm256_shuffle_epi32(ABC_LD256(p + w), 0xD8) );
+        return;
+    }
+    for ( w = 0; w < nWords; w += 4*Step )
+        for ( i = 0; i < Step; i += 4 )
+        {
+            __m256i a = ABC_LD256( p + w + Step + i );
+            ABC_ST256( p + w + Step + i, ABC_LD256(p + w + 2*Step + i) );
+            ABC_ST256( p + w + 2*Step + i, a );
+        }
+}
+__attribute__((target("avx2")))
+static void Abc_SimdTtSwapVarsAvx2( word * p, int nWords, int iVar, int jVar )
+{
+    int w, i, j;
+    int iStep = iVar > 5 ? 1 << (iVar - 6) : 0;
+    int jStep = jVar > 5 ? 1 << (jVar - 6) : 0;
+    if ( nWords < 4 || (jVar > 5 && iVar <= 5 && jStep < 4) || (iVar > 5 && iStep < 4) )
+    {
+        Abc_SimdTtSwapVarsSse2( p, nWords, iVar, jVar );
+        return;
+    }
+    if ( jVar <= 5 )
+    {
+        __m256i M0 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][0] );
+        __m256i M1 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][1] );
+        __m256i M2 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( (1 << jVar) - (1 << iVar) );
+        for ( w = 0; w < nWords; w += 4 )
+        {
+            __m256i a = ABC_LD256( p + w );
+            ABC_ST256( p + w, _mm256_or_si256(_mm256_and_si256(a, M0), _mm256_or_si256(_mm256_sll_epi64(_mm256_and_si256(a, M1), S), _mm256_srl_epi64(_mm256_and_si256(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m256i T = _mm256_set1_epi64x( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 2*jStep )
+            for ( j = 0; j < jStep; j += 4 )
+            {
+                __m256i Lo  = ABC_LD256( p + w + j );
+                __m256i Hi  = ABC_LD256( p + w + j + jStep );
+                __m256i L2H = _mm256_srl_epi64( _mm256_and_si256(Lo, T), S );
+                __m256i H2L = _mm256_and_si256( _mm256_sll_epi64(Hi, S), T );
+                ABC_ST256( p + w + j,         _mm256_or_si256(_mm256_andnot_si256(T, Lo), H2L) );
+                ABC_ST256( p + w + j + jStep, _mm256_or_si256(_mm256_and_si256(Hi, T), L2H) );
+            }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*jStep )
+        for ( i = 0; i < jStep; i += 2*iStep )
+            for ( j = 0; j < iStep; j += 4 )
+            {
+                __m256i a = ABC_LD256( p + w + iStep + i + j );
+                ABC_ST256( p + w + iStep + i + j, ABC_LD256(p + w + jStep + i + j) );
+                ABC_ST256( p + w + jStep + i + j, a );
+            }
+}
+__attribute__((target("avx2")))
+static void Abc_SimdTtCofactorAvx2( word * pOut, word * pIn, int nWords, int iVar, int fCof1 )
+{
+    int w, i, Step = iVar > 5 ? 1 << (iVar - 6) : 0;
+    if ( nWords < 4 || (iVar > 5 && Step < 4) )
+    {
+        Abc_SimdTtCofactorSse2( pOut, pIn, nWords, iVar, fCof1 );
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m256i M = _mm256_set1_epi64x( (long long)(fCof1 ? s_Truths6[iVar] : s_Truths6Neg[iVar]) );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 4 )
+        {
+            __m256i a = _mm256_and_si256( ABC_LD256(pIn + w), M );
+            ABC_ST256( pOut + w, _mm256_or_si256(a, fCof1 ? _mm256_srl_epi64(a, S) : _mm256_sll_epi64(a, S)) );
+        }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 4 )
+        {
+            __m256i a = ABC_LD256( pIn + w + (fCof1 ? Step : 0) + i );
+            ABC_ST256( pOut + w + i, a );
+            ABC_ST256( pOut + w + Step + i, a );
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 truth table kernels.]
+
+  Description [The blocks smaller than 8 words are handled by AVX2.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdTtFlipAvx512( word * p, int nWords, int iVar )
+{
+    int w, i, Step = iVar > 5 ? 1 << (iVar - 6) : 0;
+    if ( nWords < 8 || (iVar > 5 && Step < 8) )
+    {
+        Abc_SimdTtFlipAvx2( p, nWords, iVar );
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m512i M = _mm512_set1_epi64( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 8 )
+        {
+            __m512i a = ABC_LD512( p + w );
+            ABC_ST512( p + w, _mm512_or_si512(_mm512_and_si512(_mm512_sll_epi64(a, S), M), _mm512_srl_epi64(_mm512_and_si512(a, M), S)) );
+        }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 8 )
+        {
+            __m512i a = ABC_LD512( p + w + i );
+            ABC_ST512( p + w + i, ABC_LD512(p + w + Step + i) );
+            ABC_ST512( p + w + Step + i, a );
+        }
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdTtSwapAdjacentAvx512( word * p, int nWords, int iVar )
+{
+    int w, i, Step = iVar > 5 ? 1 << (iVar - 6) : 0;
+    if ( nWords < 8 || (iVar > 5 && Step < 8) )
+    {
+        Abc_SimdTtSwapAdjacentAvx2( p, nWords, iVar );
+        return;
+    }
+    if ( iVar < 5 )
+    {
+        __m512i M0 = _mm512_set1_epi64( (long long)s_PMasks[iVar][0] );
+        __m512i M1 = _mm512_set1_epi64( (long long)s_PMasks[iVar][1] );
+        __m512i M2 = _mm512_set1_epi64( (long long)s_PMasks[iVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 8 )
+        {
+            __m512i a = ABC_LD512( p + w );
+            ABC_ST512( p + w, _mm512_or_si512(_mm512_and_si512(a, M0), _mm512_or_si512(_mm512_sll_epi64(_mm512_and_si512(a, M1), S), _mm512_srl_epi64(_mm512_and_si512(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar == 5 )
+    {
+        for ( w = 0; w < nWords; w += 8 )
+            ABC_ST512( p + w, _mm512_shuffle_epi32(ABC_LD512(p + w), (_MM_PERM_ENUM)0xD8) );
+        return;
+    }
+    for ( w = 0; w < nWords; w += 4*Step )
+        for ( i = 0; i < Step; i += 8 )
+        {
+            __m512i a = ABC_LD512( p + w + Step + i );
+            ABC_ST512( p + w + Step + i, ABC_LD512(p + w + 2*Step + i) );
+            ABC_ST512( p + w + 2*Step + i, a );
+        }
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdTtSwapVarsAvx512( word * p, int nWords, int iVar, int jVar )
+{
+    int w, i, j;
+    int iStep = iVar > 5 ? 1 << (iVar - 6) : 0;
+    int jStep = jVar > 5 ? 1 << (jVar - 6) : 0;
+    if ( nWords < 8 || (jVar > 5 && iVar <= 5 && jStep < 8) || (iVar > 5 && iStep < 8) )
+    {
+        Abc_SimdTtSwapVarsAvx2( p, nWords, iVar, jVar );
+        return;
+    }
+    if ( jVar <= 5 )
+    {
+        __m512i M0 = _mm512_set1_epi64( (long long)s_PPMasks[iVar][jVar][0] );
+        __m512i M1 = _mm512_set1_epi64( (long long)s_PPMasks[iVar][jVar][1] );
+        __m512i M2 = _mm512_set1_epi64( (long long)s_PPMasks[iVar][jVar][2] );
+        __m128i S  = _mm_cvtsi32_si128( (1 << jVar) - (1 << iVar) );
+        for ( w = 0; w < nWords; w += 8 )
+        {
+            __m512i a = ABC_LD512( p + w );
+            ABC_ST512( p + w, _mm512_or_si512(_mm512_and_si512(a, M0), _mm512_or_si512(_mm512_sll_epi64(_mm512_and_si512(a, M1), S), _mm512_srl_epi64(_mm512_and_si512(a, M2), S))) );
+        }
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m512i T = _mm512_set1_epi64( (long long)s_Truths6[iVar] );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 2*jStep )
+            for ( j = 0; j < jStep; j += 8 )
+            {
+                __m512i Lo  = ABC_LD512( p + w + j );
+                __m512i Hi  = ABC_LD512( p + w + j + jStep );
+                __m512i L2H = _mm512_srl_epi64( _mm512_and_si512(Lo, T), S );
+                __m512i H2L = _mm512_and_si512( _mm512_sll_epi64(Hi, S), T );
+                ABC_ST512( p + w + j,         _mm512_or_si512(_mm512_andnot_si512(T, Lo), H2L) );
+                ABC_ST512( p + w + j + jStep, _mm512_or_si512(_mm512_and_si512(Hi, T), L2H) );
+            }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*jStep )
+        for ( i = 0; i < jStep; i += 2*iStep )
+            for ( j = 0; j < iStep; j += 8 )
+            {
+                __m512i a = ABC_LD512( p + w + iStep + i + j );
+                ABC_ST512( p + w + iStep + i + j, ABC_LD512(p + w + jStep + i + j) );
+                ABC_ST512( p + w + jStep + i + j, a );
+            }
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdTtCofactorAvx512( word * pOut, word * pIn, int nWords, int iVar, int fCof1 )
+{
+    int w, i, Step = iVar > 5 ? 1 << (iVar - 6) : 0;
+    if ( nWords < 8 || (iVar > 5 && Step < 8) )
+    {
+        Abc_SimdTtCofactorAvx2( pOut, pIn, nWords, iVar, fCof1 );
+        return;
+    }
+    if ( iVar <= 5 )
+    {
+        __m512i M = _mm512_set1_epi64( (long long)(fCof1 ? s_Truths6[iVar] : s_Truths6Neg[iVar]) );
+        __m128i S = _mm_cvtsi32_si128( 1 << iVar );
+        for ( w = 0; w < nWords; w += 8 )
+        {
+            __m512i a = _mm512_and_si512( ABC_LD512(pIn + w), M );
+            ABC_ST512( pOut + w, _mm512_or_si512(a, fCof1 ? _mm512_srl_epi64(a, S) : _mm512_sll_epi64(a, S)) );
+        }
+        return;
+    }
+    for ( w = 0; w < nWords; w += 2*Step )
+        for ( i = 0; i < Step; i += 8 )
+        {
+            __m512i a = ABC_LD512( pIn + w + (fCof1 ? Step : 0) + i );
+            ABC_ST512( pOut + w + i, a );
+            ABC_ST512( pOut + w + Step + i, a );
+        }
+}
+
+#endif // ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the instruction sets and sets up the kernels.]
+
+  Description [The level can be limited by the environment variable
+  ABC_SIMD set to one of "none", "sse2", "avx2", "avx512".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SimdLevelMax()
+{
+    int Level = ABC_SIMD_NONE;
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("sse2") )
+        Level = ABC_SIMD_SSE2;
+    if ( __builtin_cpu_supports("avx2") )
+        Level = ABC_SIMD_AVX2;
+    if ( __builtin_cpu_supports("avx512f") )
+        Level = ABC_SIMD_AVX512;
+#endif
+    return Level;
+}
+const char * Abc_SimdLevelName( int Level )
+{
+    if ( Level == ABC_SIMD_SSE2 )   return "sse2";
+    if ( Level == ABC_SIMD_AVX2 )   return "avx2";
+    if ( Level == ABC_SIMD_AVX512 ) return "avx512";
+    return "none";
+}
+static void Abc_SimdInitOne()
+{
+    char * pEnv = getenv( "ABC_SIMD" );
+    int i, Level = Abc_SimdLevelMax();
+    for ( i = 0; i < 4; i++ )
+    {
+        s_SimdFuncs[i].pCopy = Abc_SimdCopyWord;
+        s_SimdFuncs[i].pAnd  = Abc_SimdAndWord;
+        s_SimdFuncs[i].pXor  = Abc_SimdXorWord;
+        s_SimdFuncs[i].pMux  = Abc_SimdMuxWord;
+        s_SimdFuncs[i].pTtFlip         = Abc_SimdTtFlipWord;
+        s_SimdFuncs[i].pTtSwapAdjacent = Abc_SimdTtSwapAdjacentWord;
+        s_SimdFuncs[i].pTtSwapVars     = Abc_SimdTtSwapVarsWord;
+        s_SimdFuncs[i].pTtCofactor     = Abc_SimdTtCofactorWord;
+    }
+#ifdef ABC_SIMD_X86
+    s_SimdFuncs[ABC_SIMD_SSE2].pCopy   = Abc_SimdCopySse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pAnd    = Abc_SimdAndSse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pXor    = Abc_SimdXorSse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pMux    = Abc_SimdMuxSse2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pCopy   = Abc_SimdCopyAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pAnd    = Abc_SimdAndAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pXor    = Abc_SimdXorAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pMux    = Abc_SimdMuxAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX512].pCopy = Abc_SimdCopyAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pAnd  = Abc_SimdAndAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pXor  = Abc_SimdXorAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pMux  = Abc_SimdMuxAvx512;
+    s_SimdFuncs[ABC_SIMD_SSE2].pTtFlip           = Abc_SimdTtFlipSse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pTtSwapAdjacent   = Abc_SimdTtSwapAdjacentSse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pTtSwapVars       = Abc_SimdTtSwapVarsSse2;
+    s_SimdFuncs[ABC_SIMD_SSE2].pTtCofactor       = Abc_SimdTtCofactorSse2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pTtFlip           = Abc_SimdTtFlipAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pTtSwapAdjacent   = Abc_SimdTtSwapAdjacentAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pTtSwapVars       = Abc_SimdTtSwapVarsAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX2].pTtCofactor       = Abc_SimdTtCofactorAvx2;
+    s_SimdFuncs[ABC_SIMD_AVX512].pTtFlip         = Abc_SimdTtFlipAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pTtSwapAdjacent = Abc_SimdTtSwapAdjacentAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pTtSwapVars     = Abc_SimdTtSwapVarsAvx512;
+    s_SimdFuncs[ABC_SIMD_AVX512].pTtCofactor     = Abc_SimdTtCofactorAvx512;
+#endif
+    for ( i = ABC_SIMD_NONE; pEnv && i <= ABC_SIMD_AVX512; i++ )
+        if ( !strcmp(pEnv, Abc_SimdLevelName(i)) )
+            Level = Abc_MinInt( Level, i );
+    s_SimdLevel = Level;
+    Abc_SimdFuncsCur = s_SimdFuncs + Level;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels for the current CPU.]
+
+  Description [Can be called any number of times by any thread; the
+  kernels are selected once. It is called by Abc_FrameInit() and by
+  Util_PoolStart(), so that Abc_SimdFuncsCur is set before the threads
+  that use it are started.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdInit()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_SimdOnce, Abc_SimdInitOne );
+#else
+    if ( !s_SimdOnce )
+        Abc_SimdInitOne(), s_SimdOnce = 1;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the kernels for the current level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_SimdFuncs_t * Abc_SimdFuncs()
+{
+    Abc_SimdInit();
+    return Abc_SimdFuncsCur;
+}
+int Abc_SimdLevel()
+{
+    Abc_SimdInit();
+    return s_SimdLevel;
+}
+void Abc_SimdSetLevel( int Level )
+{
+    Abc_SimdInit();
+    s_SimdLevel = Abc_MaxInt( ABC_SIMD_NONE, Abc_MinInt(Level, Abc_SimdLevelMax()) );
+    Abc_SimdFuncsCur = s_SimdFuncs + s_SimdLevel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Microbenchmark of the truth table kernels.]
+
+  Description [Applies each operation to all variables (or pairs of
+  variables) of a random function with nVars variables nRounds times
+  using each available instruction set. Reports the number of operations
+  per second and checks that the results match the portable code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdTtBench( int nVars, int nRounds, int fVerbose )
+{
+    char * pOpNames[4] = { "flip", "swap-adj", "swap-vars", "cofactor" };
+    int nWords = Abc_TtWordNum( nVars );
+    word * pTruth = ABC_ALLOC( word, nWords );
+    word * pOut   = ABC_ALLOC( word, nWords );
+    word pCheck[4] = {0};
+    int Level, LevelOld = Abc_SimdLevel(), Op, r, i, j, w;
+    assert( nVars >= 7 && nVars <= 16 );
+    printf( "Benchmarking truth table operations for %d-variable functions (%d words) with %d rounds.\n", nVars, nWords, nRounds );
+    for ( Level = ABC_SIMD_NONE; Level <= Abc_SimdLevelMax(); Level++ )
+    {
+        Abc_SimdFuncs_t * pFuncs;
+        int fMismatch = 0;
+        Abc_SimdSetLevel( Level );
+        pFuncs = Abc_SimdFuncs();
+        printf( "%-8s :", Abc_SimdLevelName(Level) );
+        for ( Op = 0; Op < 4; Op++ )
+        {
+            abctime clk = Abc_Clock();
+            double Time, nOps = 0;
+            word Check = 0;
+            Abc_RandomW( 1 );
+            for ( w = 0; w < nWords; w++ )
+                pTruth[w] = Abc_RandomW( 0 );
+            for ( r = 0; r < nRounds; r++ )
+            {
+                if ( Op == 0 )
+                    for ( i = 0; i < nVars; i++, nOps++ )
+                        pFuncs->pTtFlip( pTruth, nWords, i );
+                else if ( Op == 1 )
+                    for ( i = 0; i < nVars - 1; i++, nOps++ )
+                        pFuncs->pTtSwapAdjacent( pTruth, nWords, i );
+                else if ( Op == 2 )
+                    for ( i = 0; i < nVars; i++ )
+                        for ( j = i + 1; j < nVars; j++, nOps++ )
+                            pFuncs->pTtSwapVars( pTruth, nWords, i, j );
+                else
+                    for ( i = 0; i < nVars; i++, nOps++ )
+                    {
+                        pFuncs->pTtCofactor( pOut, pTruth, nWords, i, r & 1 );
+                        pTruth[i % nWords] ^= pOut[(i + r) % nWords];
+                    }
+            }
+            Time = 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC;
+            for ( w = 0; w < nWords; w++ )
+                Check ^= pTruth[w] * (2*w + 1);
+            if ( Level == ABC_SIMD_NONE )
+                pCheck[Op] = Check;
+            else if ( pCheck[Op] != Check )
+                fMismatch = 1;
+            printf( "  %s = %8.2f Mops/s", pOpNames[Op], Time > 0 ? nOps/Time/1000000 : 0 );
+            if ( fVerbose )
+                printf( " (%.2f sec)", Time );
+        }
+        printf( "%s\n", fMismatch ? "  MISMATCH!" : "" );
+    }
+    Abc_SimdSetLevel( LevelOld );
+    ABC_FREE( pTruth );
+    ABC_FREE( pOut );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
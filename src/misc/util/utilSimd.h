@@ -0,0 +1,174 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized bit-parallel kernels.]
+
+  Synopsis    [Vectorized bit-parallel kernels.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// instruction sets in the order of preference
+typedef enum {
+    ABC_SIMD_NONE = 0,          // portable word loops
+    ABC_SIMD_SSE2,              // 128-bit vectors
+    ABC_SIMD_AVX2,              // 256-bit vectors
+    ABC_SIMD_AVX512             // 512-bit vectors
+} Abc_SimdLevel_t;
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the kernels take the complemented attributes of the inputs (0 or 1)
+// and work for any number of words, including in-place computation
+typedef struct Abc_SimdFuncs_t_ Abc_SimdFuncs_t;
+struct Abc_SimdFuncs_t_
+{
+    // pOut = pIn0 ^ fCompl0
+    void (*pCopy)( word * pOut, word * pIn0, int fCompl0, int nWords );
+    // pOut = (pIn0 ^ fCompl0) & (pIn1 ^ fCompl1)
+    void (*pAnd) ( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords );
+    // pOut = pIn0 ^ pIn1 ^ fCompl
+    void (*pXor) ( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords );
+    // pOut = (pInC ^ fComplC) ? (pIn1 ^ fCompl1) : (pIn0 ^ fCompl0)
+    void (*pMux) ( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords );
+    // truth table kernels for nWords >= 2 (see Abc_TtFlip() and others in utilTruth.h)
+    void (*pTtFlip)        ( word * pTruth, int nWords, int iVar );
+    void (*pTtSwapAdjacent)( word * pTruth, int nWords, int iVar );
+    void (*pTtSwapVars)    ( word * pTruth, int nWords, int iVar, int jVar );
+    void (*pTtCofactor)    ( word * pOut, word * pIn, int nWords, int iVar, int fCof1 );
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// the dispatched kernels are not called for fewer words than this
+#define ABC_SIMD_MIN_WORDS  8
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ===========================================================*/
+extern Abc_SimdFuncs_t *  Abc_SimdFuncsCur;
+extern void               Abc_SimdInit();
+extern Abc_SimdFuncs_t *  Abc_SimdFuncs();
+extern int                Abc_SimdLevel();
+extern int                Abc_SimdLevelMax();
+extern void               Abc_SimdSetLevel( int Level );
+extern const char *       Abc_SimdLevelName( int Level );
+extern void               Abc_SimdTtBench( int nVars, int nRounds, int fVerbose );
+
+// portable kernels
+static inline void Abc_SimdCopyWord( word * pOut, word * pIn0, int fCompl0, int nWords )
+{
+    word m0 = fCompl0 ? ~(word)0 : 0; int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ m0;
+}
+static inline void Abc_SimdAndWord( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords )
+{
+    word m0 = fCompl0 ? ~(word)0 : 0;
+    word m1 = fCompl1 ? ~(word)0 : 0; int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ m0) & (pIn1[w] ^ m1);
+}
+static inline void Abc_SimdXorWord( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word m = fCompl ? ~(word)0 : 0; int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ m;
+}
+static inline void Abc_SimdMuxWord( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords )
+{
+    word mC = fComplC ? ~(word)0 : 0;
+    word m1 = fCompl1 ? ~(word)0 : 0;
+    word m0 = fCompl0 ? ~(word)0 : 0; int w;
+    for ( w = 0; w < nWords; w++ )
+    {
+        word c = pInC[w] ^ mC;
+        pOut[w] = (c & (pIn1[w] ^ m1)) | (~c & (pIn0[w] ^ m0));
+    }
+}
+
+// dispatched kernels (short arrays are processed by the inline code above)
+static inline void Abc_SimdCopy( word * pOut, word * pIn0, int fCompl0, int nWords )
+{
+    if ( nWords < ABC_SIMD_MIN_WORDS )
+        Abc_SimdCopyWord( pOut, pIn0, fCompl0, nWords );
+    else
+        Abc_SimdFuncsCur->pCopy( pOut, pIn0, fCompl0, nWords );
+}
+static inline void Abc_SimdAnd( word * pOut, word * pIn0, int fCompl0, word * pIn1, int fCompl1, int nWords )
+{
+    if ( nWords < ABC_SIMD_MIN_WORDS )
+        Abc_SimdAndWord( pOut, pIn0, fCompl0, pIn1, fCompl1, nWords );
+    else
+        Abc_SimdFuncsCur->pAnd( pOut, pIn0, fCompl0, pIn1, fCompl1, nWords );
+}
+static inline void Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    if ( nWords < ABC_SIMD_MIN_WORDS )
+        Abc_SimdXorWord( pOut, pIn0, pIn1, fCompl, nWords );
+    else
+        Abc_SimdFuncsCur->pXor( pOut, pIn0, pIn1, fCompl, nWords );
+}
+static inline void Abc_SimdMux( word * pOut, word * pInC, int fComplC, word * pIn1, int fCompl1, word * pIn0, int fCompl0, int nWords )
+{
+    if ( nWords < ABC_SIMD_MIN_WORDS )
+        Abc_SimdMuxWord( pOut, pInC, fComplC, pIn1, fCompl1, pIn0, fCompl0, nWords );
+    else
+        Abc_SimdFuncsCur->pMux( pOut, pInC, fComplC, pIn1, fCompl1, pIn0, fCompl0, nWords );
+}
+// truth table kernels called by utilTruth.h for large truth tables; like the
+// ones above, they read the table selected by Abc_SimdInit() without locking
+static inline void Abc_SimdTtFlip( word * pTruth, int nWords, int iVar )
+{
+    Abc_SimdFuncsCur->pTtFlip( pTruth, nWords, iVar );
+}
+static inline void Abc_SimdTtSwapAdjacent( word * pTruth, int nWords, int iVar )
+{
+    Abc_SimdFuncsCur->pTtSwapAdjacent( pTruth, nWords, iVar );
+}
+static inline void Abc_SimdTtSwapVars( word * pTruth, int nWords, int iVar, int jVar )
+{
+    Abc_SimdFuncsCur->pTtSwapVars( pTruth, nWords, iVar, jVar );
+}
+static inline void Abc_SimdTtCofactor( word * pOut, word * pIn, int nWords, int iVar, int fCof1 )
+{
+    Abc_SimdFuncsCur->pTtCofactor( pOut, pIn, nWords, iVar, fCof1 );
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
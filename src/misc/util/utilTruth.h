@@ -30,10 +30,18 @@
 #  define __builtin_popcount __popcnt
 #endif
 
+#include "misc/util/utilSimd.h"
+
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+// the truth tables with this many words or more are flipped, swapped and
+// cofactored by the vectorized kernels in utilSimd.c (this is 9 variables;
+// for smaller ones the call overhead outweighs the gain); the kernels are
+// selected by Abc_SimdInit() before any threads are started
+#define ABC_TT_SIMD_WORDS  8
+
 ABC_NAMESPACE_HEADER_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -1049,6 +1057,8 @@ static inline void Abc_TtCofactor0p( word * pOut, word * pIn, int nWords, int iV
 {
     if ( nWords == 1 )
         pOut[0] = ((pIn[0] & s_Truths6Neg[iVar]) << (1 << iVar)) | (pIn[0] & s_Truths6Neg[iVar]);
+    else if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtCofactor( pOut, pIn, nWords, iVar, 0 );
     else if ( iVar <= 5 )
     {
         int w, shift = (1 << iVar);
@@ -1071,6 +1081,8 @@ static inline void Abc_TtCofactor1p( word * pOut, word * pIn, int nWords, int iV
 {
     if ( nWords == 1 )
         pOut[0] = (pIn[0] & s_Truths6[iVar]) | ((pIn[0] & s_Truths6[iVar]) >> (1 << iVar));
+    else if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtCofactor( pOut, pIn, nWords, iVar, 1 );
     else if ( iVar <= 5 )
     {
         int w, shift = (1 << iVar);
@@ -1093,6 +1105,8 @@ static inline void Abc_TtCofactor0( word * pTruth, int nWords, int iVar )
 {
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] & s_Truths6Neg[iVar]) << (1 << iVar)) | (pTruth[0] & s_Truths6Neg[iVar]);
+    else if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtCofactor( pTruth, pTruth, nWords, iVar, 0 );
     else if ( iVar <= 5 )
     {
         int w, shift = (1 << iVar);
@@ -1112,6 +1126,8 @@ static inline void Abc_TtCofactor1( word * pTruth, int nWords, int iVar )
 {
     if ( nWords == 1 )
         pTruth[0] = (pTruth[0] & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
+    else if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtCofactor( pTruth, pTruth, nWords, iVar, 1 );
     else if ( iVar <= 5 )
     {
         int w, shift = (1 << iVar);
@@ -1918,6 +1934,8 @@ static inline void Abc_TtFlip( word * pTruth, int nWords, int iVar )
 {
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] << (1 << iVar)) & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
+    else if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtFlip( pTruth, nWords, iVar );
     else if ( iVar <= 5 )
     {
         int w, shift = (1 << iVar);
@@ -1951,7 +1969,9 @@ static inline word Abc_Tt6SwapAdjacent( word Truth, int iVar )
 }
 static inline void Abc_TtSwapAdjacent( word * pTruth, int nWords, int iVar )
 {
-    if ( iVar < 5 )
+    if ( nWords >= ABC_TT_SIMD_WORDS )
+        Abc_SimdTtSwapAdjacent( pTruth, nWords, iVar );
+    else if ( iVar < 5 )
     {
         int i, Shift = (1 << iVar);
         for ( i = 0; i < nWords; i++ )
@@ -1992,6 +2012,11 @@ static inline void Abc_TtSwapVars( word * pTruth, int nVars, int iVar, int jVar
         pTruth[0] = Abc_Tt6SwapVars( pTruth[0], iVar, jVar );
         return;
     }
+    if ( Abc_TtWordNum(nVars) >= ABC_TT_SIMD_WORDS )
+    {
+        Abc_SimdTtSwapVars( pTruth, Abc_TtWordNum(nVars), iVar, jVar );
+        return;
+    }
     if ( jVar <= 5 )
     {
         word * s_PMasks = s_PPMasks[iVar][jVar];
@@ -323,6 +323,13 @@ static inline void Vec_MemHashFree( Vec_Mem_t * p )
     Vec_IntFreeP( &p->vTable );
     Vec_IntFreeP( &p->vNexts );
 }
+static inline void Vec_MemHashClear( Vec_Mem_t * p )
+{
+    if ( p->nEntries > 0 )
+        Vec_MemShrink( p, 0 );
+    Vec_IntFill( p->vTable, Vec_IntSize(p->vTable), -1 );
+    Vec_IntClear( p->vNexts );
+}
 static inline unsigned Vec_MemHashKey( Vec_Mem_t * p, word * pEntry )
 {
     static int s_Primes[8] = { 1699, 4177, 5147, 5647, 6343, 7103, 7873, 8147 };
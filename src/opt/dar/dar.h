@@ -83,6 +83,8 @@ struct Dar_RefPar_t_
 /*=== darLib.c ========================================================*/
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
+extern int             Dar_LibIsStarted();
+extern void *          Dar_LibSwap( void * pLib );
 extern void            Dar_LibPrepare( int nSubgraphs );
 extern int             Dar_LibReturnClass( unsigned uTruth );
 /*=== darBalance.c ========================================================*/
@@ -105,7 +105,13 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+// the library keeps the scratch data of the cut being evaluated,
+// so each thread rewriting an AIG works with its own copy
+#ifdef _MSC_VER
+static __declspec(thread) Dar_Lib_t * s_DarLib = NULL;
+#else
+static __thread Dar_Lib_t * s_DarLib = NULL;
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -466,9 +472,9 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 
 /**Function*************************************************************
 
-  Synopsis    [Starts the library.]
+  Synopsis    [Prepares the library for rewriting.]
 
-  Description []
+  Description [Starts the library of this thread if it is not started.]
                
   SideEffects []
 
@@ -477,8 +483,11 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -619,6 +628,42 @@ void Dar_LibStop()
     s_DarLib = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the library of this thread is started.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_LibIsStarted()
+{
+    return s_DarLib != NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the library of this thread.]
+
+  Description [Makes pLib (possibly NULL) the library of this thread and
+  returns the previous one. This way several libraries can be kept by 
+  the caller and installed in the threads that need them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dar_LibSwap( void * pLib )
+{
+    Dar_Lib_t * pOld = s_DarLib;
+    s_DarLib = (Dar_Lib_t *)pLib;
+    return pOld;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the score of the class and adjusts the priority of this class.]
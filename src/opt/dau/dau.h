@@ -60,6 +60,7 @@ typedef enum {
 
 typedef struct Dss_Man_t_ Dss_Man_t;
 typedef struct Abc_TtHieMan_t_ Abc_TtHieMan_t;
+typedef struct Abc_TtNpnCache_t_ Abc_TtNpnCache_t;
 typedef unsigned(*TtCanonicizeFunc)(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 
 ////////////////////////////////////////////////////////////////////////
@@ -76,6 +77,12 @@ static inline int Dau_DsdReadVar( char * p )  { if ( *p == '!' ) p++; return *p
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== dauBatch.c ==========================================================*/
+extern Abc_TtNpnCache_t * Abc_TtNpnCacheStart( int nVars );
+extern void          Abc_TtNpnCacheStop( Abc_TtNpnCache_t * p );
+extern int           Abc_TtNpnCacheSize( Abc_TtNpnCache_t * p );
+extern void          Abc_TtNpnCachePrint( Abc_TtNpnCache_t * p );
+extern void          Abc_TtCanonicizeBatch( Abc_TtNpnCache_t * pCache, word * pTruths, int nTruths, int nVars, unsigned * pPhases, char * pPerms, int nProcs );
 /*=== dauCanon.c ==========================================================*/
 extern unsigned      Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm );
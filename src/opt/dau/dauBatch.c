@@ -0,0 +1,228 @@
+/**CFile****************************************************************
+
+  FileName    [dauBatch.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Canonicizing arrays of truth tables.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+#include "misc/vec/vecMem.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the number of functions canonicized by one task
+#define DAU_BATCH_CHUNK  1024
+
+// the memo of the computed canonical forms
+struct Abc_TtNpnCache_t_
+{
+    int              nVars;      // the number of variables
+    int              nWords;     // the number of words in the truth table
+    Vec_Mem_t *      vTtMem;     // the original functions (hashed)
+    Vec_Wrd_t *      vCanon;     // the canonical forms (nWords per function)
+    Vec_Int_t *      vPhases;    // the canonical phases
+    Vec_Str_t *      vPerms;     // the canonical permutations (nVars per function)
+    int              nLookups;   // the number of looked up functions
+    int              nHits;      // the number of functions found in the memo
+};
+
+typedef struct Dau_BatchJob_t_ Dau_BatchJob_t;
+struct Dau_BatchJob_t_
+{
+    Abc_TtNpnCache_t * pCache;   // the memo
+    word *           pTruths;    // the functions to canonicize
+    unsigned *       pPhases;    // the resulting phases
+    char *           pPerms;     // the resulting permutations
+    int              iBeg;       // the first function
+    int              iEnd;       // the last function (exclusive)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the memo of canonical forms.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_TtNpnCache_t * Abc_TtNpnCacheStart( int nVars )
+{
+    Abc_TtNpnCache_t * p;
+    assert( nVars <= 16 );
+    p = ABC_CALLOC( Abc_TtNpnCache_t, 1 );
+    p->nVars   = nVars;
+    p->nWords  = Abc_TtWordNum( nVars );
+    p->vTtMem  = Vec_MemAllocForTTSimple( nVars );
+    p->vCanon  = Vec_WrdAlloc( 1000 * p->nWords );
+    p->vPhases = Vec_IntAlloc( 1000 );
+    p->vPerms  = Vec_StrAlloc( 1000 * nVars );
+    return p;
+}
+void Abc_TtNpnCacheStop( Abc_TtNpnCache_t * p )
+{
+    Vec_MemHashFree( p->vTtMem );
+    Vec_MemFree( p->vTtMem );
+    Vec_WrdFree( p->vCanon );
+    Vec_IntFree( p->vPhases );
+    Vec_StrFree( p->vPerms );
+    ABC_FREE( p );
+}
+int Abc_TtNpnCacheSize( Abc_TtNpnCache_t * p )
+{
+    return Vec_MemEntryNum( p->vTtMem );
+}
+void Abc_TtNpnCachePrint( Abc_TtNpnCache_t * p )
+{
+    printf( "Memo: Functions = %d. Lookups = %d. Hits = %d (%.2f %%). Memory = %.2f MB.\n",
+        Abc_TtNpnCacheSize(p), p->nLookups, p->nHits, 100.0 * p->nHits / Abc_MaxInt(p->nLookups, 1),
+        (Vec_MemMemory(p->vTtMem) + 8.0 * Vec_WrdCap(p->vCanon) + 4.0 * Vec_IntCap(p->vPhases) + Vec_StrCap(p->vPerms)) / (1 << 20) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Canonicizes a range of functions.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_TtCanonicizeBatchJob( void * pArg )
+{
+    Dau_BatchJob_t * pJob = (Dau_BatchJob_t *)pArg;
+    Abc_TtNpnCache_t * p = pJob->pCache;
+    int i;
+    for ( i = pJob->iBeg; i < pJob->iEnd; i++ )
+        pJob->pPhases[i] = Abc_TtCanonicize( pJob->pTruths + i * p->nWords, p->nVars, pJob->pPerms + i * p->nVars );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Canonicizes an array of truth tables.]
+
+  Description [The array pTruths contains nTruths functions of nVars
+  variables stored one after another. They are replaced by their
+  semi-canonical forms computed by Abc_TtCanonicize(). If pPhases and
+  pPerms are not NULL, the canonical phase of each function and its
+  permutation (nVars entries per function) are returned there.
+  The functions are first looked up in the memo; the new ones are
+  canonicized in groups of fixed size by nProcs threads and added to
+  the memo in the order of their first appearance. Thus the result
+  and the memo contents do not depend on the number of threads.
+  If the memo is not given, a temporary one is used, which still
+  canonicizes each distinct function in the array only once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCanonicizeBatch( Abc_TtNpnCache_t * pCache, word * pTruths, int nTruths, int nVars, unsigned * pPhases, char * pPerms, int nProcs )
+{
+    Abc_TtNpnCache_t * p = pCache ? pCache : Abc_TtNpnCacheStart( nVars );
+    int nWords = p->nWords;
+    int * pMap = ABC_ALLOC( int, nTruths );
+    int i, k, nOld = Abc_TtNpnCacheSize( p ), nNew;
+    assert( p->nVars == nVars );
+    // look up the functions and add the new ones to the memo
+    for ( i = 0; i < nTruths; i++ )
+        pMap[i] = Vec_MemHashInsert( p->vTtMem, pTruths + i * nWords );
+    nNew = Abc_TtNpnCacheSize( p ) - nOld;
+    p->nLookups += nTruths;
+    p->nHits    += nTruths - nNew;
+    // canonicize the new functions
+    if ( nNew > 0 )
+    {
+        word * pNewTruths;
+        char * pNewPerms;
+        unsigned * pNewPhases;
+        int nJobs = (nNew + DAU_BATCH_CHUNK - 1) / DAU_BATCH_CHUNK;
+        Dau_BatchJob_t * pJobs = ABC_CALLOC( Dau_BatchJob_t, nJobs );
+        Vec_WrdGrow( p->vCanon, (nOld + nNew) * nWords );
+        Vec_IntGrow( p->vPhases, nOld + nNew );
+        Vec_StrGrow( p->vPerms, (nOld + nNew) * nVars );
+        for ( i = 0; i < nNew; i++ )
+            Vec_WrdPushArray( p->vCanon, Vec_MemReadEntry(p->vTtMem, nOld + i), nWords );
+        Vec_IntFillExtra( p->vPhases, nOld + nNew, 0 );
+        Vec_StrFillExtra( p->vPerms, (nOld + nNew) * nVars, 0 );
+        pNewTruths = Vec_WrdEntryP( p->vCanon, nOld * nWords );
+        pNewPhases = (unsigned *)Vec_IntEntryP( p->vPhases, nOld );
+        pNewPerms  = Vec_StrEntryP( p->vPerms, nOld * nVars );
+        for ( k = 0; k < nJobs; k++ )
+        {
+            pJobs[k].pCache  = p;
+            pJobs[k].pTruths = pNewTruths;
+            pJobs[k].pPhases = pNewPhases;
+            pJobs[k].pPerms  = pNewPerms;
+            pJobs[k].iBeg    = k * DAU_BATCH_CHUNK;
+            pJobs[k].iEnd    = Abc_MinInt( (k + 1) * DAU_BATCH_CHUNK, nNew );
+        }
+        if ( nProcs > 1 && nJobs > 1 )
+        {
+            Util_Task_t ** pTasks = ABC_CALLOC( Util_Task_t *, nJobs );
+            Util_PoolStart( nProcs );
+            for ( k = 0; k < nJobs; k++ )
+                pTasks[k] = Util_PoolSubmit( Abc_TtCanonicizeBatchJob, pJobs + k );
+            for ( k = 0; k < nJobs; k++ )
+            {
+                Util_TaskWait( pTasks[k], 0 );
+                Util_TaskFree( pTasks[k] );
+            }
+            ABC_FREE( pTasks );
+        }
+        else
+        {
+            for ( k = 0; k < nJobs; k++ )
+                Abc_TtCanonicizeBatchJob( pJobs + k );
+        }
+        ABC_FREE( pJobs );
+    }
+    // return the results
+    for ( i = 0; i < nTruths; i++ )
+    {
+        Abc_TtCopy( pTruths + i * nWords, Vec_WrdEntryP(p->vCanon, pMap[i] * nWords), nWords, 0 );
+        if ( pPhases )
+            pPhases[i] = (unsigned)Vec_IntEntry( p->vPhases, pMap[i] );
+        if ( pPerms )
+            memcpy( pPerms + i * nVars, Vec_StrEntryP(p->vPerms, pMap[i] * nVars), (size_t)nVars );
+    }
+    ABC_FREE( pMap );
+    if ( pCache == NULL )
+        Abc_TtNpnCacheStop( p );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -35,6 +35,14 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the scratch truth tables of the cofactor permutation are kept per thread,
+// so that several functions can be canonicized concurrently
+#ifdef _MSC_VER
+#define DAU_THREAD __declspec(thread)
+#else
+#define DAU_THREAD __thread
+#endif
+
 static word s_CMasks6[5] = {
     ABC_CONST(0x1111111111111111),
     ABC_CONST(0x0303030303030303),
@@ -801,7 +809,7 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
 {
     if ( fSwapOnly )
     {
-        static word pCopy[1024];
+        static DAU_THREAD word pCopy[1024];
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
         Abc_TtSwapAdjacent( pCopy, nWords, i );
         if ( Abc_TtCompareRev(pTruth, pCopy, nWords) == 1 )
@@ -812,8 +820,8 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
         return 0;
     }
     {
-        static word pCopy[1024];
-        static word pBest[1024];
+        static DAU_THREAD word pCopy[1024];
+        static DAU_THREAD word pBest[1024];
         int Config = 0;
         // save two copies
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
@@ -992,7 +1000,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         return Config;
     }
     {
-        static word pCopy1[1024];
+        static DAU_THREAD word pCopy1[1024];
         int Config;
         Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
         Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
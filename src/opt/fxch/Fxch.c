@@ -150,7 +150,10 @@ void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan)
   Synopsis    [ Performs fast extract with cube hashing on a set
                 of covers. ]
 
-  Description []
+  Description [ With nProcs > 1, the sub-cube hash table is updated 
+                by several threads, while the divisors are created in 
+                the same order as with one thread. Thus the result does 
+                not depend on the number of threads. ]
 
   SideEffects []
 
@@ -160,6 +163,7 @@ void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan)
 int Fxch_FastExtract( Vec_Wec_t* vCubes,
                       int ObjIdMax,
                       int nMaxDivExt,
+                      int nProcs,
                       int fVerbose,
                       int fVeryVerbose )
 {
@@ -167,6 +171,8 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
     Fxch_Man_t* pFxchMan = Fxch_ManAlloc( vCubes );
     int i;
 
+    pFxchMan->nProcs = nProcs;
+
     TempTime = Abc_Clock();
     Fxch_CubesGruping( pFxchMan );
     Fxch_ManMapLiteralsIntoCubes( pFxchMan, ObjIdMax );
@@ -228,6 +234,7 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
 ***********************************************************************/
 int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk,
                         int nMaxDivExt,
+                        int nProcs,
                         int fVerbose,
                         int fVeryVerbose )
 {
@@ -242,7 +249,7 @@ int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk,
     }
 
     vCubes = Abc_NtkFxRetrieve( pNtk );
-    if ( Fxch_FastExtract( vCubes, Abc_NtkObjNumMax( pNtk ), nMaxDivExt, fVerbose, fVeryVerbose ) > 0 )
+    if ( Fxch_FastExtract( vCubes, Abc_NtkObjNumMax( pNtk ), nMaxDivExt, nProcs, fVerbose, fVeryVerbose ) > 0 )
     {
         Abc_NtkFxInsert( pNtk, vCubes );
         Vec_WecFree( vCubes );
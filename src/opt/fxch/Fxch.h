@@ -38,6 +38,7 @@ typedef struct Fxch_Man_t_               Fxch_Man_t;
 typedef struct Fxch_SubCube_t_           Fxch_SubCube_t;
 typedef struct Fxch_SCHashTable_t_       Fxch_SCHashTable_t;
 typedef struct Fxch_SCHashTable_Entry_t_ Fxch_SCHashTable_Entry_t;
+typedef struct Fxch_SCThread_t_          Fxch_SCThread_t;
 ////////////////////////////////////////////////////////////////////////
 ///                    STRUCTURES DEFINITIONS                        ///
 ////////////////////////////////////////////////////////////////////////
@@ -86,6 +87,38 @@ struct Fxch_SCHashTable_t_
     Vec_Int_t    vSubCube1;
 };
 
+/* Sub-cube Hash Table Thread
+ *
+ *   A batch of sub-cube insertions (or removals) is divided among the
+ *   threads by the hash table bins, so that each bin is updated by one
+ *   thread in the order of the batch. Instead of changing the divisors,
+ *   the threads record the pairs of sub-cubes they find as events, which
+ *   are then applied in the order of the batch, as the serial algorithm
+ *   would do. Each event is FXCH_EVENT_SIZE integers:
+ *        - The index of the operation in the batch and the event type
+ *          (0 = divisor, 1 = single-cube containment).
+ *        - The indexes of the two cubes.
+ *        - The base, the number of shared outputs and the divisor
+ *          (the number of literals followed by up to four literals).
+ */
+#define FXCH_EVENT_SIZE  11
+
+struct Fxch_SCThread_t_
+{
+    Fxch_Man_t*  pFxchMan;
+    int          iThread,
+                 nThreads;
+    char         fAdd;
+    int          nEntries;   /* the number of inserted sub-cubes */
+    int          iOp;        /* the current operation in the batch */
+
+    /* Temporary data */
+    Vec_Int_t    vSubCube0;
+    Vec_Int_t    vSubCube1;
+    Vec_Int_t    vCubeFree;
+    Vec_Int_t    vEvents;
+};
+
 struct Fxch_Man_t_
 {
     /* user's data */
@@ -123,6 +156,14 @@ struct Fxch_Man_t_
     Vec_Int_t* vCubesToUpdate;
     Vec_Int_t* vSCC;
 
+    // parallel processing of sub-cubes
+    int               nProcs;     /* the number of threads */
+    int               fCollect;   /* collect the sub-cube operations instead of performing them */
+    Vec_Int_t*        vBatchOps;  /* the operations (SubCubeID, iCube, iLit0, iLit1, Bin) */
+    Vec_Int_t*        vBatchBeg;  /* the first operation of each cube */
+    Fxch_SCThread_t*  pThreads;   /* the thread data */
+    int               nBatchesPar; /* the number of batches updated by several threads */
+
     /* Statistics */
     abctime timeInit;   /* Initialization time */
     abctime timeExt;    /* Extraction time */
@@ -154,10 +195,13 @@ static inline int Fxch_CountOnes( unsigned num )
 }
 
 /*===== Fxch.c =======================================================*/
-int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose );
-int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int fVerbose, int fVeryVerbose );
+void Fxch_CubesGruping( Fxch_Man_t* pFxchMan );
+void Fxch_CubesUnGruping( Fxch_Man_t* pFxchMan );
+int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
+int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
 
 /*===== FxchDiv.c ====================================================================================================*/
+int  Fxch_DivCreateInt( Fxch_Man_t* pFxchMan, Vec_Int_t* vCubeFree, Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1 );
 int  Fxch_DivCreate( Fxch_Man_t* pFxchMan,  Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1 );
 int  Fxch_DivAdd( Fxch_Man_t* pFxchMan, int fUpdate, int fSingleCube, int fBase );
 int  Fxch_DivRemove( Fxch_Man_t* pFxchMan, int fUpdate, int fSingleCube, int fBase );
@@ -199,8 +243,12 @@ Fxch_SCHashTable_t* Fxch_SCHashTableCreate( Fxch_Man_t* pFxchMan, int nEntries )
 
 void Fxch_SCHashTableDelete( Fxch_SCHashTable_t* );
 
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable,
+                                    uint32_t SubCubeID );
+
 int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
+                            Fxch_SCThread_t* pThread,
                             uint32_t SubCubeID,
                             uint32_t iCube,
                             uint32_t iLit0,
@@ -210,12 +258,20 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
 
 int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
+                            Fxch_SCThread_t* pThread,
                             uint32_t SubCubeID,
                             uint32_t iCube,
                             uint32_t iLit0,
                             uint32_t iLit1,
                             char fUpdate );
 
+int Fxch_SCHashTableApply( Fxch_SCHashTable_t* pSCHashTable,
+                           Vec_Int_t* vEvents,
+                           int* pPos,
+                           int iOp,
+                           char fAdd,
+                           char fUpdate );
+
 unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* );
 void Fxch_SCHashTablePrint( Fxch_SCHashTable_t* );
 
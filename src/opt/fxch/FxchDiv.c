@@ -98,7 +98,8 @@ static inline int Fxch_DivNormalize( Vec_Int_t* vCubeFree )
 
   Description [ This functions receive as input two sub-cubes and creates
                 a divisor using their information. The divisor is stored 
-                in vCubeFree vector of the pFxchMan structure.
+                in vCubeFree vector of the pFxchMan structure (or in the 
+                given vector, which is used by the threads).
                 
                 It returns the base value, which is the number of elements
                 that the cubes pair used to generate the devisor have in
@@ -109,9 +110,10 @@ static inline int Fxch_DivNormalize( Vec_Int_t* vCubeFree )
   SeeAlso     []
 
 ***********************************************************************/
-int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
-                    Fxch_SubCube_t* pSubCube0,
-                    Fxch_SubCube_t* pSubCube1 )
+int Fxch_DivCreateInt( Fxch_Man_t* pFxchMan,
+                       Vec_Int_t* vCubeFree,
+                       Fxch_SubCube_t* pSubCube0,
+                       Fxch_SubCube_t* pSubCube1 )
 {
     int Base = 0;
 
@@ -123,7 +125,7 @@ int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
     int Cube0Size,
         Cube1Size;
 
-    Vec_IntClear( pFxchMan->vCubeFree );
+    Vec_IntClear( vCubeFree );
 
     SC0_Lit0 = Fxch_ManGetLit( pFxchMan, pSubCube0->iCube, pSubCube0->iLit0 );
     SC0_Lit1 = 0;
@@ -132,8 +134,8 @@ int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
 
     if ( pSubCube0->iLit1 == 0 && pSubCube1->iLit1 == 0 )
     {
-        Vec_IntPush( pFxchMan->vCubeFree, SC0_Lit0 );
-        Vec_IntPush( pFxchMan->vCubeFree, SC1_Lit0 );
+        Vec_IntPush( vCubeFree, SC0_Lit0 );
+        Vec_IntPush( vCubeFree, SC1_Lit0 );
     }
     else if ( pSubCube0->iLit1 > 0 && pSubCube1->iLit1 > 0 )
     {
@@ -144,20 +146,20 @@ int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
 
         if ( SC0_Lit0 < SC1_Lit0 )
         {
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC0_Lit0, 0 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC1_Lit0, 1 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC0_Lit1, 0 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC1_Lit1, 1 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC0_Lit0, 0 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC1_Lit0, 1 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC0_Lit1, 0 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC1_Lit1, 1 ) );
         }
         else
         {
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC1_Lit0, 0 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC0_Lit0, 1 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC1_Lit1, 0 ) );
-            Vec_IntPush( pFxchMan->vCubeFree, Abc_Var2Lit( SC0_Lit1, 1 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC1_Lit0, 0 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC0_Lit0, 1 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC1_Lit1, 0 ) );
+            Vec_IntPush( vCubeFree, Abc_Var2Lit( SC0_Lit1, 1 ) );
         }
 
-        RetValue = Fxch_DivNormalize( pFxchMan->vCubeFree );
+        RetValue = Fxch_DivNormalize( vCubeFree );
         if ( RetValue == -1 )
             return -1;
     } 
@@ -167,41 +169,41 @@ int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
         {
             SC0_Lit1 = Fxch_ManGetLit( pFxchMan, pSubCube0->iCube, pSubCube0->iLit1 );
 
-            Vec_IntPush( pFxchMan->vCubeFree, SC1_Lit0 );
+            Vec_IntPush( vCubeFree, SC1_Lit0 );
             if ( SC0_Lit0 == Abc_LitNot( SC1_Lit0 ) )
-                Vec_IntPush( pFxchMan->vCubeFree, SC0_Lit1 );
+                Vec_IntPush( vCubeFree, SC0_Lit1 );
             else if ( SC0_Lit1 == Abc_LitNot( SC1_Lit0 ) )
-                Vec_IntPush( pFxchMan->vCubeFree, SC0_Lit0 );
+                Vec_IntPush( vCubeFree, SC0_Lit0 );
         }
         else 
         {
             SC1_Lit1 = Fxch_ManGetLit( pFxchMan, pSubCube1->iCube, pSubCube1->iLit1 );
 
-            Vec_IntPush( pFxchMan->vCubeFree, SC0_Lit0 );
+            Vec_IntPush( vCubeFree, SC0_Lit0 );
             if ( SC1_Lit0 == Abc_LitNot( SC0_Lit0 ) )
-                Vec_IntPush( pFxchMan->vCubeFree, SC1_Lit1 );
+                Vec_IntPush( vCubeFree, SC1_Lit1 );
             else if ( SC1_Lit1 == Abc_LitNot( SC0_Lit0 ) )
-                Vec_IntPush( pFxchMan->vCubeFree, SC1_Lit0 );
+                Vec_IntPush( vCubeFree, SC1_Lit0 );
         }
     }
 
-    if ( Vec_IntSize( pFxchMan->vCubeFree ) == 0 )
+    if ( Vec_IntSize( vCubeFree ) == 0 )
         return -1;
 
-    if ( Vec_IntSize ( pFxchMan->vCubeFree ) == 2 )
+    if ( Vec_IntSize ( vCubeFree ) == 2 )
     {
-        Vec_IntSort( pFxchMan->vCubeFree, 0 );
+        Vec_IntSort( vCubeFree, 0 );
 
-        Vec_IntWriteEntry( pFxchMan->vCubeFree, 0, Abc_Var2Lit( Vec_IntEntry( pFxchMan->vCubeFree, 0 ), 0 ) );
-        Vec_IntWriteEntry( pFxchMan->vCubeFree, 1, Abc_Var2Lit( Vec_IntEntry( pFxchMan->vCubeFree, 1 ), 1 ) );
+        Vec_IntWriteEntry( vCubeFree, 0, Abc_Var2Lit( Vec_IntEntry( vCubeFree, 0 ), 0 ) );
+        Vec_IntWriteEntry( vCubeFree, 1, Abc_Var2Lit( Vec_IntEntry( vCubeFree, 1 ), 1 ) );
     }
 
     Cube0Size = Vec_IntSize( Fxch_ManGetCube( pFxchMan, pSubCube0->iCube ) );
     Cube1Size = Vec_IntSize( Fxch_ManGetCube( pFxchMan, pSubCube1->iCube ) );
-    if ( Vec_IntSize( pFxchMan->vCubeFree ) % 2 == 0 )
+    if ( Vec_IntSize( vCubeFree ) % 2 == 0 )
     {
         Base = Abc_MinInt( Cube0Size, Cube1Size )
-               -( Vec_IntSize( pFxchMan->vCubeFree ) / 2)  - 1; /* 1 or 2 Lits, 1 SOP NodeID */
+               -( Vec_IntSize( vCubeFree ) / 2)  - 1; /* 1 or 2 Lits, 1 SOP NodeID */
     }
     else
         return -1;
@@ -209,6 +211,13 @@ int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
     return Base;
 }
 
+int Fxch_DivCreate( Fxch_Man_t* pFxchMan,
+                    Fxch_SubCube_t* pSubCube0,
+                    Fxch_SubCube_t* pSubCube1 )
+{
+    return Fxch_DivCreateInt( pFxchMan, pFxchMan->vCubeFree, pSubCube0, pSubCube1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [ Add a divisor to the divisors hash table. ]
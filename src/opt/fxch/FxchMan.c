@@ -19,6 +19,11 @@
 
 ABC_NAMESPACE_IMPL_START
 
+/* the number of cubes whose divisors are created in one batch */
+#define FXCH_BATCH_CUBES  1024
+/* the smallest number of sub-cube operations processed by the threads */
+#define FXCH_BATCH_MIN    256
+
 ////////////////////////////////////////////////////////////////////////
 ///                LOCAL FUNCTIONS DEFINITIONS                       ///
 ////////////////////////////////////////////////////////////////////////
@@ -32,15 +37,23 @@ static inline int Fxch_ManSCAddRemove( Fxch_Man_t* pFxchMan,
 {
     int ret = 0;
 
-    if ( fAdd )
+    if ( pFxchMan->fCollect )
+    {
+        Vec_IntPush( pFxchMan->vBatchOps, SubCubeID );
+        Vec_IntPush( pFxchMan->vBatchOps, iCube );
+        Vec_IntPush( pFxchMan->vBatchOps, iLit0 );
+        Vec_IntPush( pFxchMan->vBatchOps, iLit1 );
+        Vec_IntPush( pFxchMan->vBatchOps, Fxch_SCHashTableBinId( pFxchMan->pSCHashTable, SubCubeID ) );
+    }
+    else if ( fAdd )
     {
-        ret = Fxch_SCHashTableInsert( pFxchMan->pSCHashTable, pFxchMan->vCubes,
+        ret = Fxch_SCHashTableInsert( pFxchMan->pSCHashTable, pFxchMan->vCubes, NULL,
                                       SubCubeID,
                                       iCube, iLit0, iLit1, fUpdate );
     }
     else
     {
-        ret = Fxch_SCHashTableRemove( pFxchMan->pSCHashTable, pFxchMan->vCubes,
+        ret = Fxch_SCHashTableRemove( pFxchMan->pSCHashTable, pFxchMan->vCubes, NULL,
                                       SubCubeID,
                                       iCube, iLit0, iLit1, fUpdate );
     }
@@ -163,6 +176,123 @@ static inline void Fxch_ManCompressCubes( Vec_Wec_t* vCubes,
     Vec_IntShrink( vLit2Cube, k );
 }
 
+/* Updates the sub-cubes of the bins assigned to the thread */
+static int Fxch_ManDivBatchThread( void* pArg )
+{
+    Fxch_SCThread_t* pThread = (Fxch_SCThread_t*)pArg;
+    Fxch_Man_t* pFxchMan = pThread->pFxchMan;
+    int* pOps = Vec_IntArray( pFxchMan->vBatchOps );
+    int iOp,
+        nOps = Vec_IntSize( pFxchMan->vBatchOps ) / 5;
+
+    for ( iOp = 0; iOp < nOps; iOp++ )
+    {
+        int* pOp = pOps + 5 * iOp;
+        if ( pOp[4] % pThread->nThreads != pThread->iThread )
+            continue;
+        pThread->iOp = iOp;
+        if ( pThread->fAdd )
+            Fxch_SCHashTableInsert( pFxchMan->pSCHashTable, pFxchMan->vCubes, pThread,
+                                    pOp[0], pOp[1], pOp[2], pOp[3], 0 );
+        else
+            Fxch_SCHashTableRemove( pFxchMan->pSCHashTable, pFxchMan->vCubes, pThread,
+                                    pOp[0], pOp[1], pOp[2], pOp[3], 0 );
+    }
+    return 1;
+}
+
+/* Adds (or removes) the divisors of the given cubes
+ *
+ *   The result is the same as calling Fxch_ManDivSingleCube() and
+ *   Fxch_ManDivDoubleCube() for each cube in the given order. With
+ *   several threads, the sub-cube operations of all cubes are collected
+ *   first and the hash table bins are updated by the threads. Then the
+ *   single-cube divisors and the recorded pairs of sub-cubes are applied
+ *   in the order of the serial algorithm.
+ */
+static void Fxch_ManDivBatch( Fxch_Man_t* pFxchMan,
+                              int* pCubes,
+                              int nCubes,
+                              int fAdd,
+                              int fUpdate )
+{
+    Util_Task_t** pTasks;
+    int* pPos;
+    int i, k, iOp, nOps;
+
+    if ( pFxchMan->nProcs > 1 )
+    {
+        Vec_IntClear( pFxchMan->vBatchOps );
+        Vec_IntClear( pFxchMan->vBatchBeg );
+        pFxchMan->fCollect = 1;
+        for ( i = 0; i < nCubes; i++ )
+        {
+            Vec_IntPush( pFxchMan->vBatchBeg, Vec_IntSize( pFxchMan->vBatchOps ) / 5 );
+            if ( Vec_WecEntryEntry( pFxchMan->vCubes, pCubes[i], 0 ) == 0 )
+                Fxch_ManDivDoubleCube( pFxchMan, pCubes[i], fAdd, fUpdate );
+        }
+        Vec_IntPush( pFxchMan->vBatchBeg, Vec_IntSize( pFxchMan->vBatchOps ) / 5 );
+        pFxchMan->fCollect = 0;
+    }
+
+    nOps = pFxchMan->nProcs > 1 ? Vec_IntSize( pFxchMan->vBatchOps ) / 5 : 0;
+    if ( nOps < FXCH_BATCH_MIN )
+    {
+        for ( i = 0; i < nCubes; i++ )
+        {
+            Fxch_ManDivSingleCube( pFxchMan, pCubes[i], fAdd, fUpdate );
+            if ( Vec_WecEntryEntry( pFxchMan->vCubes, pCubes[i], 0 ) == 0 )
+                Fxch_ManDivDoubleCube( pFxchMan, pCubes[i], fAdd, fUpdate );
+        }
+        return;
+    }
+    pFxchMan->nBatchesPar++;
+
+    /* update the bins */
+    if ( pFxchMan->pThreads == NULL )
+        pFxchMan->pThreads = ABC_CALLOC( Fxch_SCThread_t, pFxchMan->nProcs );
+    pTasks = ABC_ALLOC( Util_Task_t*, pFxchMan->nProcs );
+    Util_PoolStart( pFxchMan->nProcs );
+    for ( k = 0; k < pFxchMan->nProcs; k++ )
+    {
+        Fxch_SCThread_t* pThread = pFxchMan->pThreads + k;
+        pThread->pFxchMan = pFxchMan;
+        pThread->iThread  = k;
+        pThread->nThreads = pFxchMan->nProcs;
+        pThread->fAdd     = (char)fAdd;
+        pThread->nEntries = 0;
+        Vec_IntClear( &pThread->vEvents );
+        pTasks[k] = Util_PoolSubmit( Fxch_ManDivBatchThread, pThread );
+    }
+    for ( k = 0; k < pFxchMan->nProcs; k++ )
+    {
+        Util_TaskWait( pTasks[k], 0 );
+        Util_TaskFree( pTasks[k] );
+        pFxchMan->pSCHashTable->nEntries += pFxchMan->pThreads[k].nEntries;
+    }
+    ABC_FREE( pTasks );
+
+    /* apply the divisors in the serial order */
+    pPos = ABC_CALLOC( int, pFxchMan->nProcs );
+    for ( i = 0; i < nCubes; i++ )
+    {
+        Fxch_ManDivSingleCube( pFxchMan, pCubes[i], fAdd, fUpdate );
+        for ( iOp = Vec_IntEntry( pFxchMan->vBatchBeg, i ); iOp < Vec_IntEntry( pFxchMan->vBatchBeg, i + 1 ); iOp++ )
+        {
+            int* pOp = Vec_IntEntryP( pFxchMan->vBatchOps, 5 * iOp );
+            int Owner = pOp[4] % pFxchMan->nProcs;
+            int Pairs = Fxch_SCHashTableApply( pFxchMan->pSCHashTable, &pFxchMan->pThreads[Owner].vEvents,
+                                               pPos + Owner, iOp, (char)fAdd, (char)fUpdate );
+            /* the pairs of the whole cube are not counted */
+            if ( pOp[2] > 0 )
+                pFxchMan->nPairsD += Pairs;
+        }
+    }
+    for ( k = 0; k < pFxchMan->nProcs; k++ )
+        assert( pPos[k] == Vec_IntSize( &pFxchMan->pThreads[k].vEvents ) );
+    ABC_FREE( pPos );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     PUBLIC INTERFACE                             ///
 ////////////////////////////////////////////////////////////////////////
@@ -186,6 +316,9 @@ Fxch_Man_t* Fxch_ManAlloc( Vec_Wec_t* vCubes )
     pFxchMan->vCubesToRemove = Vec_IntAlloc( 64 );
     pFxchMan->vSCC = Vec_IntAlloc( 64 );
 
+    pFxchMan->vBatchOps = Vec_IntAlloc( 1024 );
+    pFxchMan->vBatchBeg = Vec_IntAlloc( 64 );
+
     return pFxchMan;
 }
 
@@ -209,6 +342,21 @@ void Fxch_ManFree( Fxch_Man_t* pFxchMan )
     Vec_IntFree( pFxchMan->vCubesToRemove );
     Vec_IntFree( pFxchMan->vSCC );
 
+    Vec_IntFree( pFxchMan->vBatchOps );
+    Vec_IntFree( pFxchMan->vBatchBeg );
+    if ( pFxchMan->pThreads )
+    {
+        int i;
+        for ( i = 0; i < pFxchMan->nProcs; i++ )
+        {
+            Vec_IntErase( &pFxchMan->pThreads[i].vSubCube0 );
+            Vec_IntErase( &pFxchMan->pThreads[i].vSubCube1 );
+            Vec_IntErase( &pFxchMan->pThreads[i].vCubeFree );
+            Vec_IntErase( &pFxchMan->pThreads[i].vEvents );
+        }
+        ABC_FREE( pFxchMan->pThreads );
+    }
+
     ABC_FREE( pFxchMan );
 }
 
@@ -293,10 +441,21 @@ void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
         fUpdate = 0,
         iCube;
 
-    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+    if ( pFxchMan->nProcs > 1 )
     {
-        Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
-        Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
+        Vec_Int_t* vBatch = Vec_IntStartNatural( Vec_WecSize( pFxchMan->vCubes ) );
+        for ( iCube = 0; iCube < Vec_IntSize( vBatch ); iCube += FXCH_BATCH_CUBES )
+            Fxch_ManDivBatch( pFxchMan, Vec_IntEntryP( vBatch, iCube ),
+                              Abc_MinInt( FXCH_BATCH_CUBES, Vec_IntSize( vBatch ) - iCube ), fAdd, fUpdate );
+        Vec_IntFree( vBatch );
+    }
+    else
+    {
+        Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+        {
+            Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
+            Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
+        }
     }
 
     pFxchMan->vDivPrio = Vec_QueAlloc( Vec_FltSize( pFxchMan->vDivWeights ) );
@@ -632,21 +791,8 @@ void Fxch_ManUpdate( Fxch_Man_t* pFxchMan,
     assert( Vec_IntSize( pFxchMan->vPairs ) % 2 == 0 );
 
     /* subtract cost of single-cube divisors */
-    Vec_IntForEachEntry( pFxchMan->vCubesS, iCube0, i )
-    {
-        Fxch_ManDivSingleCube( pFxchMan, iCube0, 0, 1);
-
-        if ( Vec_WecEntryEntry( pFxchMan->vCubes, iCube0, 0 ) == 0 )
-            Fxch_ManDivDoubleCube( pFxchMan, iCube0, 0, 1 );
-    }
-
-    Vec_IntForEachEntry( pFxchMan->vPairs, iCube0, i )
-    {
-        Fxch_ManDivSingleCube( pFxchMan, iCube0, 0, 1);
-
-        if ( Vec_WecEntryEntry( pFxchMan->vCubes, iCube0, 0 ) == 0 )
-            Fxch_ManDivDoubleCube( pFxchMan, iCube0, 0, 1 );
-    }
+    Fxch_ManDivBatch( pFxchMan, Vec_IntArray( pFxchMan->vCubesS ), Vec_IntSize( pFxchMan->vCubesS ), 0, 1 );
+    Fxch_ManDivBatch( pFxchMan, Vec_IntArray( pFxchMan->vPairs ), Vec_IntSize( pFxchMan->vPairs ), 0, 1 );
 
     Vec_IntClear( pFxchMan->vCubesToUpdate );
     if ( Fxch_DivIsNotConstant1( pFxchMan->vDiv ) )
@@ -661,13 +807,7 @@ void Fxch_ManUpdate( Fxch_Man_t* pFxchMan,
     assert( Vec_IntSize( pFxchMan->vCubesToUpdate ) );
 
     /* Add cost */
-    Vec_IntForEachEntry( pFxchMan->vCubesToUpdate, iCube0, i )
-    {
-        Fxch_ManDivSingleCube( pFxchMan, iCube0, 1, 1 );
-
-        if ( Vec_WecEntryEntry( pFxchMan->vCubes, iCube0, 0 ) == 0 )
-            Fxch_ManDivDoubleCube( pFxchMan, iCube0, 1, 1 );
-    }
+    Fxch_ManDivBatch( pFxchMan, Vec_IntArray( pFxchMan->vCubesToUpdate ), Vec_IntSize( pFxchMan->vCubesToUpdate ), 1, 1 );
 
     /* Deal with SCC */
     if ( Vec_IntSize( pFxchMan->vSCC ) )
@@ -775,7 +915,10 @@ void Fxch_ManPrintStats( Fxch_Man_t* pFxchMan )
     printf( "Lits  =%8d  ", Vec_WecSizeUsed( pFxchMan->vLits ) );
     printf( "Divs  =%8d  ", Hsh_VecSize( pFxchMan->pDivHash ) );
     printf( "Divs+ =%8d  ", Vec_QueSize( pFxchMan->vDivPrio ) );
-    printf( "Extr  =%7d  \n", pFxchMan->nExtDivs );
+    printf( "Extr  =%7d  ", pFxchMan->nExtDivs );
+    if ( pFxchMan->nProcs > 1 )
+        printf( "Batch =%6d  ", pFxchMan->nBatchesPar );
+    printf( "\n" );
 }
 
 ////////////////////////////////////////////////////////////////////////
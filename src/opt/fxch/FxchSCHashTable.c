@@ -121,8 +121,18 @@ static inline Fxch_SCHashTable_Entry_t* Fxch_SCHashTableBin( Fxch_SCHashTable_t*
     return pSCHashTable->pBins + (SubCubeID & pSCHashTable->SizeMask);
 }
 
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable,
+                                    uint32_t SubCubeID )
+{
+    uint32_t BinID;
+    MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
+    return BinID & pSCHashTable->SizeMask;
+}
+
 static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable,
                                                 Vec_Wec_t* vCubes,
+                                                Vec_Int_t* vSubCube0,
+                                                Vec_Int_t* vSubCube1,
                                                 Fxch_SubCube_t* pSCData0,
                                                 Fxch_SubCube_t* pSCData1 )
 {
@@ -145,8 +155,8 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
     if ( Result == 0 )
         return 0;
 
-    Vec_IntClear( &pSCHashTable->vSubCube0 );
-    Vec_IntClear( &pSCHashTable->vSubCube1 );
+    Vec_IntClear( vSubCube0 );
+    Vec_IntClear( vSubCube1 );
 
     if ( pSCData0->iLit1 > 0 && pSCData1->iLit1 > 0 &&
          ( Vec_IntEntry( vCube0, pSCData0->iLit0 ) == Vec_IntEntry( vCube1, pSCData1->iLit0 ) ||
@@ -156,28 +166,96 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
         return 0;
 
     if ( pSCData0->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube0, vCube0, pSCData0->iLit0 );
+        Vec_IntAppendSkip( vSubCube0, vCube0, pSCData0->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube0, vCube0 );
+        Vec_IntAppend( vSubCube0, vCube0 );
 
     if ( pSCData1->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube1, vCube1, pSCData1->iLit0 );
+        Vec_IntAppendSkip( vSubCube1, vCube1, pSCData1->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube1, vCube1 );
+        Vec_IntAppend( vSubCube1, vCube1 );
 
     if ( pSCData0->iLit1 > 0)
-        Vec_IntDrop( &pSCHashTable->vSubCube0,
+        Vec_IntDrop( vSubCube0,
                        pSCData0->iLit0 < pSCData0->iLit1 ? pSCData0->iLit1 - 1 : pSCData0->iLit1 );
 
     if ( pSCData1->iLit1 > 0 )
-        Vec_IntDrop( &pSCHashTable->vSubCube1,
+        Vec_IntDrop( vSubCube1,
                        pSCData1->iLit0 < pSCData1->iLit1 ? pSCData1->iLit1 - 1 : pSCData1->iLit1 );
 
-    return Vec_IntEqual( &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 );
+    return Vec_IntEqual( vSubCube0, vSubCube1 );
+}
+
+/* Applies a pair of sub-cubes whose divisor is in vCubeFree of the manager */
+static inline void Fxch_SCHashTableAddPair( Fxch_Man_t* pFxchMan,
+                                            int Base,
+                                            int Result,
+                                            int iCube0,
+                                            int iCube1,
+                                            char fUpdate )
+{
+    int iNewDiv = -1, z;
+
+    for ( z = 0; z < Result; z++ )
+        iNewDiv = Fxch_DivAdd( pFxchMan, fUpdate, 0, Base );
+
+    Vec_WecPush( pFxchMan->vDivCubePairs, iNewDiv, iCube0 );
+    Vec_WecPush( pFxchMan->vDivCubePairs, iNewDiv, iCube1 );
+}
+
+static inline void Fxch_SCHashTableRemovePair( Fxch_Man_t* pFxchMan,
+                                               int Base,
+                                               int Result,
+                                               int iCubeNext,
+                                               int iCubeEntry,
+                                               char fUpdate )
+{
+    Vec_Int_t* vDivCubePairs;
+    int iDiv = -1, i, z,
+        iCube0,
+        iCube1;
+
+    for ( z = 0; z < Result; z++ )
+        iDiv = Fxch_DivRemove( pFxchMan, fUpdate, 0, Base );
+
+    vDivCubePairs = Vec_WecEntry( pFxchMan->vDivCubePairs, iDiv );
+    Vec_IntForEachEntryDouble( vDivCubePairs, iCube0, iCube1, i )
+        if ( ( iCube0 == iCubeNext && iCube1 == iCubeEntry )  ||
+             ( iCube0 == iCubeEntry && iCube1 == iCubeNext ) )
+        {
+            Vec_IntDrop( vDivCubePairs, i+1 );
+            Vec_IntDrop( vDivCubePairs, i );
+        }
+    if ( Vec_IntSize( vDivCubePairs ) == 0 )
+        Vec_IntErase( vDivCubePairs );
+}
+
+/* Records a pair of sub-cubes found by a thread */
+static inline void Fxch_SCHashTableRecord( Fxch_SCThread_t* pThread,
+                                           int fSCC,
+                                           int iCube0,
+                                           int iCube1,
+                                           int Base,
+                                           int Result )
+{
+    Vec_Int_t* vEvents = &pThread->vEvents;
+    int i;
+
+    assert( Vec_IntSize( &pThread->vCubeFree ) <= 4 );
+    Vec_IntPush( vEvents, pThread->iOp );
+    Vec_IntPush( vEvents, fSCC );
+    Vec_IntPush( vEvents, iCube0 );
+    Vec_IntPush( vEvents, iCube1 );
+    Vec_IntPush( vEvents, Base );
+    Vec_IntPush( vEvents, Result );
+    Vec_IntPush( vEvents, fSCC ? 0 : Vec_IntSize( &pThread->vCubeFree ) );
+    for ( i = 0; i < 4; i++ )
+        Vec_IntPush( vEvents, ( !fSCC && i < Vec_IntSize( &pThread->vCubeFree ) ) ? Vec_IntEntry( &pThread->vCubeFree, i ) : 0 );
 }
 
 int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
+                            Fxch_SCThread_t* pThread,
                             uint32_t SubCubeID,
                             uint32_t iCube,
                             uint32_t iLit0,
@@ -189,6 +267,9 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     uint32_t BinID;
     Fxch_SCHashTable_Entry_t* pBin;
     Fxch_SubCube_t* pNewEntry;
+    Vec_Int_t* vSubCube0 = pThread ? &pThread->vSubCube0 : &pSCHashTable->vSubCube0,
+             * vSubCube1 = pThread ? &pThread->vSubCube1 : &pSCHashTable->vSubCube1,
+             * vCubeFree = pThread ? &pThread->vCubeFree : pSCHashTable->pFxchMan->vCubeFree;
     int iEntry;
 
     MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
@@ -212,7 +293,10 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     pBin->vSCData[iNewEntry].iCube = iCube;
     pBin->vSCData[iNewEntry].iLit0 = iLit0;
     pBin->vSCData[iNewEntry].iLit1 = iLit1;
-    pSCHashTable->nEntries++;
+    if ( pThread )
+        pThread->nEntries++;
+    else
+        pSCHashTable->nEntries++;
 
     if ( pBin->Size == 1 )
         return 0;
@@ -225,34 +309,36 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
         int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
         int Result = 0;
         int Base;
-        int iNewDiv = -1, i, z;
+        int i;
 
         if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
             continue;
 
-        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry ) )
+        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, vSubCube0, vSubCube1, pEntry, pNewEntry ) )
             continue;
 
         if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
         {
             Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
                      * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+            int iCubeA = pEntry->iCube,
+                iCubeB = pNewEntry->iCube;
 
-            if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-            }
+            if ( Vec_IntSize( vCube0 ) <= Vec_IntSize( vCube1 ) )
+                ABC_SWAP( int, iCubeA, iCubeB );
+
+            if ( pThread )
+                Fxch_SCHashTableRecord( pThread, 1, iCubeA, iCubeB, 0, 0 );
             else
             {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, iCubeA );
+                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, iCubeB );
             }
 
             continue;
         }
 
-        Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+        Base = Fxch_DivCreateInt( pSCHashTable->pFxchMan, vCubeFree, pEntry, pNewEntry );
 
         if ( Base < 0 )
             continue;
@@ -260,11 +346,10 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
         for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
             Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
 
-        for ( z = 0; z < Result; z++ )
-            iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
-
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+        if ( pThread )
+            Fxch_SCHashTableRecord( pThread, 0, pEntry->iCube, pNewEntry->iCube, Base, Result );
+        else
+            Fxch_SCHashTableAddPair( pSCHashTable->pFxchMan, Base, Result, pEntry->iCube, pNewEntry->iCube, fUpdate );
 
         Pairs++;
     }
@@ -274,6 +359,7 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
 
 int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
+                            Fxch_SCThread_t* pThread,
                             uint32_t SubCubeID,
                             uint32_t iCube,
                             uint32_t iLit0,
@@ -285,6 +371,9 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
     uint32_t BinID;
     Fxch_SCHashTable_Entry_t* pBin;
     Fxch_SubCube_t* pEntry;
+    Vec_Int_t* vSubCube0 = pThread ? &pThread->vSubCube0 : &pSCHashTable->vSubCube0,
+             * vSubCube1 = pThread ? &pThread->vSubCube1 : &pSCHashTable->vSubCube1,
+             * vCubeFree = pThread ? &pThread->vCubeFree : pSCHashTable->pFxchMan->vCubeFree;
     int idx;
 
     MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
@@ -307,15 +396,10 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
     for ( idx = 0; idx < (int)pBin->Size; idx++ )
     if ( idx != iEntry )
     {
-        int Base,
-            iDiv = -1;
-
-        int i, z,
-            iCube0,
-            iCube1;
+        int Base;
+        int i;
 
         Fxch_SubCube_t* pNextEntry = &( pBin->vSCData[idx] );
-        Vec_Int_t* vDivCubePairs;
         int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
         int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNextEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
         int Result = 0;
@@ -323,12 +407,12 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
         if ( (pEntry->iLit1 != 0 && pNextEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNextEntry->iLit1 != 0)  )
             continue;
 
-        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNextEntry )
+        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, vSubCube0, vSubCube1, pEntry, pNextEntry )
              || pEntry->iLit0 == 0
              || pNextEntry->iLit0 == 0 )
             continue;
 
-        Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pNextEntry, pEntry );
+        Base = Fxch_DivCreateInt( pSCHashTable->pFxchMan, vCubeFree, pNextEntry, pEntry );
 
         if ( Base < 0 )
             continue;
@@ -336,19 +420,10 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
         for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
             Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
 
-        for ( z = 0; z < Result; z++ )
-            iDiv = Fxch_DivRemove( pSCHashTable->pFxchMan, fUpdate, 0, Base );
-
-        vDivCubePairs = Vec_WecEntry( pSCHashTable->pFxchMan->vDivCubePairs, iDiv );
-        Vec_IntForEachEntryDouble( vDivCubePairs, iCube0, iCube1, i )
-            if ( ( iCube0 == (int)pNextEntry->iCube && iCube1 == (int)pEntry->iCube )  ||
-                 ( iCube0 == (int)pEntry->iCube && iCube1 == (int)pNextEntry->iCube ) )
-            {
-                Vec_IntDrop( vDivCubePairs, i+1 );
-                Vec_IntDrop( vDivCubePairs, i );
-            }
-        if ( Vec_IntSize( vDivCubePairs ) == 0 )
-            Vec_IntErase( vDivCubePairs );
+        if ( pThread )
+            Fxch_SCHashTableRecord( pThread, 0, pNextEntry->iCube, pEntry->iCube, Base, Result );
+        else
+            Fxch_SCHashTableRemovePair( pSCHashTable->pFxchMan, Base, Result, pNextEntry->iCube, pEntry->iCube, fUpdate );
 
         Pairs++;
     }
@@ -359,6 +434,43 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
     return Pairs;
 }
 
+/* Applies the events recorded by a thread for the given operation of the batch */
+int Fxch_SCHashTableApply( Fxch_SCHashTable_t* pSCHashTable,
+                           Vec_Int_t* vEvents,
+                           int* pPos,
+                           int iOp,
+                           char fAdd,
+                           char fUpdate )
+{
+    Fxch_Man_t* pFxchMan = pSCHashTable->pFxchMan;
+    int Pairs = 0;
+
+    while ( *pPos < Vec_IntSize( vEvents ) && Vec_IntEntry( vEvents, *pPos ) == iOp )
+    {
+        int* pEvent = Vec_IntEntryP( vEvents, *pPos );
+        *pPos += FXCH_EVENT_SIZE;
+
+        if ( pEvent[1] )
+        {
+            Vec_IntPush( pFxchMan->vSCC, pEvent[2] );
+            Vec_IntPush( pFxchMan->vSCC, pEvent[3] );
+            continue;
+        }
+
+        Vec_IntClear( pFxchMan->vCubeFree );
+        Vec_IntPushArray( pFxchMan->vCubeFree, pEvent + 7, pEvent[6] );
+
+        if ( fAdd )
+            Fxch_SCHashTableAddPair( pFxchMan, pEvent[4], pEvent[5], pEvent[2], pEvent[3], fUpdate );
+        else
+            Fxch_SCHashTableRemovePair( pFxchMan, pEvent[4], pEvent[5], pEvent[2], pEvent[3], fUpdate );
+
+        Pairs++;
+    }
+
+    return Pairs;
+}
+
 unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* pHashTable )
 {
     unsigned int Memory = sizeof ( Fxch_SCHashTable_t );
@@ -28,6 +28,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the number of nodes tried concurrently in the parallel mode
+#define SFM_PAR_BATCH  256
+
+typedef struct Sfm_ParTask_t_ Sfm_ParTask_t;
+struct Sfm_ParTask_t_
+{
+    Sfm_Ntk_t *       pWork;       // the worker
+    Vec_Int_t *       vBatch;      // the nodes to try
+    Sfm_Upd_t *       pUpds;       // the changes found for the nodes
+    Vec_Wec_t *       vWins;       // the objects the outcomes depend on
+    int               iFirst;      // the first node of this task
+    int               nStep;       // the distance between the nodes of this task
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -52,6 +66,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -214,6 +229,16 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be made later
+    if ( p->pUpd )
+    {
+        p->pUpd->iNode     = iNode;
+        p->pUpd->f         = f;
+        p->pUpd->iFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->pUpd->uTruth    = uTruth;
+        Abc_TtCopy( p->pUpd->pTruth, p->pTruth, SFM_WORDS_MAX, 0 );
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,6 +305,17 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be made later
+    if ( p->pUpd )
+    {
+        p->pUpd->iNode     = iNode;
+        p->pUpd->f         = -1;
+        p->pUpd->iFaninNew = -1;
+        p->pUpd->uTruth    = uTruth;
+        return 1;
+    }
+    if ( p->vChanged )
+        Vec_IntPush( p->vChanged, iNode );
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
@@ -353,6 +389,193 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Tries the nodes of a batch assigned to one thread.]
+
+  Description [For each node, records the change found and the objects 
+  whose modification may make this change invalid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkPerformParTask( void * pArg )
+{
+    Sfm_ParTask_t * pTask = (Sfm_ParTask_t *)pArg;
+    Sfm_Ntk_t * p = pTask->pWork;
+    int k, iNode;
+    for ( k = pTask->iFirst; k < Vec_IntSize(pTask->vBatch); k += pTask->nStep )
+    {
+        Vec_Int_t * vWin = Vec_WecEntry( pTask->vWins, k );
+        iNode = Vec_IntEntry( pTask->vBatch, k );
+        p->pUpd = pTask->pUpds + k;
+        p->pUpd->iNode = -1;
+        Sfm_NodeResub( p, iNode );
+        p->pUpd = NULL;
+        // if the window was not created, the outcome depends on the part of TFI visited
+        Vec_IntClear( vWin );
+        Vec_IntPush( vWin, iNode );
+        Vec_IntAppend( vWin, Vec_IntSize(p->vOrder) ? p->vOrder : p->vNodes );
+    }
+    return 1;
+}
+static int Sfm_NtkPerformParIsStale( Sfm_Ntk_t * p, Vec_Int_t * vWin, Vec_Int_t * vMarks, int Mark )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vWin, iObj, i )
+        if ( Vec_IntEntry(vMarks, iObj) == Mark )
+            return 1;
+    return 0;
+}
+static void Sfm_NtkPerformParMark( Sfm_Ntk_t * p, Vec_Int_t * vMarks, int Mark )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( p->vChanged, iObj, i )
+        Vec_IntWriteEntry( vMarks, iObj, Mark );
+    Vec_IntClear( p->vChanged );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using several threads.]
+
+  Description [The nodes are divided into a fixed number of ranges 
+  of consecutive nodes, and a batch contains the next node of each range,
+  so that the nodes of a batch tend to be far apart and their windows 
+  rarely overlap. The nodes of a batch are tried concurrently on the 
+  current network; each thread has its own window and SAT solver, and 
+  the changes it finds are recorded rather than made. 
+  Then the main thread goes through the batch in order. If a previous 
+  change in this batch modified an object in the window of a node, the 
+  outcome for this node may be stale and the node is tried again on the 
+  current network; otherwise, the recorded change is made. As in the 
+  serial flow, a changed node is tried again until no more changes are 
+  found. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_Par_t * pPars = p->pPars;
+    Sfm_ParTask_t * pTasks = ABC_CALLOC( Sfm_ParTask_t, pPars->nProcs );
+    Util_Task_t ** ppTasks = ABC_ALLOC( Util_Task_t *, pPars->nProcs );
+    Sfm_Upd_t * pUpds = ABC_CALLOC( Sfm_Upd_t, SFM_PAR_BATCH );
+    Vec_Wec_t * vWins = Vec_WecStart( SFM_PAR_BATCH );
+    Vec_Int_t * vBatch = Vec_IntAlloc( SFM_PAR_BATCH );
+    Vec_Int_t * vMarks = Vec_IntStart( p->nObjs );
+    int pBegs[SFM_PAR_BATCH], pEnds[SFM_PAR_BATCH], i, k, s, t, iNode, Mark = 0, Counter = 0, nTried = 0, nStale = 0, nReused = 0;
+    abctime clk, clkPar = 0, clkSeq = 0;
+    p->vChanged = Vec_IntAlloc( 100 );
+    for ( t = 0; t < pPars->nProcs; t++ )
+    {
+        pTasks[t].pWork  = Sfm_NtkStartWorker( p );
+        pTasks[t].vBatch = vBatch;
+        pTasks[t].pUpds  = pUpds;
+        pTasks[t].vWins  = vWins;
+        pTasks[t].iFirst = t;
+        pTasks[t].nStep  = pPars->nProcs;
+    }
+    // divide the nodes into ranges, which are traversed in parallel
+    for ( s = 0; s < SFM_PAR_BATCH; s++ )
+    {
+        pBegs[s] = p->nPis + (int)((double)p->nNodes * s / SFM_PAR_BATCH);
+        pEnds[s] = p->nPis + (int)((double)p->nNodes * (s+1) / SFM_PAR_BATCH);
+    }
+    Util_PoolStart( pPars->nProcs );
+    while ( 1 )
+    {
+        // collect the next node of each range
+        Vec_IntClear( vBatch );
+        for ( s = 0; s < SFM_PAR_BATCH; s++ )
+            for ( ; pBegs[s] < pEnds[s]; pBegs[s]++ )
+            {
+                i = pBegs[s];
+                if ( Sfm_ObjIsFixed( p, i ) )
+                    continue;
+                if ( pPars->nDepthMax && Sfm_ObjLevel(p, i) > pPars->nDepthMax )
+                    continue;
+                if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+                {
+                    (*pCounterLarge)++;
+                    continue;
+                }
+                Vec_IntPush( vBatch, pBegs[s]++ );
+                break;
+            }
+        if ( Vec_IntSize(vBatch) == 0 )
+            break;
+        // try the nodes concurrently
+        clk = Abc_Clock();
+        for ( t = 0; t < pPars->nProcs; t++ )
+            ppTasks[t] = Util_PoolSubmit( Sfm_NtkPerformParTask, pTasks + t );
+        for ( t = 0; t < pPars->nProcs; t++ )
+        {
+            Util_TaskWait( ppTasks[t], 0 );
+            Util_TaskFree( ppTasks[t] );
+        }
+        clkPar += Abc_Clock() - clk;
+        // make the changes in order
+        clk = Abc_Clock();
+        nTried += Vec_IntSize(vBatch);
+        Mark++;
+        Vec_IntForEachEntry( vBatch, iNode, k )
+        {
+            Sfm_Upd_t * pUpd = pUpds + k;
+            if ( Sfm_NtkPerformParIsStale(p, Vec_WecEntry(vWins, k), vMarks, Mark) ||
+                 (pUpd->iNode >= 0 && pUpd->iFaninNew >= 0 && Sfm_ObjLevel(p, pUpd->iFaninNew) > p->nLevelMax - Sfm_ObjLevelR(p, iNode)) )
+            {
+                // the outcome may be different on the current network
+                int c;
+                nStale++;
+                for ( c = 0; Sfm_NodeResub(p, iNode); c++ );
+                Counter += (c > 0);
+            }
+            else if ( pUpd->iNode >= 0 )
+            {
+                nReused++;
+                if ( pUpd->f == -1 )
+                {
+                    Vec_IntPush( p->vChanged, iNode );
+                    Vec_WrdWriteEntry( p->vTruths, iNode, pUpd->uTruth );
+                    Sfm_TruthToCnf( pUpd->uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+                }
+                else
+                    Sfm_NtkUpdate( p, iNode, pUpd->f, pUpd->iFaninNew, pUpd->uTruth, pUpd->pTruth );
+                while ( Sfm_NodeResub(p, iNode) );
+                Counter++;
+            }
+            Sfm_NtkPerformParMark( p, vMarks, Mark );
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                break;
+        }
+        clkSeq += Abc_Clock() - clk;
+        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+            break;
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Tried %d nodes in %d ranges using %d threads. Changes reused = %d. Nodes tried again = %d (%.2f %%).\n", 
+            nTried, SFM_PAR_BATCH, pPars->nProcs, nReused, nStale, 100.0 * nStale / Abc_MaxInt(nTried, 1) );
+        ABC_PRT( "Concurrent", clkPar );
+        ABC_PRT( "Sequential", clkSeq );
+    }
+    for ( t = 0; t < pPars->nProcs; t++ )
+        Sfm_NtkStopWorker( pTasks[t].pWork, p );
+    Vec_IntFreeP( &p->vChanged );
+    Vec_IntFree( vMarks );
+    Vec_IntFree( vBatch );
+    Vec_WecFree( vWins );
+    ABC_FREE( pUpds );
+    ABC_FREE( ppTasks );
+    ABC_FREE( pTasks );
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -382,6 +605,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 && !pPars->fVeryVerbose )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -68,6 +68,17 @@ typedef struct Sfm_Lib_t_ Sfm_Lib_t;
 typedef struct Sfm_Tim_t_ Sfm_Tim_t;
 typedef struct Sfm_Mit_t_ Sfm_Mit_t;
 
+// the change of one node found by a thread (see Sfm_NtkPerformPar)
+typedef struct Sfm_Upd_t_ Sfm_Upd_t;
+struct Sfm_Upd_t_
+{
+    int               iNode;       // the node (-1 if there is no change)
+    int               f;           // the fanin to replace (-1 if the function is simplified)
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX];
+};
+
 struct Sfm_Ntk_t_
 {
     // parameters
@@ -129,6 +140,9 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // parallel mode
+    Sfm_Upd_t *       pUpd;        // if given, the change is recorded here instead of being made
+    Vec_Int_t *       vChanged;    // if given, collects the objects modified by the changes
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -223,6 +237,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
+extern Sfm_Ntk_t *  Sfm_NtkStartWorker( Sfm_Ntk_t * p );
+extern void         Sfm_NtkStopWorker( Sfm_Ntk_t * pWork, Sfm_Ntk_t * p );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
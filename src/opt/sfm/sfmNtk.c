@@ -253,6 +253,97 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the data of one thread.]
+
+  Description [The worker shares the network with the manager and has
+  its own traversal IDs, SAT variable maps, window and SAT solver.
+  The window construction temporarily changes the parameters, so each
+  worker gets its own copy of them.
+  The network should not be changed while the workers are running.
+  When the worker is stopped, its statistics are added to the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkStartWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    memcpy( pNew, p, sizeof(Sfm_Ntk_t) );
+    pNew->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    // traversal and SAT variables
+    Vec_IntZero( &pNew->vCounts );
+    Vec_IntZero( &pNew->vTravIds );
+    Vec_IntZero( &pNew->vTravIds2 );
+    Vec_IntZero( &pNew->vId2Var );
+    Vec_IntZero( &pNew->vVar2Id );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds  = 0;
+    pNew->nTravIds2 = 0;
+    pNew->vCover    = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    // window and SAT solver
+    Sfm_NtkPrepare( pNew );
+    pNew->nSatVars  = 0;
+    pNew->pUpd      = NULL;
+    pNew->vChanged  = NULL;
+    // statistics
+    pNew->nTryRemoves = pNew->nTryImproves = pNew->nTryResubs = 0;
+    pNew->nRemoves = pNew->nImproves = pNew->nResubs = 0;
+    pNew->nNodesTried = pNew->nTotalDivs = pNew->nSatCalls = pNew->nTimeOuts = pNew->nMaxDivs = 0;
+    pNew->timeWin = pNew->timeDiv = pNew->timeCnf = pNew->timeSat = 0;
+    return pNew;
+}
+void Sfm_NtkStopWorker( Sfm_Ntk_t * pWork, Sfm_Ntk_t * p )
+{
+    p->nTryRemoves  += pWork->nTryRemoves;
+    p->nTryImproves += pWork->nTryImproves;
+    p->nTryResubs   += pWork->nTryResubs;
+    p->nRemoves     += pWork->nRemoves;
+    p->nImproves    += pWork->nImproves;
+    p->nResubs      += pWork->nResubs;
+    p->nNodesTried  += pWork->nNodesTried;
+    p->nTotalDivs   += pWork->nTotalDivs;
+    p->nSatCalls    += pWork->nSatCalls;
+    p->nTimeOuts    += pWork->nTimeOuts;
+    p->nMaxDivs     += pWork->nMaxDivs;
+    p->timeWin      += pWork->timeWin;
+    p->timeDiv      += pWork->timeDiv;
+    p->timeCnf      += pWork->timeCnf;
+    p->timeSat      += pWork->timeSat;
+    ABC_FREE( pWork->vCounts.pArray );
+    ABC_FREE( pWork->vTravIds.pArray );
+    ABC_FREE( pWork->vTravIds2.pArray );
+    ABC_FREE( pWork->vId2Var.pArray );
+    ABC_FREE( pWork->vVar2Id.pArray );
+    Vec_IntFree( pWork->vCover );
+    Vec_IntFreeP( &pWork->vNodes );
+    Vec_IntFreeP( &pWork->vDivs  );
+    Vec_IntFreeP( &pWork->vRoots );
+    Vec_IntFreeP( &pWork->vTfo   );
+    Vec_WrdFreeP( &pWork->vDivCexes );
+    Vec_IntFreeP( &pWork->vOrder );
+    Vec_IntFreeP( &pWork->vDivVars );
+    Vec_IntFreeP( &pWork->vDivIds );
+    Vec_IntFreeP( &pWork->vLits  );
+    Vec_IntFreeP( &pWork->vValues );
+    Vec_WecFreeP( &pWork->vClauses );
+    Vec_IntFreeP( &pWork->vFaninMap );
+    if ( pWork->pSat ) sat_solver_delete( pWork->pSat );
+    ABC_FREE( pWork->pPars );
+    ABC_FREE( pWork );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
@@ -288,6 +379,8 @@ void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
 void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
+    if ( p->vChanged )
+        Vec_IntPush( p->vChanged, iNode );
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
@@ -326,6 +419,12 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+    if ( p->vChanged )
+    {
+        Vec_IntPush( p->vChanged, iNode );
+        if ( iFaninNew != -1 )
+            Vec_IntPush( p->vChanged, iFaninNew );
+    }
     if ( Abc_TtIsConst0(pTruth, nWords) || Abc_TtIsConst1(pTruth, nWords) )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
@@ -29,6 +29,19 @@ ABC_NAMESPACE_IMPL_START
 
 static void Gia_ManCorrSpecReduce_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int f, int nPrefix );
 
+#define CEC_CORR_CHUNK 256
+
+// a group of outputs of the speculatively reduced model solved by one task
+typedef struct Cec_CorrJob_t_ Cec_CorrJob_t;
+struct Cec_CorrJob_t_
+{
+    Gia_Man_t *      pPart;          // the cones of the outputs
+    int              iBeg;           // the first output
+    int              nConfs;         // conflict limit
+    Vec_Str_t *      vStatus;        // the status of each output
+    Vec_Int_t *      vCexStore;      // the counter-examples
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -821,7 +834,7 @@ void Cec_ManLSCorrespondenceBmc( Gia_Man_t * pAig, Cec_ParCor_t * pPars, int nPr
         if ( pPars->fUseCSat )
             vCexStore = Tas_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0 );
         else
-            vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
+            vCexStore = Cec_ManSatSolveMiterPar( pSrm, pParsSat, pPars->nProcs, &vStatus );
         // refine classes with these counter-examples
         if ( Vec_IntSize(vCexStore) )
         {
@@ -910,6 +923,148 @@ int Cec_ManLSCorrAnalyzeDependence( Gia_Man_t * p, Vec_Int_t * vEquivs, Vec_Str_
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the cones of the given outputs of SRM.]
+
+  Description [Keeps all the CIs, the relative order of the nodes and 
+  their fanout counts in SRM.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManCorrDupCones_rec( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vNodes )
+{
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p, pObj);
+    if ( !Gia_ObjIsAnd(pObj) )
+        return;
+    Cec_ManCorrDupCones_rec( p, Gia_ObjFanin0(pObj), vNodes );
+    Cec_ManCorrDupCones_rec( p, Gia_ObjFanin1(pObj), vNodes );
+    Vec_IntPush( vNodes, Gia_ObjId(p, pObj) );
+}
+static Gia_Man_t * Cec_ManCorrDupCones( Gia_Man_t * p, int iBeg, int iEnd, Vec_Int_t * vNodes )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( Gia_ManRegNum(p) == 0 );
+    Vec_IntClear( vNodes );
+    Gia_ManIncrementTravId( p );
+    for ( i = iBeg; i < iEnd; i++ )
+        Cec_ManCorrDupCones_rec( p, Gia_ObjFanin0(Gia_ManPo(p, i)), vNodes );
+    Vec_IntSort( vNodes, 0 );
+    pNew = Gia_ManStart( 1 + Gia_ManPiNum(p) + Vec_IntSize(vNodes) + iEnd - iBeg );
+    pNew->pRefs = ABC_CALLOC( int, 1 + Gia_ManPiNum(p) + Vec_IntSize(vNodes) + iEnd - iBeg );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachPi( p, pObj, i )
+    {
+        pObj->Value = Gia_ManAppendCi( pNew );
+        if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+            pNew->pRefs[Abc_Lit2Var(pObj->Value)] = Gia_ObjRefNum(p, pObj);
+    }
+    Gia_ManForEachObjVec( vNodes, p, pObj, i )
+    {
+        pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        pNew->pRefs[Abc_Lit2Var(pObj->Value)] = Gia_ObjRefNum(p, pObj);
+    }
+    for ( i = iBeg; i < iEnd; i++ )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(Gia_ManPo(p, i)) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one group of outputs using the circuit-based solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManCorrSolveJob( void * pArg )
+{
+    Cec_CorrJob_t * pJob = (Cec_CorrJob_t *)pArg;
+    pJob->vCexStore = Cbs_ManSolveMiterNcInt( pJob->pPart, pJob->nConfs, &pJob->vStatus, 0, 1, 0 );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of SRM using several threads.]
+
+  Description [With MiniSat, the threads share the SRM. The circuit-based
+  solver keeps its state in the AIG objects, so each group of outputs is
+  solved on a copy of its cones, which keeps all the CIs of SRM. The 
+  results are merged in the order of the outputs and do not depend on 
+  the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cec_ManCorrSolveMiter( Gia_Man_t * pSrm, Cec_ParCor_t * pPars, Cec_ParSat_t * pParsSat, Vec_Str_t ** pvStatus )
+{
+    Cec_CorrJob_t * pJobs;
+    Util_Task_t ** pTasks;
+    Vec_Int_t * vCexStore, * vNodes;
+    Vec_Str_t * vStatus;
+    int i, k, nJobs, Out, nLits;
+    if ( !pPars->fUseCSat )
+        return Cec_ManSatSolveMiterPar( pSrm, pParsSat, pPars->nProcs, pvStatus );
+    nJobs = (Gia_ManPoNum(pSrm) + CEC_CORR_CHUNK - 1) / CEC_CORR_CHUNK;
+    if ( pPars->nProcs < 2 || nJobs < 2 )
+        return Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, pvStatus, 0, 0 );
+    // extract the groups of outputs
+    if ( pSrm->pRefs == NULL )
+        Gia_ManCreateRefs( pSrm );
+    vNodes = Vec_IntAlloc( 1000 );
+    pJobs  = ABC_CALLOC( Cec_CorrJob_t, nJobs );
+    pTasks = ABC_CALLOC( Util_Task_t *, nJobs );
+    Util_PoolStart( pPars->nProcs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pPart  = Cec_ManCorrDupCones( pSrm, k * CEC_CORR_CHUNK, Abc_MinInt((k + 1) * CEC_CORR_CHUNK, Gia_ManPoNum(pSrm)), vNodes );
+        pJobs[k].iBeg   = k * CEC_CORR_CHUNK;
+        pJobs[k].nConfs = pPars->nBTLimit;
+        assert( Gia_ManPiNum(pJobs[k].pPart) == Gia_ManPiNum(pSrm) );
+        pTasks[k] = Util_PoolSubmit( Cec_ManCorrSolveJob, pJobs + k );
+    }
+    Vec_IntFree( vNodes );
+    // merge the results
+    vStatus   = Vec_StrAlloc( Gia_ManPoNum(pSrm) );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        Util_TaskWait( pTasks[k], 0 );
+        Util_TaskFree( pTasks[k] );
+        Vec_StrPushBuffer( vStatus, Vec_StrArray(pJobs[k].vStatus), Vec_StrSize(pJobs[k].vStatus) );
+        // renumber the outputs in the counter-examples
+        for ( i = 0; i < Vec_IntSize(pJobs[k].vCexStore); )
+        {
+            Out   = Vec_IntEntry( pJobs[k].vCexStore, i++ );
+            nLits = Vec_IntEntry( pJobs[k].vCexStore, i++ );
+            Vec_IntPushTwo( vCexStore, pJobs[k].iBeg + Out, nLits );
+            for ( ; nLits > 0; nLits-- )
+                Vec_IntPush( vCexStore, Vec_IntEntry(pJobs[k].vCexStore, i++) );
+        }
+        Vec_StrFree( pJobs[k].vStatus );
+        Vec_IntFree( pJobs[k].vCexStore );
+        Gia_ManStop( pJobs[k].pPart );
+    }
+    assert( Vec_StrSize(vStatus) == Gia_ManPoNum(pSrm) );
+    ABC_FREE( pTasks );
+    ABC_FREE( pJobs );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Internal procedure for register correspondence.]
@@ -1010,10 +1165,7 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
 //Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
         // found counter-examples to speculation
         clk2 = Abc_Clock();
-        if ( pPars->fUseCSat )
-            vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0, 0 );
-        else
-            vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
+        vCexStore = Cec_ManCorrSolveMiter( pSrm, pPars, pParsSat, &vStatus );
         Gia_ManStop( pSrm );
         clkSat += Abc_Clock() - clk2;
         if ( Vec_IntSize(vCexStore) == 0 )
@@ -26,6 +26,11 @@
 #include "proof/pdr/pdr.h"
 #include "proof/cec/cec.h"
 #include "proof/ssw/ssw.h"
+#include "sat/cnf/cnf.h"
+#include "sat/glucose2/AbcGlucose2.h"
+#include "sat/satoko/satoko.h"
+#include "sat/cadical/cadicalSolver.h"
+#include "sat/kissat/kissatSolver.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -55,6 +60,7 @@ static int Cec_SProveCallback( void * pUser, int fSolved, unsigned Result );
 
 #ifndef ABC_USE_PTHREADS
 
+int Cec_GiaProvePortfolio( Gia_Man_t * p, int nProcs, int nTimeOut, int fVerbose, int fSilent ) { return -1; }
 int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
@@ -312,6 +318,413 @@ int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int Re
     return RetValue;
 }
     
+/**Function*************************************************************
+
+  Synopsis    [SAT portfolio for combinational problems.]
+
+  Description [Several SAT solvers work on the same CNF. Short learned
+  clauses (units, binaries, and clauses up to PAR_CLA_MAX literals with
+  LBD at most 2) are published in a ring shared by all members. The
+  incremental solvers (glucose2, cadical, satoko) solve in slices with
+  growing conflict limits, and between the slices they publish their
+  learned clauses and add the clauses published by others. Kissat is
+  not incremental and does not report learned clauses, so it runs the
+  whole problem on its own until it is solved or stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+
+#define PAR_CLA_MAX    8          // the largest shared clause
+#define PAR_RING_MAX   (1<<16)    // the number of clauses kept in the ring
+#define PAR_SLICE_MIN  1000       // the conflict limit of the first slice
+#define PAR_SLICE_MAX  64000      // the conflict limit of the largest slice
+
+enum { PAR_GLUCOSE2, PAR_CADICAL, PAR_SATOKO, PAR_KISSAT, PAR_SOLVER_NUM };
+static const char * s_ParSolverNames[PAR_SOLVER_NUM] = { "glucose2", "cadical", "satoko", "kissat" };
+
+typedef struct Par_Cla_t_ Par_Cla_t;
+struct Par_Cla_t_
+{
+    int             iMember;            // the member that learned the clause
+    int             nLits;              // the number of literals
+    int             pLits[PAR_CLA_MAX]; // the literals
+};
+typedef struct Par_Ring_t_ Par_Ring_t;
+struct Par_Ring_t_
+{
+    pthread_mutex_t Mutex;              // protects the ring and the result
+    Par_Cla_t *     pClas;              // the ring of shared clauses
+    word            nWritten;           // the number of clauses ever written
+    Cnf_Dat_t *     pCnf;               // the CNF solved by all members
+    abctime         clkStop;            // the runtime limit
+    volatile int    fStop;              // set when the problem is solved
+    int             iWinner;            // the member that solved the problem
+    int             Result;             // the result of the winner (1 = SAT; -1 = UNSAT)
+    Vec_Int_t *     vModel;             // the values of the CNF variables if SAT
+};
+typedef struct Par_Member_t_ Par_Member_t;
+struct Par_Member_t_
+{
+    Par_Ring_t *    pRing;              // the shared clause ring
+    int             iMember;            // the member number
+    int             iSolver;            // the solver type
+    void *          pSat;               // the solver
+    word            iRead;              // the number of ring clauses seen
+    Vec_Int_t *     vExport;            // clauses learned since the last slice
+    Vec_Int_t *     vImport;            // clauses of others read from the ring
+    Vec_Int_t *     vTemp;              // temporary clause
+    int             nExport;            // the number of exported clauses
+    int             nImport;            // the number of imported clauses
+    int             nConfs;             // the number of conflicts
+    abctime         clkTotal;           // the runtime
+};
+
+static int Cec_GiaPortTerminate( void * pUser )
+{
+    Par_Ring_t * pRing = ((Par_Member_t *)pUser)->pRing;
+    return pRing->fStop || (pRing->clkStop && Abc_Clock() > pRing->clkStop);
+}
+static void Cec_GiaPortLearn( void * pUser, int * pLits, int nLits, int nLbd )
+{
+    Par_Member_t * pMem = (Par_Member_t *)pUser;
+    int i;
+    if ( nLits > PAR_CLA_MAX || (nLits > 2 && nLbd > 2) )
+        return;
+    for ( i = 0; i < nLits; i++ )
+        if ( Abc_Lit2Var(pLits[i]) >= pMem->pRing->pCnf->nVars )
+            return;
+    Vec_IntPush( pMem->vExport, nLits );
+    Vec_IntPushArray( pMem->vExport, pLits, nLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Uniform interface to the solvers of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_GiaPortSatStart( Par_Member_t * pMem )
+{
+    Par_Ring_t * pRing = pMem->pRing;
+    int nVars = pRing->pCnf->nVars;
+    if ( pMem->iSolver == PAR_GLUCOSE2 )
+    {
+        bmcg2_sat_solver * pSat = bmcg2_sat_solver_start();
+        bmcg2_sat_solver_set_nvars( pSat, nVars );
+        bmcg2_sat_solver_set_stop( pSat, (int *)&pRing->fStop );
+        bmcg2_sat_solver_set_runtime_limit( pSat, pRing->clkStop );
+        bmcg2_sat_solver_set_learn_callback( pSat, pMem, Cec_GiaPortLearn );
+        pMem->pSat = pSat;
+    }
+    else if ( pMem->iSolver == PAR_CADICAL )
+    {
+        cadical_solver * pSat = cadical_solver_new();
+        cadical_solver_setnvars( pSat, nVars );
+        cadical_solver_set_terminate( pSat, pMem, Cec_GiaPortTerminate );
+        cadical_solver_set_learn( pSat, 2, pMem, Cec_GiaPortLearn );
+        pMem->pSat = pSat;
+    }
+    else if ( pMem->iSolver == PAR_SATOKO )
+    {
+        satoko_t * pSat = satoko_create();
+        satoko_setnvars( pSat, nVars );
+        satoko_set_stop( pSat, (int *)&pRing->fStop );
+        satoko_set_runtime_limit( pSat, pRing->clkStop );
+        satoko_set_learn_callback( pSat, pMem, Cec_GiaPortLearn );
+        pMem->pSat = pSat;
+    }
+    else if ( pMem->iSolver == PAR_KISSAT )
+    {
+        kissat_solver * pSat = kissat_solver_new();
+        kissat_solver_setnvars( pSat, nVars );
+        kissat_solver_set_terminate( pSat, pMem, Cec_GiaPortTerminate );
+        pMem->pSat = pSat;
+    }
+    else assert( 0 );
+}
+static void Cec_GiaPortSatStop( Par_Member_t * pMem )
+{
+    if ( pMem->iSolver == PAR_GLUCOSE2 )
+    {
+        pMem->nConfs = bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)pMem->pSat );
+        bmcg2_sat_solver_stop( (bmcg2_sat_solver *)pMem->pSat );
+    }
+    else if ( pMem->iSolver == PAR_CADICAL )
+    {
+        pMem->nConfs = cadical_solver_nconflicts( (cadical_solver *)pMem->pSat );
+        cadical_solver_delete( (cadical_solver *)pMem->pSat );
+    }
+    else if ( pMem->iSolver == PAR_SATOKO )
+    {
+        pMem->nConfs = satoko_conflictnum( (satoko_t *)pMem->pSat );
+        satoko_destroy( (satoko_t *)pMem->pSat );
+    }
+    else if ( pMem->iSolver == PAR_KISSAT )
+        kissat_solver_delete( (kissat_solver *)pMem->pSat );
+    pMem->pSat = NULL;
+}
+static int Cec_GiaPortSatAddClause( Par_Member_t * pMem, int * pBeg, int * pEnd )
+{
+    if ( pMem->iSolver == PAR_GLUCOSE2 )
+        return bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)pMem->pSat, pBeg, pEnd - pBeg );
+    if ( pMem->iSolver == PAR_CADICAL )
+        return cadical_solver_addclause( (cadical_solver *)pMem->pSat, pBeg, pEnd );
+    if ( pMem->iSolver == PAR_SATOKO ) // satoko sorts the literals in place
+    {
+        Vec_IntClear( pMem->vTemp );
+        Vec_IntPushArray( pMem->vTemp, pBeg, pEnd - pBeg );
+        return satoko_add_clause( (satoko_t *)pMem->pSat, Vec_IntArray(pMem->vTemp), Vec_IntSize(pMem->vTemp) ) == SATOKO_OK;
+    }
+    return kissat_solver_addclause( (kissat_solver *)pMem->pSat, pBeg, pEnd );
+}
+static int Cec_GiaPortSatSolve( Par_Member_t * pMem, int nConfs )
+{
+    if ( pMem->iSolver == PAR_GLUCOSE2 )
+    {
+        bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)pMem->pSat, nConfs );
+        return bmcg2_sat_solver_solve( (bmcg2_sat_solver *)pMem->pSat, NULL, 0 );
+    }
+    if ( pMem->iSolver == PAR_CADICAL )
+        return cadical_solver_solve( (cadical_solver *)pMem->pSat, NULL, NULL, nConfs, 0, 0, 0 );
+    if ( pMem->iSolver == PAR_SATOKO ) // the conflict counter is reset by each call
+    {
+        satoko_options( (satoko_t *)pMem->pSat )->conf_limit = nConfs;
+        return satoko_solve( (satoko_t *)pMem->pSat );
+    }
+    return kissat_solver_solve( (kissat_solver *)pMem->pSat, NULL, NULL, 0, 0, 0, 0 );
+}
+static int Cec_GiaPortSatValue( Par_Member_t * pMem, int iVar )
+{
+    if ( pMem->iSolver == PAR_GLUCOSE2 )
+        return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)pMem->pSat, iVar );
+    if ( pMem->iSolver == PAR_CADICAL )
+        return cadical_solver_get_var_value( (cadical_solver *)pMem->pSat, iVar );
+    if ( pMem->iSolver == PAR_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)pMem->pSat, iVar );
+    return kissat_solver_get_var_value( (kissat_solver *)pMem->pSat, iVar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the learned clauses and collects those of others.]
+
+  Description [Readers that fell behind by more than the ring size skip
+  the overwritten clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_GiaPortExchange( Par_Member_t * pMem )
+{
+    Par_Ring_t * pRing = pMem->pRing;
+    Par_Cla_t * pCla;
+    int i, nLits;
+    Vec_IntClear( pMem->vImport );
+    pthread_mutex_lock( &pRing->Mutex );
+    for ( i = 0; i < Vec_IntSize(pMem->vExport); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( pMem->vExport, i );
+        pCla = pRing->pClas + (pRing->nWritten++ % PAR_RING_MAX);
+        pCla->iMember = pMem->iMember;
+        pCla->nLits   = nLits;
+        memcpy( pCla->pLits, Vec_IntEntryP(pMem->vExport, i+1), sizeof(int) * nLits );
+        pMem->nExport++;
+    }
+    if ( pMem->iRead + PAR_RING_MAX < pRing->nWritten )
+        pMem->iRead = pRing->nWritten - PAR_RING_MAX;
+    for ( ; pMem->iRead < pRing->nWritten; pMem->iRead++ )
+    {
+        pCla = pRing->pClas + (pMem->iRead % PAR_RING_MAX);
+        if ( pCla->iMember == pMem->iMember )
+            continue;
+        Vec_IntPush( pMem->vImport, pCla->nLits );
+        Vec_IntPushArray( pMem->vImport, pCla->pLits, pCla->nLits );
+    }
+    pthread_mutex_unlock( &pRing->Mutex );
+    Vec_IntClear( pMem->vExport );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one member of the portfolio.]
+
+  Description [Returns 1 if SAT, -1 if UNSAT, and 0 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_GiaPortMemberThread( void * pArg )
+{
+    Par_Member_t * pMem = (Par_Member_t *)pArg;
+    Par_Ring_t * pRing = pMem->pRing;
+    Cnf_Dat_t * pCnf = pRing->pCnf;
+    int i, nLits, nSlice = PAR_SLICE_MIN, Result = 0, fUnsat = 0;
+    abctime clk = Abc_Clock();
+    Cec_GiaPortSatStart( pMem );
+    for ( i = 0; i < pCnf->nClauses && !fUnsat; i++ )
+        fUnsat = !Cec_GiaPortSatAddClause( pMem, pCnf->pClauses[i], pCnf->pClauses[i+1] );
+    while ( !fUnsat && !Cec_GiaPortTerminate(pMem) )
+    {
+        Result = Cec_GiaPortSatSolve( pMem, nSlice );
+        if ( Result != 0 || pMem->iSolver == PAR_KISSAT )
+            break;
+        Cec_GiaPortExchange( pMem );
+        for ( i = 0; i < Vec_IntSize(pMem->vImport) && !fUnsat; i += nLits + 1 )
+        {
+            int * pLits = Vec_IntEntryP( pMem->vImport, i+1 );
+            nLits  = Vec_IntEntry( pMem->vImport, i );
+            fUnsat = !Cec_GiaPortSatAddClause( pMem, pLits, pLits + nLits );
+            pMem->nImport++;
+        }
+        nSlice = Abc_MinInt( 2 * nSlice, PAR_SLICE_MAX );
+    }
+    if ( fUnsat )
+        Result = -1;
+    pthread_mutex_lock( &pRing->Mutex );
+    if ( Result != 0 && pRing->iWinner == -1 )
+    {
+        pRing->iWinner = pMem->iMember;
+        pRing->Result  = Result;
+        pRing->fStop   = 1;
+        if ( Result == 1 )
+        {
+            pRing->vModel = Vec_IntAlloc( pCnf->nVars );
+            for ( i = 0; i < pCnf->nVars; i++ )
+                Vec_IntPush( pRing->vModel, Cec_GiaPortSatValue(pMem, i) );
+        }
+    }
+    pthread_mutex_unlock( &pRing->Mutex );
+    Cec_GiaPortSatStop( pMem );
+    pMem->clkTotal = Abc_Clock() - clk;
+    return Result;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the combinational miter using the SAT portfolio.]
+
+  Description [The outputs are ORed and the resulting CNF is derived
+  in the calling thread, because the CNF manager is global. Each member
+  runs a different solver, so there are at most PAR_SOLVER_NUM members;
+  more members would repeat the same search. Returns 1 if UNSAT, 0 if SAT (with the counter-example in p->pCexComb),
+  and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaProvePortfolio( Gia_Man_t * p, int nProcs, int nTimeOut, int fVerbose, int fSilent )
+{
+    Util_Task_t * pTasks[PAR_THR_MAX];
+    Par_Member_t * pMems, * pMem;
+    Par_Ring_t Ring, * pRing = &Ring;
+    Gia_Man_t * pOne;
+    Gia_Obj_t * pObj;
+    Aig_Man_t * pAig;
+    int i, iVar, * pModel, RetValue = -1;
+    abctime clkTotal = Abc_Clock();
+    assert( Gia_ManRegNum(p) == 0 );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, PAR_SOLVER_NUM) );
+    Abc_CexFreeP( &p->pCexComb );
+    // derive the CNF of the OR of the outputs
+    pOne = Gia_ManDupAndOr( p, 1, 1, 0 );
+    pAig = Gia_ManToAigSimple( pOne );
+    pAig->nRegs = 0;
+    memset( pRing, 0, sizeof(Par_Ring_t) );
+    pRing->pCnf    = Cnf_Derive( pAig, 0 );
+    pRing->pClas   = ABC_CALLOC( Par_Cla_t, PAR_RING_MAX );
+    pRing->clkStop = nTimeOut ? Abc_Clock() + (abctime)nTimeOut * CLOCKS_PER_SEC : 0;
+    pRing->iWinner = -1;
+    pthread_mutex_init( &pRing->Mutex, NULL );
+    Aig_ManStop( pAig );
+    if ( !fSilent && fVerbose )
+        printf( "Running SAT portfolio with %d members on CNF with %d vars and %d clauses. TimeOut = %d sec.\n",
+            nProcs, pRing->pCnf->nVars, pRing->pCnf->nClauses, nTimeOut );
+    // run the members
+    pMems = ABC_CALLOC( Par_Member_t, nProcs );
+    Util_PoolStart( nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pMem = pMems + i;
+        pMem->pRing   = pRing;
+        pMem->iMember = i;
+        pMem->iSolver = i;
+        pMem->vExport = Vec_IntAlloc( 1000 );
+        pMem->vImport = Vec_IntAlloc( 1000 );
+        pMem->vTemp   = Vec_IntAlloc( 100 );
+        pTasks[i] = Util_PoolSubmit( Cec_GiaPortMemberThread, pMem );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Util_TaskWait( pTasks[i], 0 );
+        Util_TaskFree( pTasks[i] );
+    }
+    // derive the counter-example
+    if ( pRing->iWinner >= 0 )
+        RetValue = pRing->Result == 1 ? 0 : 1;
+    if ( RetValue == 0 )
+    {
+        pModel = ABC_CALLOC( int, Gia_ManPiNum(p) );
+        Gia_ManForEachPi( pOne, pObj, i )
+            if ( (iVar = pRing->pCnf->pVarNums[Gia_ObjId(pOne, pObj)]) >= 0 )
+                pModel[i] = Vec_IntEntry( pRing->vModel, iVar );
+        p->pCexComb = Abc_CexCreate( 0, Gia_ManPiNum(p), pModel, 0, 0, 0 );
+        p->pCexComb->iPo = Gia_ManFindFailedPoCex( p, p->pCexComb, 0 );
+        assert( p->pCexComb->iPo >= 0 );
+        ABC_FREE( pModel );
+    }
+    if ( !fSilent && fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            pMem = pMems + i;
+            printf( "%c Member %d (%-8s) : Conf = %9d  Export = %8d  Import = %8d  ", i == pRing->iWinner ? '*' : ' ',
+                i, s_ParSolverNames[pMem->iSolver], pMem->nConfs, pMem->nExport, pMem->nImport );
+            Abc_PrintTime( 1, "Time", pMem->clkTotal );
+        }
+    }
+    if ( !fSilent )
+    {
+        printf( "Problem \"%s\" is ", p->pSpec );
+        if ( RetValue == 0 )
+            printf( "SATISFIABLE (solved by %s).", s_ParSolverNames[pMems[pRing->iWinner].iSolver] );
+        else if ( RetValue == 1 )
+            printf( "UNSATISFIABLE (solved by %s).", s_ParSolverNames[pMems[pRing->iWinner].iSolver] );
+        else
+            printf( "UNDECIDED." );
+        printf( "   " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        fflush( stdout );
+    }
+    // clean up
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_IntFree( pMems[i].vExport );
+        Vec_IntFree( pMems[i].vImport );
+        Vec_IntFree( pMems[i].vTemp );
+    }
+    ABC_FREE( pMems );
+    pthread_mutex_destroy( &pRing->Mutex );
+    Vec_IntFreeP( &pRing->vModel );
+    ABC_FREE( pRing->pClas );
+    Cnf_DataFree( pRing->pCnf );
+    Gia_ManStop( pOne );
+    return RetValue;
+}
+
 int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkScorr = 0, clkTotal = Abc_Clock();
@@ -319,6 +732,8 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     pthread_t WorkerThread[PAR_THR_MAX];
     Par_Share_t Share;
     int i, RetValue = -1, RetEngine = -2;
+    if ( Gia_ManRegNum(p) == 0 )
+        return Cec_GiaProvePortfolio( p, nProcs, nTimeOut3, fVerbose, fSilent );
     memset( &Share, 0, sizeof(Par_Share_t) );
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );        
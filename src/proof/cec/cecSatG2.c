@@ -20,6 +20,8 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
+#include "misc/vec/vecHsh.h"
 #include "cec.h"
 #include "bdd/extrab/extraBdd.h"
 #include "base/abc/abc.h"
@@ -105,6 +107,7 @@ struct Cec4_Man_t_
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
     Vec_Int_t *      vPairs;   
+    Vec_Int_t *      vMerged;        // nodes proved by parallel sweeping
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -135,6 +138,7 @@ struct Cec4_Man_t_
     abctime          timeSatSat;
     abctime          timeSatUnsat;
     abctime          timeSatUndec;
+    abctime          timeSatPar;
     abctime          timeSim;
     abctime          timeRefine;
     abctime          timeResimGlo;
@@ -303,7 +307,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
-        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec;
+        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec + p->timeSatPar;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats;// - p->timeResimGlo;
         ABC_PRTP( "SAT solving  ", timeSat,          timeTotal );
         ABC_PRTP( "  sat(easy)  ", p->timeSatSat0,   timeTotal );
@@ -311,6 +315,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
         ABC_PRTP( "  unsat(easy)", p->timeSatUnsat0, timeTotal );
         ABC_PRTP( "  unsat      ", p->timeSatUnsat,  timeTotal );
         ABC_PRTP( "  fail       ", p->timeSatUndec,  timeTotal );
+        ABC_PRTP( "  parallel   ", p->timeSatPar,    timeTotal );
         ABC_PRTP( "Generate CNF ", p->timeCnf,       timeTotal );
         ABC_PRTP( "Generate pats", p->timeGenPats,   timeTotal );
         ABC_PRTP( "Simulation   ", p->timeSim,       timeTotal );
@@ -335,6 +340,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vCexMin );
     Vec_IntFreeP( &p->vClassUpdates );
     Vec_IntFreeP( &p->vCexStamps );
+    Vec_IntFreeP( &p->vMerged );
     Vec_IntFreeP( &p->vCands );
     Vec_IntFreeP( &p->vVisit );
     Vec_IntFreeP( &p->vPat );
@@ -862,50 +868,26 @@ static inline void Cec4_ObjSimRo( Gia_Man_t * p, int iObj )
 }
 static inline void Cec4_ObjSimCo( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSimCo  = Cec4_ObjSim( p, iObj );
     word * pSimDri = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] = ~pSimDri[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSimCo[w] =  pSimDri[w];
+    Abc_SimdCopy( pSimCo, pSimDri, Gia_ObjFaninC0(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Abc_SimdAnd( pSim, pSim0, Gia_ObjFaninC0(pObj), pSim1, Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] ^ pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] =  pSim0[w] ^ pSim1[w];
+    Abc_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline void Cec4_ObjSimCi( Gia_Man_t * p, int iObj )
 {
@@ -1858,6 +1840,410 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [Before the sequential sweep, the candidate nodes are 
+  processed in waves of increasing logic level. In each wave, the pairs 
+  (node and its representative selected by the latest counter-examples) 
+  are solved by several threads. Each thread owns a SAT solver, which is 
+  kept across the waves, and loads the CNF of the fanin cones in the 
+  user's AIG, in which the nodes proved in the previous waves are replaced 
+  by their representatives. This gives the solvers the same merged 
+  structure that the sequential sweep builds in the new AIG. The 
+  counter-examples are added to the simulation info between the waves. 
+  The undecided candidates are handled by the sequential sweep.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec4_ParJob_t_ Cec4_ParJob_t;
+struct Cec4_ParJob_t_
+{
+    Gia_Man_t *      p;              // user's AIG
+    Cec_ParFra_t *   pPars;          // parameters
+    Vec_Bit_t *      vCoDrivers;     // CO drivers
+    Vec_Int_t *      vMerged;        // literals of the nodes proved in the previous waves
+    Vec_Int_t *      vPairs;         // pairs (iRepr, iObj) of the current wave
+    Vec_Int_t *      vStatus;        // solver status for each pair
+    int              nChunkSize;     // the number of pairs in one chunk
+    int              iJob;           // the first chunk of this job
+    int              nJobs;          // the chunk step
+    // SAT solving
+    sat_solver *     pSat;           // SAT solver
+    Vec_Int_t *      vSatVars;       // SAT variables of the objects
+    Vec_Int_t *      vVarMap;        // objects of the SAT variables
+    Vec_Int_t *      vCiVars;        // pairs (CiId, SatVar)
+    Vec_Int_t *      vStack;         // CNF construction
+    Vec_Int_t *      vCexes;         // counter-examples as (size, literals)
+    int              nCallsSince;
+    // statistics
+    int              nSatSat;
+    int              nSatUnsat;
+    int              nSatUndec;
+};
+void Cec4_ParJobRecycle( Cec4_ParJob_t * pJob )
+{
+    int i, iObj;
+    pJob->nCallsSince = 0;
+    sat_solver_reset( pJob->pSat );
+    Vec_IntForEachEntry( pJob->vVarMap, iObj, i )
+        Vec_IntWriteEntry( pJob->vSatVars, iObj, -1 );
+    Vec_IntClear( pJob->vVarMap );
+    Vec_IntClear( pJob->vCiVars );
+}
+static inline int Cec4_ParJobAddVar( Cec4_ParJob_t * pJob, int iObj )
+{
+    int iVar = sat_solver_addvar( pJob->pSat );
+    assert( Vec_IntSize(pJob->vVarMap) == iVar );
+    Vec_IntPush( pJob->vVarMap, iObj );
+    Vec_IntWriteEntry( pJob->vSatVars, iObj, iVar );
+    if ( Gia_ObjIsCi(Gia_ManObj(pJob->p, iObj)) )
+        Vec_IntPushTwo( pJob->vCiVars, iObj, iVar );
+    return iVar;
+}
+static inline int Cec4_ParMergedLit( Vec_Int_t * vMerged, int iLit, int fConst )
+{
+    int iNext;
+    while ( (iNext = Vec_IntEntry(vMerged, Abc_Lit2Var(iLit))) >= (fConst ? 0 : 2) )
+        iLit = Abc_LitNotCond( iNext, Abc_LitIsCompl(iLit) );
+    return iLit;
+}
+int Cec4_ParJobCnfVar( Cec4_ParJob_t * pJob, int iObj )
+{
+    Gia_Man_t * p = pJob->p;
+    Gia_Obj_t * pObj, * pFan0, * pFan1;
+    int * pSatVars = Vec_IntArray( pJob->vSatVars );
+    int jType = pJob->pPars->jType;
+    if ( pSatVars[iObj] >= 0 )
+        return pSatVars[iObj];
+    // the cone is traversed without recursion because the AIG can be deep
+    Vec_IntClear( pJob->vStack );
+    Vec_IntPush( pJob->vStack, iObj );
+    while ( Vec_IntSize(pJob->vStack) )
+    {
+        int iCur = Vec_IntEntryLast( pJob->vStack ), iVar, iVar0, iVar1, iLit0, iLit1, iMerged0, iMerged1, fXor;
+        if ( pSatVars[iCur] >= 0 )
+        {
+            Vec_IntPop( pJob->vStack );
+            continue;
+        }
+        pObj = Gia_ManObj( p, iCur );
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            Cec4_ParJobAddVar( pJob, iCur );
+            Vec_IntPop( pJob->vStack );
+            continue;
+        }
+        assert( Gia_ObjIsAnd(pObj) && iCur > 0 );
+        fXor  = Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) && Gia_IsComplement(pFan0) == Gia_IsComplement(pFan1);
+        iLit0 = fXor ? Abc_Var2Lit(Gia_ObjId(p, Gia_Regular(pFan0)), 0) : Gia_ObjFaninLit0(pObj, iCur);
+        iLit1 = fXor ? Abc_Var2Lit(Gia_ObjId(p, Gia_Regular(pFan1)), 0) : Gia_ObjFaninLit1(pObj, iCur);
+        // the fanins are replaced by the nodes they are proved equal to, unless the gate becomes trivial
+        // (the constant nodes are not substituted because the solver has no constant variable)
+        iMerged0 = Cec4_ParMergedLit( pJob->vMerged, iLit0, 0 );
+        iMerged1 = Cec4_ParMergedLit( pJob->vMerged, iLit1, 0 );
+        if ( Abc_Lit2Var(iMerged0) != Abc_Lit2Var(iMerged1) && (!fXor || Abc_LitIsCompl(iMerged0) == Abc_LitIsCompl(iMerged1)) )
+            iLit0 = iMerged0, iLit1 = iMerged1;
+        if ( pSatVars[Abc_Lit2Var(iLit0)] < 0 || pSatVars[Abc_Lit2Var(iLit1)] < 0 )
+        {
+            if ( pSatVars[Abc_Lit2Var(iLit0)] < 0 )
+                Vec_IntPush( pJob->vStack, Abc_Lit2Var(iLit0) );
+            if ( pSatVars[Abc_Lit2Var(iLit1)] < 0 )
+                Vec_IntPush( pJob->vStack, Abc_Lit2Var(iLit1) );
+            continue;
+        }
+        Vec_IntPop( pJob->vStack );
+        iVar0 = pSatVars[Abc_Lit2Var(iLit0)];
+        iVar1 = pSatVars[Abc_Lit2Var(iLit1)];
+        iVar  = Cec4_ParJobAddVar( pJob, iCur );
+        if ( fXor )
+        {
+            if ( jType < 2 )
+                sat_solver_add_xor( pJob->pSat, iVar, iVar0, iVar1, 0 );
+            if ( jType > 0 )
+            {
+                int Lit0 = Abc_Var2Lit( iVar0, 0 );
+                int Lit1 = Abc_Var2Lit( iVar1, 0 );
+                if ( Lit0 < Lit1 )
+                     Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+                sat_solver_set_var_fanin_lit( pJob->pSat, iVar, Lit0, Lit1 );
+            }
+        }
+        else
+        {
+            if ( jType < 2 )
+            {
+                if ( Gia_ObjIsXor(pObj) )
+                    sat_solver_add_xor( pJob->pSat, iVar, iVar0, iVar1, Abc_LitIsCompl(iLit0) ^ Abc_LitIsCompl(iLit1) );
+                else
+                    sat_solver_add_and( pJob->pSat, iVar, iVar0, iVar1, Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1), 0 );
+            }
+            if ( jType > 0 )
+            {
+                int Lit0 = Abc_Var2Lit( iVar0, Abc_LitIsCompl(iLit0) );
+                int Lit1 = Abc_Var2Lit( iVar1, Abc_LitIsCompl(iLit1) );
+                if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+                     Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+                sat_solver_set_var_fanin_lit( pJob->pSat, iVar, Lit0, Lit1 );
+            }
+        }
+    }
+    return pSatVars[iObj];
+}
+int Cec4_ParJobSolvePair( Cec4_ParJob_t * pJob, int iRepr, int iObj )
+{
+    Gia_Man_t * p = pJob->p;
+    int fCompl  = Gia_ManObj(p, iRepr)->fPhase ^ Gia_ManObj(p, iObj)->fPhase;
+    int fEffort = pJob->vCoDrivers ? Vec_BitEntry(pJob->vCoDrivers, iObj) || Vec_BitEntry(pJob->vCoDrivers, iRepr) : 0;
+    int nBTLimit = fEffort ? pJob->pPars->nBTLimitPo : pJob->pPars->nBTLimit;
+    int i, iVar0, iVar1, status, Lits[2];
+    assert( iRepr < iObj );
+    pJob->nCallsSince++;
+    if ( pJob->nCallsSince > pJob->pPars->nCallsRecycle && 
+         Vec_IntSize(pJob->vVarMap) > pJob->pPars->nSatVarMax && pJob->pPars->nSatVarMax )
+        Cec4_ParJobRecycle( pJob );
+    iVar0 = iRepr ? Cec4_ParJobCnfVar( pJob, iRepr ) : -1;
+    iVar1 = Cec4_ParJobCnfVar( pJob, iObj );
+    if ( pJob->pPars->jType > 0 )
+    {
+        sat_solver_start_new_round( pJob->pSat );
+        if ( iRepr )
+            sat_solver_mark_cone( pJob->pSat, iVar0 );
+        sat_solver_mark_cone( pJob->pSat, iVar1 );
+    }
+    // the constant candidate is checked with one call
+    if ( iRepr == 0 )
+        Lits[0] = Abc_Var2Lit( iVar1, fCompl );
+    else
+        Lits[0] = Abc_Var2Lit( iVar0, 1 ), Lits[1] = Abc_Var2Lit( iVar1, fCompl );
+    sat_solver_set_conflict_budget( pJob->pSat, nBTLimit );
+    status = sat_solver_solve( pJob->pSat, Lits, iRepr ? 2 : 1 );
+    if ( status == GLUCOSE_UNSAT && iRepr )
+    {
+        Lits[0] = Abc_Var2Lit( iVar0, 0 );
+        Lits[1] = Abc_Var2Lit( iVar1, !fCompl );
+        sat_solver_set_conflict_budget( pJob->pSat, nBTLimit );
+        status = sat_solver_solve( pJob->pSat, Lits, 2 );
+    }
+    if ( status == GLUCOSE_SAT )
+    {
+        int iSize = Vec_IntSize( pJob->vCexes ), IdAig, IdSat;
+        Vec_IntPush( pJob->vCexes, 0 );
+        if ( pJob->pPars->jType == 0 )
+        {
+            Vec_IntForEachEntryDouble( pJob->vCiVars, IdAig, IdSat, i )
+                Vec_IntPush( pJob->vCexes, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(pJob->pSat, IdSat)) );
+        }
+        else
+        {
+            int * pCex = sat_solver_read_cex( pJob->pSat );
+            int * pMap = Vec_IntArray( pJob->vVarMap );
+            for ( i = 0; i < pCex[0]; )
+                Vec_IntPush( pJob->vCexes, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+        }
+        Vec_IntWriteEntry( pJob->vCexes, iSize, Vec_IntSize(pJob->vCexes) - iSize - 1 );
+    }
+    return status;
+}
+int Cec4_ParJobPerform( void * pArg )
+{
+    Cec4_ParJob_t * pJob = (Cec4_ParJob_t *)pArg;
+    int nPairs = Vec_IntSize(pJob->vPairs) / 2;
+    int c, i, status;
+    for ( c = pJob->iJob * pJob->nChunkSize; c < nPairs; c += pJob->nJobs * pJob->nChunkSize )
+    for ( i = c; i < Abc_MinInt(c + pJob->nChunkSize, nPairs); i++ )
+    {
+        status = Cec4_ParJobSolvePair( pJob, Vec_IntEntry(pJob->vPairs, 2*i), Vec_IntEntry(pJob->vPairs, 2*i+1) );
+        Vec_IntWriteEntry( pJob->vStatus, i, status );
+        pJob->nSatSat   += status == GLUCOSE_SAT;
+        pJob->nSatUnsat += status == GLUCOSE_UNSAT;
+        pJob->nSatUndec += status == GLUCOSE_UNDEC;
+    }
+    return 1;
+}
+void Cec4_ManSweepParallelHash( Gia_Man_t * p, Cec4_Man_t * pMan, Hsh_IntMan_t * pHash, Vec_Int_t * vKeyObjs, Vec_Int_t * vWave )
+{
+    // the nodes that are trivial or have the same fanins after merging are proved without SAT calls
+    Vec_Int_t * vKeys = pHash->vData;
+    int i, iObj, iLit0, iLit1, iLit;
+    Vec_IntForEachEntry( vWave, iObj, i )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+        iLit0 = Cec4_ParMergedLit( pMan->vMerged, Gia_ObjFaninLit0(pObj, iObj), 1 );
+        iLit1 = Cec4_ParMergedLit( pMan->vMerged, Gia_ObjFaninLit1(pObj, iObj), 1 );
+        if ( iLit0 == 0 || iLit1 == 0 || iLit0 == Abc_LitNot(iLit1) )
+            iLit = 0;
+        else if ( iLit0 == 1 || iLit0 == iLit1 )
+            iLit = iLit1;
+        else if ( iLit1 == 1 )
+            iLit = iLit0;
+        else
+        {
+            Vec_IntPushTwo( vKeys, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1) );
+            Vec_IntPush( vKeyObjs, iObj );
+            iLit = Abc_Var2Lit( Vec_IntEntry(vKeyObjs, Hsh_IntObj(pHash, Hsh_IntManAdd(pHash, Vec_IntSize(vKeyObjs)-1))->iData), 0 );
+            if ( Abc_Lit2Var(iLit) == iObj )
+                continue;
+            Vec_IntShrink( vKeys, Vec_IntSize(vKeys) - 2 );
+            Vec_IntPop( vKeyObjs );
+        }
+        if ( Abc_Lit2Var(iLit) > iObj || !Gia_ObjHasRepr(p, iObj) || Gia_ObjProved(p, iObj) )
+            continue;
+        assert( Gia_ObjReprSelf(p, Abc_Lit2Var(iLit)) == Gia_ObjRepr(p, iObj) );
+        Gia_ObjSetProved( p, iObj );
+        Vec_IntWriteEntry( pMan->vMerged, iObj, iLit );
+    }
+}
+int Cec4_ManSweepParallelWave( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Ptr_t * vJobs, Vec_Int_t * vWave, Vec_Int_t * vPairs, Vec_Int_t * vStatus )
+{
+    Cec4_ParJob_t * pJob;
+    Gia_Obj_t * pRepr;
+    int i, k, c, iRepr, iObj, nPairs, nCexes = 0;
+    abctime clk;
+    // select the representatives using the latest counter-examples
+    Vec_IntClear( vPairs );
+    Vec_IntForEachEntry( vWave, iObj, i )
+    {
+        if ( !Gia_ObjHasRepr(p, iObj) || Gia_ObjProved(p, iObj) || Vec_BitEntry(pMan->vFails, iObj) )
+            continue;
+        pRepr = Cec4_ManFindRepr( p, pMan, iObj );
+        if ( pRepr == NULL )
+            continue;
+        Vec_IntPushTwo( vPairs, Gia_ObjId(p, pRepr), iObj );
+    }
+    nPairs = Vec_IntSize(vPairs) / 2;
+    if ( nPairs == 0 )
+        return 0;
+    Vec_IntFill( vStatus, nPairs, GLUCOSE_UNDEC );
+    Vec_PtrForEachEntry( Cec4_ParJob_t *, vJobs, pJob, k )
+        pJob->nChunkSize = Abc_MaxInt( 1, nPairs / (4 * Vec_PtrSize(vJobs)) );
+    clk = Abc_Clock();
+    Util_ProcessThreads( Cec4_ParJobPerform, vJobs, Vec_PtrSize(vJobs) + 1, 0, 0 );
+    pMan->timeSatPar += Abc_Clock() - clk;
+    // record the proved nodes and the failed ones
+    Vec_IntForEachEntryDouble( vPairs, iRepr, iObj, i )
+    {
+        if ( Vec_IntEntry(vStatus, i/2) == GLUCOSE_UNSAT )
+        {
+            Gia_ObjSetProved( p, iObj );
+            Vec_IntWriteEntry( pMan->vMerged, iObj, Abc_Var2Lit(iRepr, Gia_ManObj(p, iRepr)->fPhase ^ Gia_ManObj(p, iObj)->fPhase) );
+            if ( iRepr == 0 )
+                pMan->iLastConst = iObj;
+        }
+        else if ( Vec_IntEntry(vStatus, i/2) == GLUCOSE_UNDEC )
+            Vec_BitWriteEntry( pMan->vFails, iObj, 1 );
+    }
+    // add the counter-examples to the simulation info
+    Vec_PtrForEachEntry( Cec4_ParJob_t *, vJobs, pJob, k )
+    {
+        for ( c = 0; c < Vec_IntSize(pJob->vCexes); c += Vec_IntEntry(pJob->vCexes, c) + 1, nCexes++ )
+        {
+            p->iPatsPi++;
+            for ( i = c + 1; i <= c + Vec_IntEntry(pJob->vCexes, c); i++ )
+                Cec4_ObjSimSetInputBit( p, Abc_Lit2Var(Vec_IntEntry(pJob->vCexes, i)), Abc_LitIsCompl(Vec_IntEntry(pJob->vCexes, i)) );
+            if ( p->iPatsPi == 64 * p->nSimWords - 2 )
+            {
+                clk = Abc_Clock();
+                Cec4_ManSimulate( p, pMan );
+                Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+                p->iPatsPi = 0;
+                Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+                pMan->timeResimGlo += Abc_Clock() - clk;
+            }
+        }
+        Vec_IntClear( pJob->vCexes );
+    }
+    return nCexes;
+}
+void Cec4_ManSweepParallel( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    int nJobs = Abc_MinInt( pMan->pPars->nProcs, 99 );
+    Vec_Int_t * vPairs  = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vStatus = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vWave   = Vec_IntAlloc( 1000 );
+    Vec_Ptr_t * vJobs   = Vec_PtrAlloc( nJobs );
+    Vec_Int_t * vKeys   = Vec_IntAlloc( 2 * Gia_ManAndNum(p) );
+    Vec_Int_t * vKeyObjs = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Hsh_IntMan_t * pHash = Hsh_IntManStart( vKeys, 2, Gia_ManAndNum(p) );
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    Cec4_ParJob_t * pJob;
+    Gia_Obj_t * pObj;
+    int i, k, c, nCands = 0, nWaves = 0;
+    abctime clk = Abc_Clock();
+    pMan->vMerged = Vec_IntStartFull( Gia_ManObjNum(p) );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJob = ABC_CALLOC( Cec4_ParJob_t, 1 );
+        pJob->p          = p;
+        pJob->pPars      = pMan->pPars;
+        pJob->vCoDrivers = pMan->vCoDrivers;
+        pJob->vMerged    = pMan->vMerged;
+        pJob->vPairs     = vPairs;
+        pJob->vStatus    = vStatus;
+        pJob->iJob       = k;
+        pJob->nJobs      = nJobs;
+        pJob->pSat       = sat_solver_start();
+        pJob->vSatVars   = Vec_IntStartFull( Gia_ManObjNum(p) );
+        pJob->vVarMap    = Vec_IntAlloc( 1000 );
+        pJob->vCiVars    = Vec_IntAlloc( 1000 );
+        pJob->vStack     = Vec_IntAlloc( 1000 );
+        pJob->vCexes     = Vec_IntAlloc( 1000 );
+        sat_solver_set_jftr( pJob->pSat, pMan->pPars->jType );
+        Vec_PtrPush( vJobs, pJob );
+    }
+    // group the nodes by level
+    vLevels = Vec_WecStart( Gia_ManLevelNum(p) + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_WecPush( vLevels, Gia_ObjLevelId(p, i), i );
+    // solve the waves containing enough candidates for all threads
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        Vec_IntAppend( vWave, vLevel );
+        Vec_IntForEachEntry( vLevel, i, c )
+            nCands += Gia_ObjHasRepr(p, i);
+        if ( nCands < 16 * nJobs && k < Vec_WecSize(vLevels) - 1 )
+            continue;
+        Cec4_ManSweepParallelHash( p, pMan, pHash, vKeyObjs, vWave );
+        while ( Cec4_ManSweepParallelWave( p, pMan, vJobs, vWave, vPairs, vStatus ) );
+        Vec_IntClear( vWave );
+        nCands = 0;
+        nWaves++;
+    }
+    Vec_PtrForEachEntry( Cec4_ParJob_t *, vJobs, pJob, k )
+    {
+        pMan->nSatSat   += pJob->nSatSat;
+        pMan->nSatUnsat += pJob->nSatUnsat;
+        pMan->nSatUndec += pJob->nSatUndec;
+        pMan->nPatterns += pJob->nSatSat;
+        sat_solver_stop( pJob->pSat );
+        Vec_IntFree( pJob->vSatVars );
+        Vec_IntFree( pJob->vVarMap );
+        Vec_IntFree( pJob->vCiVars );
+        Vec_IntFree( pJob->vStack );
+        Vec_IntFree( pJob->vCexes );
+        ABC_FREE( pJob );
+    }
+    if ( pMan->pPars->fVerbose )
+    {
+        printf( "Par  %4d : waves =%6d  threads =%3d  ", pMan->nItersSim + pMan->nItersSat++, nWaves, nJobs );
+        printf( "P =%7d  D =%7d  F =%8d  ", pMan->nSatUnsat, pMan->nSatSat, pMan->nSatUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Hsh_IntManStop( pHash );
+    Vec_IntFree( vKeys );
+    Vec_IntFree( vKeyObjs );
+    Vec_WecFree( vLevels );
+    Vec_PtrFree( vJobs );
+    Vec_IntFree( vPairs );
+    Vec_IntFree( vStatus );
+    Vec_IntFree( vWave );
+}
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1945,6 +2331,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 && !pPars->fUseCones && !p->pMuxes )
+        Cec4_ManSweepParallel( p, pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1964,6 +2352,14 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         //if ( Gia_ObjIsAnd(pObjNew) )
         //    Gia_ObjSetAndLevel( pMan->pNew, pObjNew );
         // select representative based on candidate equivalence classes
+        if ( pMan->vMerged && Vec_IntEntry(pMan->vMerged, i) >= 0 ) // proved by parallel sweeping
+        {
+            int iLit = Vec_IntEntry( pMan->vMerged, i );
+            if ( pPars->fBMiterInfo ) 
+                Bnd_ManMerge( Abc_Lit2Var(iLit), i, Abc_LitIsCompl(iLit) );
+            pObj->Value = Abc_LitNotCond( Gia_ManObj(p, Abc_Lit2Var(iLit))->Value, Abc_LitIsCompl(iLit) );
+            continue;
+        }
         pRepr = Gia_ObjReprObj( p, i );
         if ( pRepr == NULL )
             continue;
@@ -2074,16 +2470,21 @@ void Cec4_ManSimulateTest2( Gia_Man_t * p, int nConfs, int fVerbose )
     if ( fVerbose )
         Abc_PrintTime( 1, "New choice computation time", Abc_Clock() - clk );
 }
-Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
+Gia_Man_t * Cec4_ManSimulateTest6( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose )
 {
     Gia_Man_t * pNew = NULL;
     Cec_ParFra_t ParsFra, * pPars = &ParsFra;
     Cec4_ManSetParams( pPars );
     pPars->fVerbose = fVerbose;
     pPars->nBTLimit = nBTLimit;
+    pPars->nProcs   = nProcs;
     Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
     return pNew;
 }
+Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
+{
+    return Cec4_ManSimulateTest6( p, nBTLimit, 0, fVerbose );
+}
 Gia_Man_t * Cec4_ManSimulateTest4( Gia_Man_t * p, int nBTLimit, int nBTLimitPo, int fVerbose )
 {
     Gia_Man_t * pNew = NULL;
@@ -4187,6 +4588,8 @@ void Cec4_CallSATsolver(Gia_Man_t * p, Cec4_Man_t * pMan, Cec_ParFra_t * pPars){
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 && !pPars->fUseCones && !p->pMuxes )
+        Cec4_ManSweepParallel( p, pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
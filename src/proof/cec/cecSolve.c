@@ -30,6 +30,20 @@ ABC_NAMESPACE_IMPL_START
 static inline int  Cec_ObjSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj )             { return p->pSatVars[Gia_ObjId(p->pAig,pObj)]; }
 static inline void Cec_ObjSetSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj, int Num ) { p->pSatVars[Gia_ObjId(p->pAig,pObj)] = Num;  }
 
+#define CEC_PAR_CHUNK 256
+
+// a group of miter outputs solved by one task
+typedef struct Cec_ParMiter_t_ Cec_ParMiter_t;
+struct Cec_ParMiter_t_
+{
+    Gia_Man_t *      pAig;           // the miter (shared, read-only)
+    Cec_ParSat_t *   pPars;          // SAT parameters
+    int              iBeg;           // the first output
+    int              iEnd;           // the output after the last one
+    Vec_Str_t *      vStatus;        // the status of each output
+    Vec_Int_t *      vCexStore;      // the counter-examples
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -1131,6 +1145,158 @@ Vec_Int_t * Cec_ManSatSolveMiter( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_St
     return vCexStore;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Saves the CI values in the cone of the node.]
+
+  Description [Same as Cec_ManSavePattern() but uses the private array
+  of marks instead of the traversal IDs of the shared AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManSavePatternPar_rec( Cec_ManSat_t * p, Gia_Obj_t * pObj, Vec_Str_t * vMarks )
+{
+    int Id = Gia_ObjId( p->pAig, pObj );
+    if ( Vec_StrEntry(vMarks, Id) )
+        return;
+    Vec_StrWriteEntry( vMarks, Id, 1 );
+    Vec_IntPush( p->vVisits, Id );
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        p->nCexLits++;
+        Vec_IntPush( p->vCex, Abc_Var2Lit( Gia_ObjCioId(pObj), !Cec_ObjSatVarValue(p, pObj) ) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_ManSavePatternPar_rec( p, Gia_ObjFanin0(pObj), vMarks );
+    Cec_ManSavePatternPar_rec( p, Gia_ObjFanin1(pObj), vMarks );
+}
+static void Cec_ManSavePatternPar( Cec_ManSat_t * p, Gia_Obj_t * pObj, Vec_Str_t * vMarks )
+{
+    int i, Id;
+    Vec_IntClear( p->vCex );
+    Vec_IntClear( p->vVisits );
+    Cec_ManSavePatternPar_rec( p, Gia_Regular(pObj), vMarks );
+    Vec_IntForEachEntry( p->vVisits, Id, i )
+        Vec_StrWriteEntry( vMarks, Id, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one group of miter outputs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManSatSolveMiterJob( void * pArg )
+{
+    Cec_ParMiter_t * pJob = (Cec_ParMiter_t *)pArg;
+    Gia_Man_t * pAig = pJob->pAig;
+    Vec_Str_t * vMarks = Vec_StrStart( Gia_ManObjNum(pAig) );
+    Cec_ManSat_t * p = Cec_ManSatCreate( pAig, pJob->pPars );
+    Gia_Obj_t * pObj;
+    int i, status;
+    for ( i = pJob->iBeg; i < pJob->iEnd; i++ )
+    {
+        pObj = Gia_ManCo( pAig, i );
+        Vec_IntClear( p->vCex );
+        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+        {
+            if ( Gia_ObjFaninC0(pObj) )
+            {
+                Cec_ManSatAddToStore( pJob->vCexStore, p->vCex, i ); // trivial counter-example
+                Vec_StrPush( pJob->vStatus, 0 );
+            }
+            else
+                Vec_StrPush( pJob->vStatus, 1 );
+            continue;
+        }
+        status = Cec_ManSatCheckNode( p, Gia_ObjChild0(pObj) );
+        Vec_StrPush( pJob->vStatus, (char)status );
+        if ( status == -1 )
+        {
+            Cec_ManSatAddToStore( pJob->vCexStore, NULL, i ); // timeout
+            continue;
+        }
+        if ( status == 1 )
+            continue;
+        assert( status == 0 );
+        Cec_ManSavePatternPar( p, Gia_ObjFanin0(pObj), vMarks );
+        Cec_ManSatAddToStore( pJob->vCexStore, p->vCex, i );
+    }
+    Cec_ManSatStop( p );
+    Vec_StrFree( vMarks );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving for the POs using several threads.]
+
+  Description [The outputs are divided into fixed groups, each solved by
+  a separate SAT solver sharing the same AIG. The statuses and the 
+  counter-examples are merged in the order of the outputs, so the result
+  has the same format as Cec_ManSatSolveMiter() and does not depend on 
+  the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_ManSatSolveMiterPar( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int nProcs, Vec_Str_t ** pvStatus )
+{
+    Cec_ParMiter_t * pJobs;
+    Util_Task_t ** pTasks;
+    Vec_Int_t * vCexStore;
+    Vec_Str_t * vStatus;
+    int k, nJobs;
+    nJobs = (Gia_ManCoNum(pAig) + CEC_PAR_CHUNK - 1) / CEC_PAR_CHUNK;
+    if ( nProcs < 2 || nJobs < 2 )
+        return Cec_ManSatSolveMiter( pAig, pPars, pvStatus );
+    // prepare AIG (the tasks do not modify it)
+    Gia_ManSetPhase( pAig );
+    Gia_ManLevelNum( pAig );
+    // solve the groups of outputs
+    pJobs  = ABC_CALLOC( Cec_ParMiter_t, nJobs );
+    pTasks = ABC_CALLOC( Util_Task_t *, nJobs );
+    Util_PoolStart( nProcs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pAig      = pAig;
+        pJobs[k].pPars     = pPars;
+        pJobs[k].iBeg      = k * CEC_PAR_CHUNK;
+        pJobs[k].iEnd      = Abc_MinInt( (k + 1) * CEC_PAR_CHUNK, Gia_ManCoNum(pAig) );
+        pJobs[k].vStatus   = Vec_StrAlloc( CEC_PAR_CHUNK );
+        pJobs[k].vCexStore = Vec_IntAlloc( 1000 );
+        pTasks[k] = Util_PoolSubmit( Cec_ManSatSolveMiterJob, pJobs + k );
+    }
+    // merge the results
+    vStatus   = Vec_StrAlloc( Gia_ManCoNum(pAig) );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        Util_TaskWait( pTasks[k], 0 );
+        Util_TaskFree( pTasks[k] );
+        Vec_StrPushBuffer( vStatus, Vec_StrArray(pJobs[k].vStatus), Vec_StrSize(pJobs[k].vStatus) );
+        Vec_IntAppend( vCexStore, pJobs[k].vCexStore );
+        Vec_StrFree( pJobs[k].vStatus );
+        Vec_IntFree( pJobs[k].vCexStore );
+    }
+    assert( Vec_StrSize(vStatus) == Gia_ManCoNum(pAig) );
+    ABC_FREE( pTasks );
+    ABC_FREE( pJobs );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
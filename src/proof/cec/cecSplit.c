@@ -26,17 +26,6 @@
 #include "misc/util/utilTruth.h"
 //#include "bdd/cudd/cuddInt.h"
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 
@@ -544,36 +533,21 @@ typedef struct Par_ThData_t_
     Cnf_Dat_t * pCnf;
     int         iThread;
     int         nTimeOut;
-    int         fWorking;
     int         Result;
     int         nVars;
     int         nConfs;
 } Par_ThData_t;
-void * Cec_GiaSplitWorkerThread( void * pArg )
+int Cec_GiaSplitWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
-    return NULL;
+    pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
+    return pThData->Result;
 }
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Util_Task_t * pTasks[PAR_THR_MAX];
     Vec_Ptr_t * vStack;
     Cnf_Dat_t * pCnf;
     double Progress = 0;
@@ -612,18 +586,18 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     // create local copy
     vStack = Vec_PtrAlloc( 1000 );
     Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    // the problems are solved by the thread pool
+    Util_PoolStart( nProcs );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = NULL;
         ThData[i].pCnf     = NULL;
         ThData[i].iThread  = i;
         ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
         ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        pTasks[i]          = NULL;
     }
     // look at the threads
     while ( fWorkToDo )
@@ -632,7 +606,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         for ( i = 0; i < nProcs; i++ )
         {
             // check if this thread is working
-            if ( ThData[i].fWorking )
+            if ( pTasks[i] && !Util_TaskIsDone(pTasks[i]) )
             {
                 fWorkToDo = 1;
                 continue;
@@ -642,6 +616,8 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
             {
                 Gia_Man_t * pLast = ThData[i].p;
                 int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
+                Util_TaskFree( pTasks[i] );
+                pTasks[i] = NULL;
                 if ( pLast->vCofVars == NULL )
                     pLast->vCofVars = Vec_IntAlloc( 100 );
                 if ( fVerbose )
@@ -694,31 +670,33 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
             assert( ThData[i].p == NULL );
             ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
             ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
+            pTasks[i] = Util_PoolSubmit( Cec_GiaSplitWorkerThread, ThData + i );
         }
         if ( nIterMax && nIter >= nIterMax )
             break;
+        // sleep till one of the threads finishes
+        if ( fWorkToDo )
+            Util_TaskWaitAny( pTasks, nProcs, 0 );
     }
     if ( !fWorkToDo )
         RetValue = 1;
 finish:
     // wait till threads finish
     for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = -1;
-    // stop threads
+    {
+        if ( pTasks[i] == NULL )
+            continue;
+        Util_TaskWait( pTasks[i], 0 );
+        Util_TaskFree( pTasks[i] );
+    }
+    // cleanup
     for ( i = 0; i < nProcs; i++ )
     {
-        assert( !ThData[i].fWorking );
-        // cleanup
         Gia_ManStopP( &ThData[i].p );
         if ( ThData[i].pCnf == NULL )
             continue;
         Cnf_DataFree( ThData[i].pCnf );
         ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
     }
     // finish
     Cec_GiaSplitClean( vStack );
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "dchInt.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -57,6 +58,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
+    p->nProcs         =     1;  // the number of threads
 }
 
 /**Function*************************************************************
@@ -97,12 +99,23 @@ Aig_Man_t * Dch_ComputeChoices( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     p = Dch_ManCreate( pAig, pPars );
     // compute candidate equivalence classes
 clk = Abc_Clock(); 
-    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+    Abc_ProfPhaseBegin( "dch: simulation" );
+    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->nProcs, pPars->fVerbose );
+    Abc_ProfPhaseEnd();
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    // prove the candidate equivalences concurrently
+    if ( pPars->nProcs > 1 )
+    {
+        Abc_ProfPhaseBegin( "dch: concurrent SAT" );
+        Dch_ManSolvePar( p );
+        Abc_ProfPhaseEnd();
+    }
     // perform SAT sweeping
+    Abc_ProfPhaseBegin( "dch: SAT sweeping" );
     Dch_ManSweep( p );
+    Abc_ProfPhaseEnd();
     // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop( p );
@@ -110,7 +123,9 @@ p->timeTotal = Abc_Clock() - clkTotal;
         Abc_PrintTime( 1, "Old choice computation time", Abc_Clock() - clk2 );
     // create choices
     ABC_FREE( pAig->pTable );
+    Abc_ProfPhaseBegin( "dch: choices" );
     pResult = Dch_DeriveChoiceAig( pAig, pPars->fSkipRedSupp );
+    Abc_ProfPhaseEnd();
     // count the number of representatives
     if ( pPars->fVerbose ) 
         Abc_Print( 1, "STATS:  Ands:%8d  ->%8d.  Reprs:%7d  ->%7d.  Choices =%7d.\n", 
@@ -143,10 +158,13 @@ void Dch_ComputeEquivalences( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     p = Dch_ManCreate( pAig, pPars );
     // compute candidate equivalence classes
 clk = Abc_Clock(); 
-    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->nProcs, pPars->fVerbose );
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    // prove the candidate equivalences concurrently
+    if ( pPars->nProcs > 1 )
+        Dch_ManSolvePar( p );
     // perform SAT sweeping
     Dch_ManSweep( p );
     // free memory ahead of time
@@ -59,6 +59,7 @@ struct Dch_Man_t_
     // equivalence classes
     Dch_Cla_t *      ppClasses;      // equivalence classes of nodes
     Aig_Obj_t **     pReprsProved;   // equivalences proved
+    Aig_Obj_t **     pReprsPar;      // equivalences proved by parallel solving
     // SAT solving
     sat_solver *     pSat;           // recyclable SAT solver
     int              nSatVars;       // the counter of SAT variables
@@ -78,6 +79,10 @@ struct Dch_Man_t_
     int              nSatFailsReal;  // the number of timeouts
     int              nSatCallsUnsat; // the number of unsat SAT calls
     int              nSatCallsSat;   // the number of sat SAT calls
+    // parallel solving statistics
+    int              nParProved;     // the number of pairs proved
+    int              nParDisproved;  // the number of pairs disproved
+    int              nParUndec;      // the number of pairs undecided
     // choice node statistics
     int              nLits;          // the number of lits in the cand equiv classes
     int              nReprs;         // the number of proved equivalent pairs
@@ -90,6 +95,7 @@ struct Dch_Man_t_
     abctime          timeSatSat;     // sat
     abctime          timeSatUnsat;   // unsat
     abctime          timeSatUndec;   // undecided
+    abctime          timeSatPar;     // parallel solving
     abctime          timeChoice;     // choice computation
     abctime          timeOther;      // other runtime
     abctime          timeTotal;      // total runtime
@@ -148,8 +154,10 @@ extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
+extern void          Dch_ManSolvePar( Dch_Man_t * p );
 /*=== dchSim.c ===================================================*/
-extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose );
+extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int nProcs, int fVerbose );
+extern int           Dch_ClassesRefineWithCexes( Dch_Cla_t * pClasses, Aig_Man_t * pAig, Vec_Int_t * vCexes, int nProcs );
 /*=== dchSimSat.c ===================================================*/
 extern void          Dch_ManResimulateCex( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 extern void          Dch_ManResimulateCex2( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
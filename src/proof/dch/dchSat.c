@@ -27,6 +27,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define DCH_PAR_CHUNK 256
+
+// a group of candidate pairs solved by one task
+typedef struct Dch_ParJob_t_ Dch_ParJob_t;
+struct Dch_ParJob_t_
+{
+    Dch_Man_t *      pMan;           // the main manager (read-only)
+    Vec_Int_t *      vPairs;         // pairs (ReprId, ObjId) of all jobs
+    int              iBeg;           // the first pair
+    int              iEnd;           // the pair after the last one
+    Vec_Int_t *      vStatus;        // the result for each pair (1, 0, -1)
+    Vec_Int_t *      vCexes;         // counter-examples of the disproved pairs
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -157,6 +171,148 @@ p->timeSatUndec += Abc_Clock() - clk;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves one group of candidate pairs.]
+
+  Description [Uses a private SAT solver built for the original AIG. 
+  For each disproved pair, records the values of the CIs in the solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dch_ManSolveParJob( void * pArg )
+{
+    Dch_ParJob_t * pJob = (Dch_ParJob_t *)pArg;
+    Aig_Man_t * pAig = pJob->pMan->pAigTotal;
+    Dch_Man_t * p;
+    Aig_Obj_t * pObj, * pRepr;
+    int i, k, iSize, RetValue;
+    // start the worker manager
+    p = ABC_CALLOC( Dch_Man_t, 1 );
+    p->pPars      = pJob->pMan->pPars;
+    p->pAigTotal  = pAig;
+    p->pAigFraig  = pAig;
+    p->nSatVars   = 1;
+    p->pSatVars   = ABC_CALLOC( int, Aig_ManObjNumMax(pAig) );
+    p->vUsedNodes = Vec_PtrAlloc( 1000 );
+    p->vFanins    = Vec_PtrAlloc( 100 );
+    for ( i = pJob->iBeg; i < pJob->iEnd; i++ )
+    {
+        pRepr = Aig_ManObj( pAig, Vec_IntEntry(pJob->vPairs, 2*i) );
+        pObj  = Aig_ManObj( pAig, Vec_IntEntry(pJob->vPairs, 2*i+1) );
+        RetValue = Dch_NodesAreEquiv( p, pRepr, pObj );
+        Vec_IntPush( pJob->vStatus, RetValue );
+        if ( RetValue != 0 )
+            continue;
+        // save the counter-example
+        iSize = Vec_IntSize( pJob->vCexes );
+        Vec_IntPush( pJob->vCexes, 0 );
+        Vec_PtrForEachEntry( Aig_Obj_t *, p->vUsedNodes, pObj, k )
+            if ( Aig_ObjIsCi(pObj) )
+                Vec_IntPush( pJob->vCexes, Abc_Var2Lit(Aig_ObjCioId(pObj), sat_solver_var_value(p->pSat, Dch_ObjSatNum(p, pObj))) );
+        Vec_IntWriteEntry( pJob->vCexes, iSize, Vec_IntSize(pJob->vCexes) - iSize - 1 );
+    }
+    // stop the worker manager
+    if ( p->pSat )
+        sat_solver_delete( p->pSat );
+    Vec_PtrFree( p->vUsedNodes );
+    Vec_PtrFree( p->vFanins );
+    ABC_FREE( p->pSatVars );
+    ABC_FREE( p );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the candidate pairs in parallel before sweeping.]
+
+  Description [Each candidate node is checked against its representative
+  in the original AIG. The pairs are split into fixed-size groups solved 
+  by independent tasks, so the result does not depend on the number of 
+  threads. The proved pairs are recorded in p->pReprsPar and skipped by
+  the sweep; the counter-examples are used to refine the classes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSolvePar( Dch_Man_t * p )
+{
+    Aig_Man_t * pAig = p->pAigTotal;
+    Dch_ParJob_t * pJobs;
+    Util_Task_t ** pTasks;
+    Vec_Int_t * vPairs, * vCexes;
+    Aig_Obj_t * pObj, * pRepr;
+    abctime clk = Abc_Clock();
+    int i, k, nPairs, nJobs;
+    // collect the candidate pairs
+    vPairs = Vec_IntAlloc( 1000 );
+    Aig_ManForEachNode( pAig, pObj, i )
+        if ( (pRepr = Aig_ObjRepr(pAig, pObj)) )
+            Vec_IntPushTwo( vPairs, Aig_ObjId(pRepr), Aig_ObjId(pObj) );
+    nPairs = Vec_IntSize(vPairs) / 2;
+    if ( nPairs == 0 )
+    {
+        Vec_IntFree( vPairs );
+        return;
+    }
+    // solve the groups of pairs
+    nJobs  = (nPairs + DCH_PAR_CHUNK - 1) / DCH_PAR_CHUNK;
+    pJobs  = ABC_CALLOC( Dch_ParJob_t, nJobs );
+    pTasks = ABC_CALLOC( Util_Task_t *, nJobs );
+    Util_PoolStart( p->pPars->nProcs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pMan    = p;
+        pJobs[k].vPairs  = vPairs;
+        pJobs[k].iBeg    = k * DCH_PAR_CHUNK;
+        pJobs[k].iEnd    = Abc_MinInt( (k + 1) * DCH_PAR_CHUNK, nPairs );
+        pJobs[k].vStatus = Vec_IntAlloc( DCH_PAR_CHUNK );
+        pJobs[k].vCexes  = Vec_IntAlloc( 1000 );
+        pTasks[k] = Util_PoolSubmit( Dch_ManSolveParJob, pJobs + k );
+    }
+    // merge the results in a fixed order
+    if ( p->pReprsPar == NULL )
+        p->pReprsPar = ABC_CALLOC( Aig_Obj_t *, Aig_ManObjNumMax(pAig) );
+    vCexes = Vec_IntAlloc( 1000 );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        int Status;
+        Util_TaskWait( pTasks[k], 0 );
+        Util_TaskFree( pTasks[k] );
+        Vec_IntForEachEntry( pJobs[k].vStatus, Status, i )
+        {
+            int iPair = pJobs[k].iBeg + i;
+            if ( Status == 1 )
+            {
+                pObj = Aig_ManObj( pAig, Vec_IntEntry(vPairs, 2*iPair+1) );
+                p->pReprsPar[pObj->Id] = Aig_ManObj( pAig, Vec_IntEntry(vPairs, 2*iPair) );
+                p->nParProved++;
+            }
+            else if ( Status == 0 )
+                p->nParDisproved++;
+            else
+                p->nParUndec++;
+        }
+        Vec_IntAppend( vCexes, pJobs[k].vCexes );
+        Vec_IntFree( pJobs[k].vStatus );
+        Vec_IntFree( pJobs[k].vCexes );
+    }
+    ABC_FREE( pTasks );
+    ABC_FREE( pJobs );
+    Vec_IntFree( vPairs );
+    p->timeSatPar += Abc_Clock() - clk;
+    // refine the classes using the counter-examples
+    clk = Abc_Clock();
+    Dch_ClassesRefineWithCexes( p->ppClasses, pAig, vCexes, p->pPars->nProcs );
+    Vec_IntFree( vCexes );
+    p->timeSimSat += Abc_Clock() - clk;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define DCH_SIM_THR_MAX 64
+
 static inline unsigned * Dch_ObjSim( Vec_Ptr_t * vSims, Aig_Obj_t * pObj )
 { 
     return (unsigned *)Vec_PtrEntry( vSims, pObj->Id ); 
@@ -189,7 +191,7 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 
 /**Function*************************************************************
 
-  Synopsis    [Perform random simulation.]
+  Synopsis    [Simulates the internal nodes for a range of words.]
 
   Description []
                
@@ -198,29 +200,23 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
   SeeAlso     []
 
 ***********************************************************************/
-void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+typedef struct Dch_SimJob_t_ Dch_SimJob_t;
+struct Dch_SimJob_t_
+{
+    Aig_Man_t *      pAig;           // the AIG
+    Vec_Ptr_t *      vSims;          // the simulation info
+    int              iBeg;           // the first word
+    int              iEnd;           // the word after the last one
+};
+static int Dch_PerformSimulationRange( void * pArg )
 {
+    Dch_SimJob_t * pJob = (Dch_SimJob_t *)pArg;
+    Vec_Ptr_t * vSims = pJob->vSims;
     unsigned * pSim, * pSim0, * pSim1;
     Aig_Obj_t * pObj;
-    int i, k, nWords;
-    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
-
-    // assign const 1 sim info
-    pObj = Aig_ManConst1(pAig);
-    pSim = Dch_ObjSim( vSims, pObj );
-    memset( pSim, 0xff, sizeof(unsigned) * nWords );
-
-    // assign primary input random sim info
-    Aig_ManForEachCi( pAig, pObj, i )
-    {
-        pSim = Dch_ObjSim( vSims, pObj );
-        for ( k = 0; k < nWords; k++ )
-            pSim[k] = Dch_ObjRandomSim();
-        pSim[0] <<= 1;
-    }
-
+    int i, k, iBeg = pJob->iBeg, iEnd = pJob->iEnd;
     // simulate AIG in the topological order
-    Aig_ManForEachNode( pAig, pObj, i )
+    Aig_ManForEachNode( pJob->pAig, pObj, i )
     {
         pSim0 = Dch_ObjSim( vSims, Aig_ObjFanin0(pObj) ); 
         pSim1 = Dch_ObjSim( vSims, Aig_ObjFanin1(pObj) ); 
@@ -228,26 +224,100 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
 
         if ( Aig_ObjFaninC0(pObj) && Aig_ObjFaninC1(pObj) ) // both are compls
         {
-            for ( k = 0; k < nWords; k++ )
+            for ( k = iBeg; k < iEnd; k++ )
                 pSim[k] = ~pSim0[k] & ~pSim1[k];
         }
         else if ( Aig_ObjFaninC0(pObj) && !Aig_ObjFaninC1(pObj) ) // first one is compl
         {
-            for ( k = 0; k < nWords; k++ )
+            for ( k = iBeg; k < iEnd; k++ )
                 pSim[k] = ~pSim0[k] & pSim1[k];
         }
         else if ( !Aig_ObjFaninC0(pObj) && Aig_ObjFaninC1(pObj) ) // second one is compl
         {
-            for ( k = 0; k < nWords; k++ )
+            for ( k = iBeg; k < iEnd; k++ )
                 pSim[k] = pSim0[k] & ~pSim1[k];
         }
         else // if ( Aig_ObjFaninC0(pObj) && Aig_ObjFaninC1(pObj) ) // none is compl
         {
-            for ( k = 0; k < nWords; k++ )
+            for ( k = iBeg; k < iEnd; k++ )
                 pSim[k] = pSim0[k] & pSim1[k];
         }
     }
-    // get simulation information for primary outputs
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes.]
+
+  Description [Assumes that the simulation info of the CIs is assigned.
+  With several threads, each thread simulates its own range of words.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_PerformSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims, int nProcs )
+{
+    Dch_SimJob_t Jobs[DCH_SIM_THR_MAX];
+    Util_Task_t * pTasks[DCH_SIM_THR_MAX];
+    int k, nWords;
+    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
+    nProcs = Abc_MaxInt( 1, Abc_MinInt( Abc_MinInt(nProcs, nWords), DCH_SIM_THR_MAX ) );
+    // assign const 1 sim info
+    memset( Dch_ObjSim(vSims, Aig_ManConst1(pAig)), 0xff, sizeof(unsigned) * nWords );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Jobs[k].pAig  = pAig;
+        Jobs[k].vSims = vSims;
+        Jobs[k].iBeg  = k * nWords / nProcs;
+        Jobs[k].iEnd  = (k + 1) * nWords / nProcs;
+    }
+    if ( nProcs == 1 )
+    {
+        Dch_PerformSimulationRange( Jobs );
+        return;
+    }
+    Util_PoolStart( nProcs );
+    for ( k = 0; k < nProcs; k++ )
+        pTasks[k] = Util_PoolSubmit( Dch_PerformSimulationRange, Jobs + k );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Util_TaskWait( pTasks[k], 0 );
+        Util_TaskFree( pTasks[k] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Perform random simulation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims, int nProcs )
+{
+    unsigned * pSim;
+    Aig_Obj_t * pObj;
+    int i, k, nWords;
+    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
+
+    // assign primary input random sim info
+    Aig_ManForEachCi( pAig, pObj, i )
+    {
+        pSim = Dch_ObjSim( vSims, pObj );
+        for ( k = 0; k < nWords; k++ )
+            pSim[k] = Dch_ObjRandomSim();
+        pSim[0] <<= 1;
+    }
+
+    // simulate AIG in the topological order
+    Dch_PerformSimulation( pAig, vSims, nProcs );
 }
 
 /**Function*************************************************************
@@ -261,7 +331,7 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
   SeeAlso     []
 
 ***********************************************************************/
-Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose )
+Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int nProcs, int fVerbose )
 {
     Dch_Cla_t * pClasses;
     Vec_Ptr_t * vSims;
@@ -269,7 +339,7 @@ Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbo
     // allocate simulation information
     vSims = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
     // run random simulation from the primary inputs
-    Dch_PerformRandomSimulation( pAig, vSims );
+    Dch_PerformRandomSimulation( pAig, vSims, nProcs );
     // start storage for equivalence classes
     pClasses = Dch_ClassesStart( pAig );
     Dch_ClassesSetData( pClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
@@ -278,7 +348,7 @@ Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbo
     // iterate random simulation
     for ( i = 0; i < 7; i++ )
     {
-        Dch_PerformRandomSimulation( pAig, vSims );
+        Dch_PerformRandomSimulation( pAig, vSims, nProcs );
         Dch_ClassesRefine( pClasses );
     }
     // clean up and return
@@ -288,6 +358,66 @@ Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbo
     return pClasses;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using the counter-examples.]
+
+  Description [Each counter-example is given by the number of literals
+  followed by the literals of the CIs in terms of their CI numbers. The
+  remaining CIs are assigned random values. Returns the number of 
+  refinements performed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ClassesRefineWithCexes( Dch_Cla_t * pClasses, Aig_Man_t * pAig, Vec_Int_t * vCexes, int nProcs )
+{
+    int nWords = 16;
+    Vec_Ptr_t * vSims, * vRoots;
+    Aig_Obj_t * pObj;
+    unsigned * pSim;
+    int i, k, iCex, nCexes, nRefis = 0;
+    vSims  = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
+    vRoots = Vec_PtrAlloc( 1000 );
+    for ( iCex = 0; iCex < Vec_IntSize(vCexes); )
+    {
+        // assign random values to the CIs
+        Aig_ManForEachCi( pAig, pObj, i )
+        {
+            pSim = Dch_ObjSim( vSims, pObj );
+            for ( k = 0; k < nWords; k++ )
+                pSim[k] = Dch_ObjRandomSim();
+        }
+        // add the next group of counter-examples
+        for ( nCexes = 0; nCexes < 32 * nWords && iCex < Vec_IntSize(vCexes); nCexes++ )
+        {
+            int nLits = Vec_IntEntry( vCexes, iCex++ );
+            for ( k = 0; k < nLits; k++ )
+            {
+                int Lit = Vec_IntEntry( vCexes, iCex++ );
+                pSim = Dch_ObjSim( vSims, Aig_ManCi(pAig, Abc_Lit2Var(Lit)) );
+                if ( Abc_InfoHasBit(pSim, nCexes) != Abc_LitIsCompl(Lit) )
+                    Abc_InfoXorBit( pSim, nCexes );
+            }
+        }
+        Dch_PerformSimulation( pAig, vSims, nProcs );
+        // refine the classes
+        Dch_ClassesSetData( pClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
+        nRefis += Dch_ClassesRefine( pClasses );
+        Vec_PtrClear( vRoots );
+        Aig_ManForEachNode( pAig, pObj, i )
+            if ( Dch_ObjIsConst1Cand( pAig, pObj ) )
+                Vec_PtrPush( vRoots, pObj );
+        nRefis += Dch_ClassesRefineConst1Group( pClasses, vRoots, 1 );
+    }
+    Dch_ClassesSetData( pClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex );
+    Vec_PtrFree( vRoots );
+    Vec_PtrFree( vSims );
+    return nRefis;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
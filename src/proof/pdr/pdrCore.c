@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       1;  // the number of threads
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -1347,6 +1348,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            // share the clause with other workers
+            if ( p->pExch )
+                Pdr_ManExchExport( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1372,6 +1376,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pExch && Pdr_ManExchImport( p ) == -1 )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1661,6 +1667,12 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 return -1;
             }
         }
+        // add the clauses learned by other workers
+        if ( p->pExch && Pdr_ManExchImport( p ) == -1 )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
@@ -1773,6 +1785,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         pPars->nTimeOutOne = 0;
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
         pPars->nTimeOut = pPars->nTimeOutOne * Saig_ManPoNum(pAig) / 1000 + (int)((pPars->nTimeOutOne * Saig_ManPoNum(pAig) % 1000) > 0);
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs && !pPars->fUseBridge )
+        return Pdr_ManSolvePar( pAig, pPars );
     if ( pPars->fVerbose )
     {
 //    Abc_Print( 1, "Running PDR by Niklas Een (aka IC3 by Aaron Bradley) with these parameters:\n" );
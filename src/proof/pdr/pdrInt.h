@@ -92,6 +92,8 @@ struct Pdr_Obl_t_
     Pdr_Obl_t * pLink;     // queue link
 };
 
+typedef struct Pdr_Exch_t_ Pdr_Exch_t;
+
 typedef struct Pdr_Man_t_ Pdr_Man_t;
 struct Pdr_Man_t_
 {
@@ -172,6 +174,13 @@ struct Pdr_Man_t_
     abctime     tCnf;
     abctime     tAbs;
     abctime     tTotal;
+    // parallel solving
+    Pdr_Exch_t * pExch;    // lemma exchange shared by the workers
+    int         iWorker;   // the index of this worker
+    int         iExch;     // the next lemma to import
+    int         nExport;   // the number of exported lemmas
+    int         nImport;   // the number of imported lemmas
+    int         nImportTry;// the number of lemmas checked for import
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -202,6 +211,7 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -216,6 +226,11 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars );
+extern void            Pdr_ManExchExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManExchImport( Pdr_Man_t * p );
+extern int             Pdr_ManExchStopped( Pdr_Man_t * p );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -0,0 +1,413 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with lemma sharing.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int  Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nProcs = pPars->nProcs;
+    pPars->nProcs = 1;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nProcs = nProcs;
+    return RetValue;
+}
+void Pdr_ManExchExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+int  Pdr_ManExchImport( Pdr_Man_t * p )                          { return 0; }
+int  Pdr_ManExchStopped( Pdr_Man_t * p )                         { return 0; }
+
+#else // pthreads are used
+
+#define PDR_LEM_MAX (1 << 18)
+
+// lemma in the exchange
+typedef struct Pdr_Lem_t_ Pdr_Lem_t;
+struct Pdr_Lem_t_
+{
+    atomic_int   fReady;     // set after the lemma is written
+    int          iWorker;    // the worker that derived the lemma
+    int          iFrame;     // the last frame where the lemma holds
+    Pdr_Set_t *  pSet;       // private copy of the cube
+};
+
+// lemma exchange
+struct Pdr_Exch_t_
+{
+    atomic_int   nLems;      // the number of reserved entries
+    atomic_int   iWinner;    // the worker that solved the problem (-1 if none)
+    int          nLemsMax;   // the capacity of the exchange
+    Pdr_Lem_t *  pLems;      // the append-only array of lemmas
+};
+
+// worker data
+typedef struct Pdr_ThData_t_ Pdr_ThData_t;
+struct Pdr_ThData_t_
+{
+    Aig_Man_t *  pAig;       // private copy of the AIG
+    Pdr_Par_t    Pars;       // diversified parameters
+    Pdr_Man_t *  p;          // PDR manager
+    Pdr_Exch_t * pExch;      // lemma exchange
+    int          iWorker;    // the index of this worker
+    int          Result;     // the result of this worker
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Lemma exchange.]
+
+  Description [The exchange is an append-only array of lemmas. A worker
+  reserves an entry by incrementing the atomic counter, writes the lemma
+  and raises the ready flag of the entry. Each worker reads the entries
+  in order, starting from the first one it has not seen, and stops at the
+  first entry that is not ready yet. When the array is full, the lemmas
+  are not shared any more. The exchange also records the worker that
+  solved the problem, which tells the other workers to stop.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Exch_t * Pdr_ManExchStart( int nLemsMax )
+{
+    Pdr_Exch_t * p = ABC_CALLOC( Pdr_Exch_t, 1 );
+    int i;
+    p->nLemsMax = nLemsMax;
+    p->pLems    = ABC_CALLOC( Pdr_Lem_t, nLemsMax );
+    for ( i = 0; i < nLemsMax; i++ )
+        atomic_store_explicit( &p->pLems[i].fReady, 0, memory_order_relaxed );
+    atomic_store_explicit( &p->nLems, 0, memory_order_relaxed );
+    atomic_store_explicit( &p->iWinner, -1, memory_order_release );
+    return p;
+}
+void Pdr_ManExchStop( Pdr_Exch_t * p )
+{
+    int i, nLems = Abc_MinInt( atomic_load(&p->nLems), p->nLemsMax );
+    for ( i = 0; i < nLems; i++ )
+        if ( p->pLems[i].pSet )
+            Pdr_SetDeref( p->pLems[i].pSet );
+    ABC_FREE( p->pLems );
+    ABC_FREE( p );
+}
+int Pdr_ManExchStopped( Pdr_Man_t * p )
+{
+    return p->pExch && atomic_load_explicit( &p->pExch->iWinner, memory_order_acquire ) >= 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Shares the clause added to frame k with other workers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManExchExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Lem_t * pLem;
+    Pdr_Set_t * pSet;
+    int i, iLem = atomic_fetch_add( &p->pExch->nLems, 1 );
+    if ( iLem >= p->pExch->nLemsMax )
+        return;
+    // copy only the flop literals
+    pSet = Pdr_SetAlloc( pCube->nLits );
+    pSet->nRefs  = 1;
+    pSet->nLits  = pSet->nTotal = pCube->nLits;
+    pSet->Sign   = pCube->Sign;
+    for ( i = 0; i < pCube->nLits; i++ )
+        pSet->Lits[i] = pCube->Lits[i];
+    pLem = p->pExch->pLems + iLem;
+    pLem->iWorker = p->iWorker;
+    pLem->iFrame  = k;
+    pLem->pSet    = pSet;
+    atomic_store_explicit( &pLem->fReady, 1, memory_order_release );
+    p->nExport++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses derived by other workers.]
+
+  Description [A clause holding in frame k of another worker is added
+  to frame k of this worker (or to the last frame, if this worker has
+  fewer frames) only if it is inductive relative to the previous frame.
+  This keeps the frames of this worker valid, so that the invariant and
+  the counter-examples are derived in the same way as without sharing.
+  Returns -1 if the problem is solved by another worker or if the
+  resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManExchImport( Pdr_Man_t * p )
+{
+    Pdr_Exch_t * pExch = p->pExch;
+    Pdr_Lem_t * pLem;
+    Pdr_Set_t * pCube;
+    int i, k, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    int nLems = Abc_MinInt( atomic_load_explicit(&pExch->nLems, memory_order_acquire), pExch->nLemsMax );
+    if ( Pdr_ManExchStopped(p) )
+        return -1;
+    for ( ; p->iExch < nLems; p->iExch++ )
+    {
+        pLem = pExch->pLems + p->iExch;
+        if ( !atomic_load_explicit(&pLem->fReady, memory_order_acquire) )
+            break;
+        if ( pLem->iWorker == p->iWorker )
+            continue;
+        k = Abc_MinInt( pLem->iFrame, kMax );
+        if ( k < 1 || Pdr_ManCheckContainment( p, k, pLem->pSet ) )
+            continue;
+        p->nImportTry++;
+        RetValue = Pdr_ManCheckCube( p, k-1, pLem->pSet, NULL, p->pPars->nConfLimit, 0, 1 );
+        if ( RetValue == -1 )
+            return -1;
+        if ( RetValue == 0 )
+            continue;
+        pCube = Pdr_SetDup( pLem->pSet );
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( i = 1; i <= k; i++ )
+            Pdr_ManSolverAddClause( p, i, pCube );
+        p->nImport++;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Changes the generalization settings of the worker.]
+
+  Description [The first worker uses the parameters given by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParDiversify( Pdr_Par_t * pPars, int iWorker )
+{
+    pPars->nRandomSeed += 1000003 * iWorker;
+    if ( iWorker % 4 == 1 )
+        pPars->fTwoRounds ^= 1;
+    else if ( iWorker % 4 == 2 )
+        pPars->fFlopOrder ^= 1;
+    else if ( iWorker % 4 == 3 )
+        pPars->fSkipDown ^= 1;
+    if ( (iWorker / 4) % 2 == 1 )
+        pPars->fSimpleGeneral ^= 1;
+    // the workers are silent
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem by one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    int iNone = -1;
+    pThData->p = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    pThData->p->pExch   = pThData->pExch;
+    pThData->p->iWorker = pThData->iWorker;
+    pThData->Result = Pdr_ManSolveInt( pThData->p );
+    if ( pThData->Result != -1 )
+        atomic_compare_exchange_strong( &pThData->pExch->iWinner, &iNone, pThData->iWorker );
+    pThData->p->tTotal += Abc_Clock() - clk;
+    return pThData->Result;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPrintWorker( Pdr_ThData_t * pThData, int iWinner )
+{
+    Pdr_Man_t * p = pThData->p;
+    Abc_Print( 1, "Worker %2d : Gen = %c%c%c%c  Frames = %4d  Cubes = %7d  Export = %7d  Import = %7d (%7d)  Calls = %8d  ",
+        pThData->iWorker,
+        pThData->Pars.fTwoRounds ? 'r' : '-', pThData->Pars.fFlopOrder ? 'f' : '-',
+        pThData->Pars.fSkipDown ? 'n' : '-', pThData->Pars.fSimpleGeneral ? 'j' : '-',
+        p->nFrames, p->nCubes, p->nExport, p->nImport, p->nImportTry, p->nCalls );
+    Abc_PrintTime( 1, pThData->iWorker == iWinner ? "Time (solved)" : "Time", p->tTotal );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several PDR workers sharing the learned clauses.]
+
+  Description [Each worker has its own copy of the AIG and its own frames,
+  while the generalization settings and the random seed are different.
+  The clauses added to the frames are shared through the lemma exchange.
+  The first worker to solve the problem stops the others, and its
+  manager is used to derive the counter-example or the invariant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Util_Task_t * pTasks[UTIL_POOL_THR_MAX];
+    Pdr_ThData_t * pThData;
+    Pdr_Exch_t * pExch;
+    Pdr_Man_t * pWin;
+    int i, iWinner, iBest = 0, RetValue = -1;
+    int nProcs = Abc_MinInt( pPars->nProcs, UTIL_POOL_THR_MAX );
+    abctime clk = Abc_Clock();
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running %d PDR workers sharing clauses. VarMax = %d. FrameMax = %d. QueMax = %d. TimeMax = %d.\n",
+            nProcs, pPars->nRecycle, pPars->nFrameMax, pPars->nRestLimit, pPars->nTimeOut );
+    ABC_FREE( pAig->pSeqModel );
+    pExch   = Pdr_ManExchStart( PDR_LEM_MAX );
+    pThData = ABC_CALLOC( Pdr_ThData_t, nProcs );
+    Util_PoolStart( nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pAig    = Aig_ManDupSimple( pAig );
+        pThData[i].Pars    = *pPars;
+        Pdr_ManParDiversify( &pThData[i].Pars, i );
+        pThData[i].pExch   = pExch;
+        pThData[i].iWorker = i;
+        pThData[i].Result  = -1;
+        pTasks[i] = Util_PoolSubmit( Pdr_ManWorkerThread, pThData + i );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Util_TaskWait( pTasks[i], 0 );
+        Util_TaskFree( pTasks[i] );
+    }
+    // select the worker whose results are reported
+    iWinner = atomic_load( &pExch->iWinner );
+    if ( iWinner >= 0 )
+        iBest = iWinner, RetValue = pThData[iWinner].Result;
+    else
+        for ( i = 1; i < nProcs; i++ )
+            if ( pThData[iBest].Pars.iFrame < pThData[i].Pars.iFrame )
+                iBest = i;
+    pWin = pThData[iBest].p;
+    pPars->iFrame = pThData[iBest].Pars.iFrame;
+    if ( RetValue == 0 )
+    {
+        assert( pWin->pAig->pSeqModel != NULL );
+        pAig->pSeqModel = pWin->pAig->pSeqModel;
+        pWin->pAig->pSeqModel = NULL;
+    }
+    if ( pPars->fVerbose )
+    {
+        Pdr_ManPrintProgress( pWin, 1, Abc_Clock() - clk );
+        for ( i = 0; i < nProcs; i++ )
+            Pdr_ManPrintWorker( pThData + i, iWinner );
+    }
+    if ( !pPars->fSilent )
+    {
+        if ( RetValue == 1 )
+        {
+            Pdr_ManReportInvariant( pWin );
+            Pdr_ManVerifyInvariant( pWin );
+        }
+        else if ( RetValue == -1 && pPars->nTimeOut && Abc_Clock() - clk >= (abctime)pPars->nTimeOut * CLOCKS_PER_SEC )
+            Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  pPars->nTimeOut, pPars->iFrame );
+        else if ( RetValue == -1 && pPars->nFrameMax && pPars->iFrame >= pPars->nFrameMax )
+            Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", pPars->nFrameMax );
+        else if ( RetValue == -1 && pPars->nConfLimit )
+            Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  pPars->nConfLimit, pPars->iFrame );
+    }
+    if ( pPars->fDumpInv )
+    {
+        char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, RetValue!=1 ) );
+        Pdr_ManDumpClauses( pWin, pFileName, RetValue==1 );
+        printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+    }
+    else if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, RetValue!=1 ) );
+    // cleanup
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Pdr_ManStop( pThData[i].p );
+        Aig_ManStop( pThData[i].pAig );
+    }
+    ABC_FREE( pThData );
+    Pdr_ManExchStop( pExch );
+    pPars->iFrame--;
+    if ( pPars->pFuncProgress && (RetValue == 0 || RetValue == 1) )
+        pPars->pFuncProgress( pPars->pProgress, 1, (unsigned)RetValue );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
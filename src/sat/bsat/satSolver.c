@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "satSolver.h"
 #include "satStore.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -2069,6 +2070,7 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
 {
     lbool status;
     lit * i;
+    Abc_ProfSatCall();
     ////////////////////////////////////////////////
     if ( s->fSolved )
     {
@@ -25,6 +25,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include <math.h>
 
 #include "satSolver2.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1840,6 +1841,7 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
     int proof_id;
     lit * i;
 
+    Abc_ProfSatCall();
     s->hLearntLast = -1;
     s->hProofLast = -1;
 
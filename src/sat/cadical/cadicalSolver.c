@@ -20,6 +20,7 @@
 
 #include "ccadical.h"
 #include "cadicalSolver.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -48,6 +49,9 @@ cadical_solver* cadical_solver_new(void) {
   s->nVars = 0;
   s->vAssumptions = NULL;
   s->vCore = NULL;
+  s->vLearn = NULL;
+  s->pLearnMan = NULL;
+  s->pLearnFunc = NULL;
   return s;
 }
 
@@ -70,6 +74,9 @@ void cadical_solver_delete(cadical_solver* s) {
   if(s->vCore) {
     Vec_IntFree(s->vCore);
   }
+  if(s->vLearn) {
+    Vec_IntFree(s->vLearn);
+  }
   free(s);
 }
 
@@ -111,6 +118,7 @@ int cadical_solver_addclause(cadical_solver* s, int* begin, int* end) {
 
 ***********************************************************************/
 int cadical_solver_solve(cadical_solver* s, int* begin, int* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal) {
+  Abc_ProfSatCall();
   // inspection limits are not supported
   assert(nInsLimit == 0);
   assert(nInsLimitGlobal == 0);
@@ -297,6 +305,56 @@ int cadical_solver_nconflicts(cadical_solver* s) {
   return ccadical_conflicts((CCaDiCaL*)s->p);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [set termination callback]
+
+  Description [the solver stops as soon as the callback returns non-zero.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void cadical_solver_set_terminate(cadical_solver* s, void* pMan, int (*pFunc)(void*)) {
+  ccadical_set_terminate((CCaDiCaL*)s->p, pMan, pFunc);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [set learned clause callback]
+
+  Description [learned clauses with at most nMaxLen literals are translated
+               back into abc literals and passed to the callback together
+               with their size. cadical does not report glue, so it is
+               given as the clause size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void cadical_solver_learn(void* state, int* clause) {
+  cadical_solver* s = (cadical_solver*)state;
+  Vec_IntClear(s->vLearn);
+  for(; *clause; clause++) {
+    if(*clause < 0) {
+      Vec_IntPush(s->vLearn, Abc_Var2Lit(-(*clause) - 1, 1));
+    } else {
+      Vec_IntPush(s->vLearn, Abc_Var2Lit(  (*clause) - 1, 0));
+    }
+  }
+  s->pLearnFunc(s->pLearnMan, Vec_IntArray(s->vLearn), Vec_IntSize(s->vLearn), Vec_IntSize(s->vLearn));
+}
+void cadical_solver_set_learn(cadical_solver* s, int nMaxLen, void* pMan, void (*pFunc)(void*, int*, int, int)) {
+  if(s->vLearn == NULL) {
+    s->vLearn = Vec_IntAlloc(nMaxLen);
+  }
+  s->pLearnMan = pMan;
+  s->pLearnFunc = pFunc;
+  ccadical_set_learn((CCaDiCaL*)s->p, s, nMaxLen, pFunc ? cadical_solver_learn : NULL);
+}
+
 
 /**Function*************************************************************
 
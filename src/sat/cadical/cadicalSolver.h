@@ -45,6 +45,9 @@ struct cadical_solver_
   int nVars;
   Vec_Int_t* vAssumptions;
   Vec_Int_t* vCore;
+  Vec_Int_t* vLearn;
+  void* pLearnMan;
+  void (*pLearnFunc)(void*, int*, int, int);
 };
 
 
@@ -67,6 +70,8 @@ extern void             cadical_solver_setnvars(cadical_solver* s,int n);
 extern int              cadical_solver_get_var_value(cadical_solver* s, int v);
 extern int              cadical_solver_nclauses(cadical_solver* s);
 extern int              cadical_solver_nconflicts(cadical_solver* s);
+extern void             cadical_solver_set_terminate(cadical_solver* s, void* pMan, int (*pFunc)(void*));
+extern void             cadical_solver_set_learn(cadical_solver* s, int nMaxLen, void* pMan, void (*pFunc)(void*, int*, int, int));
 extern Vec_Int_t *      cadical_solve_cnf( Cnf_Dat_t * pCnf, char * pArgs, int nConfs, int nTimeLimit, int fSat, int fUnsat, int fPrintCex, int fVerbose );
 
 ABC_NAMESPACE_HEADER_END
@@ -52,6 +52,10 @@ typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
 
+// the callback receiving clauses derived by the streaming CNF generator
+// (returns 0 to stop the generation, for example, when the solver is UNSAT)
+typedef int (*Cnf_ClauseFunc_t)( void * pUser, int * pBeg, int * pEnd );
+
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
 {
@@ -148,6 +152,10 @@ extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+extern Cnf_Dat_t *     Cnf_DeriveFastPar( Aig_Man_t * p, int nOutputs, int nProcs );
+extern int             Cnf_DeriveFastStream( Aig_Man_t * p, int nOutputs, int nProcs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pUser, int ** ppVarNums );
+extern void *          Cnf_DeriveFastIntoSolver( Aig_Man_t * p, int nOutputs, int nProcs, int ** ppVarNums );
+extern int             Cnf_DeriveFastWriteDimacs( Aig_Man_t * p, int nOutputs, int nProcs, int fChangePol, char * pFileName, int * pnClauses, int * pnLiterals );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
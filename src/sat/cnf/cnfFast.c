@@ -20,6 +20,7 @@
 
 #include "cnf.h"
 #include "bool/kit/kit.h"
+#include "sat/bsat/satSolver.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +28,24 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CNF_FAST_THR_MAX  100         // the largest number of threads
+#define CNF_FAST_BATCH    (1 << 14)   // the number of roots given to a thread at a time
+
+typedef struct Cnf_FastTh_t_ Cnf_FastTh_t;
+struct Cnf_FastTh_t_
+{
+    Aig_Man_t *     p;          // the marked AIG
+    Vec_Int_t *     vMap;       // the mapping of objects into SAT variables
+    Vec_Ptr_t *     vRoots;     // the marked nodes in the order of their clauses
+    int             iBeg;       // the first root of this thread
+    int             iEnd;       // the first root of the next thread
+    Vec_Ptr_t *     vLeaves;    // temporary storage
+    Vec_Ptr_t *     vNodes;     // temporary storage
+    Vec_Int_t *     vCover;     // temporary storage
+    Vec_Int_t *     vTemp;      // the clauses of one root
+    Vec_Int_t *     vClauses;   // the clauses of this thread's range
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -93,9 +112,10 @@ void Cnf_CollectLeaves( Aig_Obj_t * pRoot, Vec_Ptr_t * vSuper, int fStopCompl )
 ***********************************************************************/
 void Cnf_CollectVolume_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes )
 {
-    if ( Aig_ObjIsTravIdCurrent( p, pObj ) )
+    if ( pObj->fMarkA )
+        return;
+    if ( Aig_ObjRefs(pObj) > 1 && Vec_PtrFind(vNodes, pObj) >= 0 )
         return;
-    Aig_ObjSetTravIdCurrent( p, pObj );
     assert( Aig_ObjIsNode(pObj) );
     Cnf_CollectVolume_rec( p, Aig_ObjFanin0(pObj), vNodes );
     Cnf_CollectVolume_rec( p, Aig_ObjFanin1(pObj), vNodes );
@@ -106,7 +126,10 @@ void Cnf_CollectVolume_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes
 
   Synopsis    [Collects nodes inside the cone.]
 
-  Description []
+  Description [The leaves are the marked nodes reachable from the root.
+  The internal nodes are not marked and, unless they feed the same MUX
+  twice, have one fanout, so the traversal does not use the traversal
+  IDs and can be run for different roots concurrently.]
                
   SideEffects []
 
@@ -115,26 +138,30 @@ void Cnf_CollectVolume_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes
 ***********************************************************************/
 void Cnf_CollectVolume( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes )
 {
-    Aig_Obj_t * pObj;
-    int i;
-    Aig_ManIncrementTravId( p );
-    Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
-        Aig_ObjSetTravIdCurrent( p, pObj );
+    assert( pRoot->fMarkA );
     Vec_PtrClear( vNodes );
-    Cnf_CollectVolume_rec( p, pRoot, vNodes );
+    Cnf_CollectVolume_rec( p, Aig_ObjFanin0(pRoot), vNodes );
+    Cnf_CollectVolume_rec( p, Aig_ObjFanin1(pRoot), vNodes );
+    Vec_PtrPush( vNodes, pRoot );
 }
 
 /**Function*************************************************************
 
   Synopsis    [Derive truth table.]
 
-  Description []
+  Description [The leaves are looked up in the array, because they may
+  belong to the cones processed by other threads.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Cnf_CutObjNum( Vec_Ptr_t * vLeaves, Aig_Obj_t * pObj )
+{
+    int k = Vec_PtrFind( vLeaves, pObj );
+    return k >= 0 ? k : pObj->iData;
+}
 word Cnf_CutDeriveTruth( Aig_Man_t * p, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes )
 {
     static word Truth6[6] = {
@@ -146,21 +173,18 @@ word Cnf_CutDeriveTruth( Aig_Man_t * p, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vNodes
         ABC_CONST(0xFFFFFFFF00000000)
     };
     static word C[2] = { 0, ~(word)0 };
-    static word S[256];
+    word S[256];
     Aig_Obj_t * pObj = NULL;
     int i;
     assert( Vec_PtrSize(vLeaves) <= 6 && Vec_PtrSize(vNodes) > 0 );
     assert( Vec_PtrSize(vLeaves) + Vec_PtrSize(vNodes) <= 256 );
     Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
-    {
-        pObj->iData    = i;
-        S[pObj->iData] = Truth6[i];
-    }
+        S[i] = Truth6[i];
     Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
     {
         pObj->iData    = Vec_PtrSize(vLeaves) + i;
-        S[pObj->iData] = (S[Aig_ObjFanin0(pObj)->iData] ^ C[Aig_ObjFaninC0(pObj)]) & 
-                         (S[Aig_ObjFanin1(pObj)->iData] ^ C[Aig_ObjFaninC1(pObj)]);
+        S[pObj->iData] = (S[Cnf_CutObjNum(vLeaves, Aig_ObjFanin0(pObj))] ^ C[Aig_ObjFaninC0(pObj)]) & 
+                         (S[Cnf_CutObjNum(vLeaves, Aig_ObjFanin1(pObj))] ^ C[Aig_ObjFaninC1(pObj)]);
     }
     return S[pObj->iData];
 }
@@ -530,29 +554,77 @@ int Cnf_CountCnfSize( Aig_Man_t * p )
     return nClauses;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the clauses of a range of marked nodes.]
+
+  Description [Each thread derives the clauses of a contiguous range of
+  roots into its own array, in the format of Cnf_ComputeClauses().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_DeriveFastWorker( void * pArg )
+{
+    Cnf_FastTh_t * pTh = (Cnf_FastTh_t *)pArg;
+    Aig_Obj_t * pObj;
+    int i;
+    Vec_IntClear( pTh->vClauses );
+    for ( i = pTh->iBeg; i < pTh->iEnd; i++ )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( pTh->vRoots, i );
+        Cnf_ComputeClauses( pTh->p, pObj, pTh->vLeaves, pTh->vNodes, pTh->vMap, pTh->vCover, pTh->vTemp );
+        Vec_IntAppend( pTh->vClauses, pTh->vTemp );
+    }
+    return 0;
+}
+static int Cnf_DeriveFastEmit( int * pBeg, int * pStop, int * pPols, Cnf_ClauseFunc_t pFunc, void * pUser )
+{
+    int * pEnd;
+    while ( pBeg < pStop )
+    {
+        assert( *pBeg == 0 );
+        for ( pEnd = ++pBeg; pEnd < pStop && *pEnd; pEnd++ )
+            if ( pPols )
+                *pEnd ^= pPols[Abc_Lit2Var(*pEnd)];
+        if ( !pFunc( pUser, pBeg, pEnd ) )
+            return 0;
+        pBeg = pEnd;
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF from the marked AIG.]
 
   Description [Assumes that marking is such that when we traverse from each
-  marked node, the logic cone has 6 inputs or less, or it is a multi-input AND.]
+  marked node, the logic cone has 6 inputs or less, or it is a multi-input AND.
+  The clauses are passed to the callback as they are derived, in the same
+  order for any number of threads. The marked nodes are processed in batches,
+  and each thread of a batch works on a contiguous range of them. Returns
+  the number of variables, or -1 if the callback returned 0 for some clause.
+  If fChangePol is set, the literals of the variables of the nodes and CIs
+  are complemented when the node's phase is 1 (see Cnf_DataTranformPolarity).
+  If ppVarNums is not NULL, it is set to the mapping of objects into SAT
+  variables, which should be freed by the caller.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
+int Cnf_DeriveFastClausesStream( Aig_Man_t * p, int nOutputs, int nProcs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pUser, int ** ppVarNums )
 {
-    Cnf_Dat_t * pCnf;
-    Vec_Int_t * vLits, * vClas, * vMap, * vTemp;
-    Vec_Ptr_t * vLeaves, * vNodes;
-    Vec_Int_t * vCover;
+    Cnf_FastTh_t ThData[CNF_FAST_THR_MAX];
+    Util_Task_t * pTasks[CNF_FAST_THR_MAX];
+    Vec_Int_t * vMap;
+    Vec_Ptr_t * vRoots;
     Aig_Obj_t * pObj;
-    int i, k, nVars, Entry, OutLit, DriLit;
-
-    vLits = Vec_IntAlloc( 1 << 16 );
-    vClas = Vec_IntAlloc( 1 << 12 );
+    int i, k, iStart, nVars, OutLit, DriLit, Lits[3], * pPols = NULL, RetValue = 1;
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, CNF_FAST_THR_MAX) );
     vMap  = Vec_IntStartFull( Aig_ManObjNumMax(p) );
 
     // assign variables for the outputs
@@ -573,84 +645,167 @@ Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
         }
     }
     // assign variables to the internal nodes
+    vRoots = Vec_PtrAlloc( Aig_ManNodeNum(p) );
     Aig_ManForEachNodeReverse( p, pObj, i )
         if ( pObj->fMarkA )
+        {
             Vec_IntWriteEntry( vMap, Aig_ObjId(pObj), nVars++ );
+            Vec_PtrPush( vRoots, pObj );
+        }
     // assign variables to the PIs and constant node
     Aig_ManForEachCi( p, pObj, i )
         Vec_IntWriteEntry( vMap, Aig_ObjId(pObj), nVars++ );
     Vec_IntWriteEntry( vMap, Aig_ObjId(Aig_ManConst1(p)), nVars++ );
+    // collect the polarity of the variables
+    if ( fChangePol )
+    {
+        pPols = ABC_CALLOC( int, nVars );
+        Aig_ManForEachObj( p, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && Vec_IntEntry(vMap, Aig_ObjId(pObj)) >= 0 )
+                pPols[Vec_IntEntry(vMap, Aig_ObjId(pObj))] = pObj->fPhase;
+    }
 
     // create clauses
-    vLeaves = Vec_PtrAlloc( 100 );
-    vNodes  = Vec_PtrAlloc( 100 );
-    vCover  = Vec_IntAlloc( 1 << 16 );
-    vTemp   = Vec_IntAlloc( 100 );
-    Aig_ManForEachNodeReverse( p, pObj, i )
+    if ( nProcs > 1 )
+        Util_PoolStart( nProcs );
+    memset( ThData, 0, sizeof(Cnf_FastTh_t) * nProcs );
+    for ( k = 0; k < nProcs; k++ )
     {
-        if ( !pObj->fMarkA )
-            continue;
-        Cnf_ComputeClauses( p, pObj, vLeaves, vNodes, vMap, vCover, vTemp );
-        Vec_IntForEachEntry( vTemp, Entry, k )
+        ThData[k].p        = p;
+        ThData[k].vMap     = vMap;
+        ThData[k].vRoots   = vRoots;
+        ThData[k].vLeaves  = Vec_PtrAlloc( 100 );
+        ThData[k].vNodes   = Vec_PtrAlloc( 100 );
+        ThData[k].vCover   = Vec_IntAlloc( 1 << 16 );
+        ThData[k].vTemp    = Vec_IntAlloc( 100 );
+        ThData[k].vClauses = Vec_IntAlloc( 1 << 16 );
+    }
+    for ( iStart = 0; RetValue && iStart < Vec_PtrSize(vRoots); iStart += nProcs * CNF_FAST_BATCH )
+    {
+        for ( k = 0; k < nProcs; k++ )
         {
-            if ( Entry == 0 )
-                Vec_IntPush( vClas, Vec_IntSize(vLits) );
+            ThData[k].iBeg = Abc_MinInt( iStart + k * CNF_FAST_BATCH, Vec_PtrSize(vRoots) );
+            ThData[k].iEnd = Abc_MinInt( iStart + (k + 1) * CNF_FAST_BATCH, Vec_PtrSize(vRoots) );
+            if ( nProcs > 1 )
+                pTasks[k] = Util_PoolSubmit( Cnf_DeriveFastWorker, ThData + k );
             else
-                Vec_IntPush( vLits, Entry );
-        }       
+                Cnf_DeriveFastWorker( ThData + k );
+        }
+        // the clauses of each range are passed on while the next ranges are computed
+        for ( k = 0; k < nProcs; k++ )
+        {
+            if ( nProcs > 1 )
+            {
+                Util_TaskWait( pTasks[k], 0 );
+                Util_TaskFree( pTasks[k] );
+            }
+            if ( RetValue )
+                RetValue = Cnf_DeriveFastEmit( Vec_IntArray(ThData[k].vClauses), Vec_IntLimit(ThData[k].vClauses), pPols, pFunc, pUser );
+        }
     }
-    Vec_PtrFree( vLeaves );
-    Vec_PtrFree( vNodes );
-    Vec_IntFree( vCover );
-    Vec_IntFree( vTemp );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Vec_PtrFree( ThData[k].vLeaves );
+        Vec_PtrFree( ThData[k].vNodes );
+        Vec_IntFree( ThData[k].vCover );
+        Vec_IntFree( ThData[k].vTemp );
+        Vec_IntFree( ThData[k].vClauses );
+    }
+    Vec_PtrFree( vRoots );
 
     // create clauses for the outputs
     Aig_ManForEachCo( p, pObj, i )
     {
+        if ( !RetValue )
+            break;
         DriLit = Cnf_ObjGetLit( vMap, Aig_ObjFanin0(pObj), Aig_ObjFaninC0(pObj) );
         if ( i < Aig_ManCoNum(p) - nOutputs )
         {
-            Vec_IntPush( vClas, Vec_IntSize(vLits) );
-            Vec_IntPush( vLits, DriLit );
+            Lits[0] = 0;
+            Lits[1] = DriLit;
+            RetValue = Cnf_DeriveFastEmit( Lits, Lits + 2, pPols, pFunc, pUser );
         }
         else
         {
             OutLit = Cnf_ObjGetLit( vMap, pObj, 0 );
             // first clause
-            Vec_IntPush( vClas, Vec_IntSize(vLits) );
-            Vec_IntPush( vLits, OutLit );
-            Vec_IntPush( vLits, DriLit ^ 1 );
+            Lits[0] = 0;
+            Lits[1] = OutLit;
+            Lits[2] = DriLit ^ 1;
+            RetValue = Cnf_DeriveFastEmit( Lits, Lits + 3, pPols, pFunc, pUser );
+            if ( !RetValue )
+                break;
             // second clause
-            Vec_IntPush( vClas, Vec_IntSize(vLits) );
-            Vec_IntPush( vLits, OutLit ^ 1 );
-            Vec_IntPush( vLits, DriLit );
+            Lits[0] = 0;
+            Lits[1] = OutLit ^ 1;
+            Lits[2] = DriLit;
+            RetValue = Cnf_DeriveFastEmit( Lits, Lits + 3, pPols, pFunc, pUser );
         }
     }
  
     // write the constant literal
-    OutLit = Cnf_ObjGetLit( vMap, Aig_ManConst1(p), 0 );
-    Vec_IntPush( vClas, Vec_IntSize(vLits) );
-    Vec_IntPush( vLits, OutLit );
+    if ( RetValue )
+    {
+        Lits[0] = 0;
+        Lits[1] = Cnf_ObjGetLit( vMap, Aig_ManConst1(p), 0 );
+        RetValue = Cnf_DeriveFastEmit( Lits, Lits + 2, pPols, pFunc, pUser );
+    }
+    ABC_FREE( pPols );
+    if ( ppVarNums )
+        *ppVarNums = Vec_IntReleaseArray( vMap );
+    Vec_IntFree( vMap );
+    return RetValue ? nVars : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF from the marked AIG.]
+
+  Description [Collects the streamed clauses into the CNF data structure.]
+               
+  SideEffects []
 
-    // create structure
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_FastCollect_t_ Cnf_FastCollect_t;
+struct Cnf_FastCollect_t_
+{
+    Vec_Int_t *     vLits;      // the literals of all clauses
+    Vec_Int_t *     vClas;      // the beginning of each clause
+};
+static int Cnf_DeriveFastCollect( void * pUser, int * pBeg, int * pEnd )
+{
+    Cnf_FastCollect_t * pColl = (Cnf_FastCollect_t *)pUser;
+    Vec_IntPush( pColl->vClas, Vec_IntSize(pColl->vLits) );
+    Vec_IntPushArray( pColl->vLits, pBeg, pEnd - pBeg );
+    return 1;
+}
+Cnf_Dat_t * Cnf_DeriveFastClausesPar( Aig_Man_t * p, int nOutputs, int nProcs )
+{
+    Cnf_FastCollect_t Coll;
+    Cnf_Dat_t * pCnf;
+    int i, Entry;
+    Coll.vLits = Vec_IntAlloc( 1 << 16 );
+    Coll.vClas = Vec_IntAlloc( 1 << 12 );
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
-    pCnf->pMan = p;
-    pCnf->nVars = nVars;
-    pCnf->nLiterals = Vec_IntSize( vLits );
-    pCnf->nClauses  = Vec_IntSize( vClas );
+    pCnf->pMan  = p;
+    pCnf->nVars = Cnf_DeriveFastClausesStream( p, nOutputs, nProcs, 0, Cnf_DeriveFastCollect, &Coll, &pCnf->pVarNums );
+    pCnf->nLiterals = Vec_IntSize( Coll.vLits );
+    pCnf->nClauses  = Vec_IntSize( Coll.vClas );
     pCnf->pClauses  = ABC_ALLOC( int *, pCnf->nClauses + 1 );
-    pCnf->pClauses[0] = Vec_IntReleaseArray( vLits );
-    Vec_IntForEachEntry( vClas, Entry, i )
+    pCnf->pClauses[0] = Vec_IntReleaseArray( Coll.vLits );
+    Vec_IntForEachEntry( Coll.vClas, Entry, i )
         pCnf->pClauses[i] = pCnf->pClauses[0] + Entry;
     pCnf->pClauses[pCnf->nClauses] = pCnf->pClauses[0] + pCnf->nLiterals;
-    pCnf->pVarNums  = Vec_IntReleaseArray( vMap );
-
-    // cleanup
-    Vec_IntFree( vLits );
-    Vec_IntFree( vClas );
-    Vec_IntFree( vMap );
+    Vec_IntFree( Coll.vLits );
+    Vec_IntFree( Coll.vClas );
     return pCnf;
 }
+Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
+{
+    return Cnf_DeriveFastClausesPar( p, nOutputs, 1 );
+}
 
 /**Function*************************************************************
 
@@ -663,7 +818,7 @@ Cnf_Dat_t * Cnf_DeriveFastClauses( Aig_Man_t * p, int nOutputs )
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
+Cnf_Dat_t * Cnf_DeriveFastPar( Aig_Man_t * p, int nOutputs, int nProcs )
 {
     Cnf_Dat_t * pCnf = NULL;
     abctime clk;//, clkTotal = Abc_Clock();
@@ -675,7 +830,7 @@ Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
 //    Abc_PrintTime( 1, "Marking", Abc_Clock() - clk );
     // compute CNF size
     clk = Abc_Clock();
-    pCnf = Cnf_DeriveFastClauses( p, nOutputs );
+    pCnf = Cnf_DeriveFastClausesPar( p, nOutputs, nProcs );
 //    Abc_PrintTime( 1, "Clauses", Abc_Clock() - clk );
     // derive the resulting CNF
     Aig_ManCleanMarkA( p );
@@ -687,6 +842,131 @@ Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
 //    pCnf = NULL;
     return pCnf;
 }
+Cnf_Dat_t * Cnf_DeriveFast( Aig_Man_t * p, int nOutputs )
+{
+    return Cnf_DeriveFastPar( p, nOutputs, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fast CNF computation without storing the clauses.]
+
+  Description [Each clause is passed to the callback as soon as it is
+  derived. Returns the number of variables, or -1 if the callback
+  returned 0 for some clause.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveFastStream( Aig_Man_t * p, int nOutputs, int nProcs, int fChangePol, Cnf_ClauseFunc_t pFunc, void * pUser, int ** ppVarNums )
+{
+    int nVars;
+    Aig_ManCleanMarkAB( p );
+    Cnf_DeriveFastMark( p );
+    nVars = Cnf_DeriveFastClausesStream( p, nOutputs, nProcs, fChangePol, pFunc, pUser, ppVarNums );
+    Aig_ManCleanMarkA( p );
+    return nVars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the fast CNF directly into the SAT solver.]
+
+  Description [Returns NULL if the problem is found UNSAT while the
+  clauses are added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_DeriveFastAddClause( void * pUser, int * pBeg, int * pEnd )
+{
+    return sat_solver_addclause( (sat_solver *)pUser, pBeg, pEnd );
+}
+void * Cnf_DeriveFastIntoSolver( Aig_Man_t * p, int nOutputs, int nProcs, int ** ppVarNums )
+{
+    sat_solver * pSat = sat_solver_new();
+    if ( Cnf_DeriveFastStream( p, nOutputs, nProcs, 0, Cnf_DeriveFastAddClause, pSat, ppVarNums ) == -1 )
+    {
+        sat_solver_delete( pSat );
+        return NULL;
+    }
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the fast CNF directly into a DIMACS file.]
+
+  Description [The clauses are written through a buffer as they are
+  derived. The header is written with padded counts and updated at the
+  end. Returns the number of variables, or -1 if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_FastWriter_t_ Cnf_FastWriter_t;
+struct Cnf_FastWriter_t_
+{
+    FILE *          pFile;      // the output file
+    Vec_Str_t *     vBuffer;    // the buffered text
+    int             nClauses;   // the number of clauses written
+    int             nLiterals;  // the number of literals written
+};
+static int Cnf_DeriveFastWriteClause( void * pUser, int * pBeg, int * pEnd )
+{
+    Cnf_FastWriter_t * pWr = (Cnf_FastWriter_t *)pUser;
+    int * pLit;
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+    {
+        Vec_StrPrintNum( pWr->vBuffer, Abc_LitIsCompl(*pLit) ? -Abc_Lit2Var(*pLit)-1 : Abc_Lit2Var(*pLit)+1 );
+        Vec_StrPush( pWr->vBuffer, ' ' );
+    }
+    pWr->nLiterals += pEnd - pBeg;
+    Vec_StrPush( pWr->vBuffer, '0' );
+    Vec_StrPush( pWr->vBuffer, '\n' );
+    if ( Vec_StrSize(pWr->vBuffer) > (1 << 20) )
+    {
+        fwrite( Vec_StrArray(pWr->vBuffer), 1, Vec_StrSize(pWr->vBuffer), pWr->pFile );
+        Vec_StrClear( pWr->vBuffer );
+    }
+    pWr->nClauses++;
+    return 1;
+}
+int Cnf_DeriveFastWriteDimacs( Aig_Man_t * p, int nOutputs, int nProcs, int fChangePol, char * pFileName, int * pnClauses, int * pnLiterals )
+{
+    Cnf_FastWriter_t Wr;
+    long Header;
+    int nVars;
+    Wr.pFile = fopen( pFileName, "wb" );
+    if ( Wr.pFile == NULL )
+    {
+        printf( "Cnf_DeriveFastWriteDimacs(): Output file \"%s\" cannot be opened.\n", pFileName );
+        return -1;
+    }
+    Wr.vBuffer  = Vec_StrAlloc( (1 << 20) + 1000 );
+    Wr.nClauses = Wr.nLiterals = 0;
+    fprintf( Wr.pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    Header = ftell( Wr.pFile );
+    fprintf( Wr.pFile, "p cnf %-12d %-12d\n", 0, 0 );
+    nVars = Cnf_DeriveFastStream( p, nOutputs, nProcs, fChangePol, Cnf_DeriveFastWriteClause, &Wr, NULL );
+    fwrite( Vec_StrArray(Wr.vBuffer), 1, Vec_StrSize(Wr.vBuffer), Wr.pFile );
+    fprintf( Wr.pFile, "\n" );
+    fseek( Wr.pFile, Header, SEEK_SET );
+    fprintf( Wr.pFile, "p cnf %-12d %-12d\n", nVars, Wr.nClauses );
+    fclose( Wr.pFile );
+    Vec_StrFree( Wr.vBuffer );
+    if ( pnClauses )
+        *pnClauses = Wr.nClauses;
+    if ( pnLiterals )
+        *pnLiterals = Wr.nLiterals;
+    return nVars;
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
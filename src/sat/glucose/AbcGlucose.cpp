@@ -30,6 +30,7 @@
 #include "aig/gia/gia.h"
 #include "sat/cnf/cnf.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -99,6 +100,7 @@ void glucose_solver_setcallback(Gluco::SimpSolver* S, void * pman, int(*pfunc)(v
 
 int glucose_solver_solve(Gluco::SimpSolver* S, int * plits, int nlits)
 {
+    Abc_ProfSatCall();
     vec<Lit> lits;
     for (int i=0;i<nlits;i++,plits++)
     {
@@ -438,6 +440,7 @@ void glucose_solver_setcallback(Gluco::Solver* S, void * pman, int(*pfunc)(void*
 
 int glucose_solver_solve(Gluco::Solver* S, int * plits, int nlits)
 {
+    Abc_ProfSatCall();
     vec<Lit> lits;
     for (int i=0;i<nlits;i++,plits++)
     {
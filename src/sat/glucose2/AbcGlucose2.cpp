@@ -30,6 +30,7 @@
 #include "aig/gia/gia.h"
 #include "sat/cnf/cnf.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -99,6 +100,7 @@ void glucose2_solver_setcallback(Gluco2::SimpSolver* S, void * pman, int(*pfunc)
 
 int glucose2_solver_solve(Gluco2::SimpSolver* S, int * plits, int nlits)
 {
+    Abc_ProfSatCall();
 //    vec<Lit> lits;
 //    for (int i=0;i<nlits;i++,plits++)
 //    {
@@ -132,6 +134,12 @@ void glucose2_solver_setstop(Gluco2::SimpSolver* S, int * pstop)
     S->pstop = pstop;
 }
 
+void glucose2_solver_setlearn(Gluco2::SimpSolver* S, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    S->pLearnMan = pman;
+    S->pLearnFunc = pfunc;
+}
+
 void glucose2_markapprox( Gluco2::SimpSolver* S, int v0, int v1, int nlim )
 {
     S->markApprox(v0, v1, nlim);
@@ -232,6 +240,11 @@ void bmcg2_sat_solver_set_stop(bmcg2_sat_solver* s, int * pstop)
     glucose2_solver_setstop((Gluco2::SimpSolver*)s, pstop);
 }
 
+void bmcg2_sat_solver_set_learn_callback(bmcg2_sat_solver* s, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    glucose2_solver_setlearn((Gluco2::SimpSolver*)s, pman, pfunc);
+}
+
 void bmcg2_sat_solver_markapprox(bmcg2_sat_solver* s, int v0, int v1, int nlim)
 {
     glucose2_markapprox((Gluco2::SimpSolver*)s, v0, v1, nlim);
@@ -451,6 +464,7 @@ void glucose2_solver_setcallback(Gluco2::Solver* S, void * pman, int(*pfunc)(voi
 
 int glucose2_solver_solve(Gluco2::Solver* S, int * plits, int nlits)
 {
+    Abc_ProfSatCall();
     vec<Lit> lits;
     for (int i=0;i<nlits;i++,plits++)
     {
@@ -483,6 +497,12 @@ void glucose2_solver_setstop(Gluco2::Solver* S, int * pstop)
     S->pstop = pstop;
 }
 
+void glucose2_solver_setlearn(Gluco2::Solver* S, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    S->pLearnMan = pman;
+    S->pLearnFunc = pfunc;
+}
+
 void glucose2_markapprox( Gluco2::Solver* S, int v0, int v1, int nlim )
 {
     S->markApprox(v0, v1, nlim);
@@ -584,6 +604,11 @@ void bmcg2_sat_solver_set_stop(bmcg2_sat_solver* s, int * pstop)
     glucose2_solver_setstop((Gluco2::Solver*)s, pstop);
 }
 
+void bmcg2_sat_solver_set_learn_callback(bmcg2_sat_solver* s, void * pman, void(*pfunc)(void*, int*, int, int))
+{
+    glucose2_solver_setlearn((Gluco2::Solver*)s, pman, pfunc);
+}
+
 void bmcg2_sat_solver_markapprox(bmcg2_sat_solver* s, int v0, int v1, int nlim)
 {
     glucose2_markapprox((Gluco2::Solver*)s, v0, v1, nlim);
@@ -97,6 +97,8 @@ Solver::Solver() :
     , nCallConfl(1000)
     , terminate_search_early(false)
     , pstop(NULL)
+    , pLearnMan(NULL)
+    , pLearnFunc(NULL)
     , nRuntimeLimit(0)
 
     , verbosity      (0)
@@ -1245,6 +1247,8 @@ lbool Solver::search(int nof_conflicts)
             learnt_clause.shrink_( learnt_clause.size() );
             selectors    .shrink_( selectors.size() );
             analyze(confl, learnt_clause, selectors,backtrack_level,nblevels,szWoutSelectors);
+            if (pLearnFunc)
+                pLearnFunc(pLearnMan, (int *)&learnt_clause[0], learnt_clause.size(), nblevels);
 
             lbdQueue.push(nblevels);
             sumLBD += nblevels;
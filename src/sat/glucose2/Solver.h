@@ -62,6 +62,8 @@ public:
     int nCallConfl;                      // callback will be called every this number of conflicts
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
+    void * pLearnMan;                    // external learned clause consumer
+    void(*pLearnFunc)(void * p, int * pLits, int nLits, int nLbd); // called for each learned clause
     uint64_t nRuntimeLimit;              // runtime limit
     vec<int> user_vec;
     vec<Lit> user_lits;
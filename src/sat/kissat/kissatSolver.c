@@ -20,6 +20,7 @@
 
 #include "kissat.h"
 #include "kissatSolver.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -103,6 +104,7 @@ int kissat_solver_addclause(kissat_solver* s, int* begin, int* end) {
 
 ***********************************************************************/
 int kissat_solver_solve(kissat_solver* s, int* begin, int* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal) {
+  Abc_ProfSatCall();
   // assumptions are not supported
   assert(begin == end);
   // inspection limits are not supported
@@ -191,6 +193,21 @@ int kissat_solver_get_var_value(kissat_solver* s, int v) {
   return kissat_value((kissat*)s->p, v + 1) > 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [set termination callback]
+
+  Description [the solver stops as soon as the callback returns non-zero.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void kissat_solver_set_terminate(kissat_solver* s, void* pMan, int (*pFunc)(void*)) {
+  kissat_set_terminate((kissat*)s->p, pMan, pFunc);
+}
+
 
 /**Function*************************************************************
 
@@ -62,6 +62,7 @@ extern int             kissat_solver_nvars(kissat_solver* s);
 extern int             kissat_solver_addvar(kissat_solver* s);
 extern void            kissat_solver_setnvars(kissat_solver* s,int n);
 extern int             kissat_solver_get_var_value(kissat_solver* s, int v);
+extern void            kissat_solver_set_terminate(kissat_solver* s, void* pMan, int (*pFunc)(void*));
 extern Vec_Int_t *     kissat_solve_cnf( Cnf_Dat_t * pCnf, char * pArgs, int nConfs, int nTimeLimit, int fSat, int fUnsat, int fPrintCex, int fVerbose );
 
 ABC_NAMESPACE_HEADER_END
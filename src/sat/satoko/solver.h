@@ -106,6 +106,10 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callback receiving each learned clause */
+    void   *pLearnMan;
+    void  (*pLearnFunc)(void *, int *, int, int);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -16,6 +16,7 @@
 #include "utils/misc.h"
 
 #include "misc/util/abc_global.h"
+#include "misc/util/utilProf.h"
 ABC_NAMESPACE_IMPL_START
 
 //===------------------------------------------------------------------------===
@@ -313,6 +314,7 @@ void satoko_assump_pop(solver_t *s)
 
 int satoko_solve(solver_t *s)
 {
+    Abc_ProfSatCall();
     int status = SATOKO_UNDEC;
 
     assert(s);
@@ -652,6 +654,12 @@ void satoko_set_stop_func(satoko_t *s, int (*fnct)(int))
     s->pFuncStop = fnct;
 }
 
+void satoko_set_learn_callback(satoko_t *s, void * pman, void (*fnct)(void *, int *, int, int))
+{
+    s->pLearnMan = pman;
+    s->pLearnFunc = fnct;
+}
+
 void satoko_set_runid(satoko_t *s, int id)
 {
     s->RunId = id;
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "proof/cec/cec.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(CecTest, ParallelSatSweepingProvesMiter) {
+  Gia_Man_t* random = TestRandomAig(32, 2000, 5, 0, 10);
+  Gia_Man_t* aig_manager = Gia_ManRehash(random, 0);
+  int i, k;
+  Gia_ManStop(random);
+
+  // the miter of the AIG and its optimized version has constant-0 outputs
+  Gia_Man_t* optimized = Gia_ManAigSyn2(aig_manager, 0, 1, 0, 0, 0, 0, 0);
+  for (k = 0; k < 2; k++) {
+    Gia_Man_t* miter = Gia_ManMiter(aig_manager, optimized, 0, 0, 0, 0, 0);
+    Gia_Man_t* swept = Cec4_ManSimulateTest6(miter, 1000, k ? 4 : 0, 0);
+    Gia_Obj_t* pObj;
+    ASSERT_TRUE(swept != NULL);
+    Gia_ManForEachCo(swept, pObj, i)
+      EXPECT_EQ(Gia_ObjFaninLit0p(swept, pObj), 0);
+    Gia_ManStop(swept);
+    Gia_ManStop(miter);
+  }
+  Gia_ManStop(optimized);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(CecTest, SatPortfolioSolvesMiter) {
+  int fBug;
+  for (fBug = 0; fBug < 2; fBug++) {
+    Gia_Man_t* p0 = TestMultiplier(6, 0, 0);
+    Gia_Man_t* p1 = TestMultiplier(6, 1, fBug);
+    Gia_Man_t* miter = Gia_ManMiter(p0, p1, 0, 0, 0, 0, 0);
+    int RetValue = Cec_GiaProvePortfolio(miter, 4, 60, 0, 1);
+    if (fBug) {
+      EXPECT_EQ(RetValue, 0);
+      ASSERT_TRUE(miter->pCexComb != NULL);
+      EXPECT_GE(miter->pCexComb->iPo, 0);
+      EXPECT_EQ(Gia_ManFindFailedPoCex(miter, miter->pCexComb, 0), miter->pCexComb->iPo);
+    } else {
+      EXPECT_EQ(RetValue, 1);
+      EXPECT_TRUE(miter->pCexComb == NULL);
+    }
+    Gia_ManStop(miter);
+    Gia_ManStop(p1);
+    Gia_ManStop(p0);
+  }
+}
+
+static Gia_Man_t* ScorrTestTwinCounters(int nRegs) {
+  Gia_Man_t* p = Gia_ManStart(10000);
+  int i, c, pPis[8], pRegs[2][200], pNext[2][200];
+  Gia_ManHashAlloc(p);
+  for (i = 0; i < 8; i++)
+    pPis[i] = Gia_ManAppendCi(p);
+  for (c = 0; c < 2; c++)
+    for (i = 0; i < nRegs; i++)
+      pRegs[c][i] = Gia_ManAppendCi(p);
+  for (c = 0; c < 2; c++)
+    for (i = 0; i < nRegs; i++) {
+      int iPrev = i ? pRegs[c][i - 1] : pPis[0];
+      int iCond = Gia_ManHashAnd(p, pPis[i % 8], iPrev);
+      if (c == 0)
+        pNext[c][i] = Gia_ManHashXor(p, pRegs[c][i], iCond);
+      else
+        pNext[c][i] = Gia_ManHashAnd(p, Gia_ManHashOr(p, pRegs[c][i], iCond), Abc_LitNot(Gia_ManHashAnd(p, pRegs[c][i], iCond)));
+    }
+  Gia_ManAppendCo(p, Gia_ManHashXor(p, pRegs[0][nRegs - 1], pRegs[1][nRegs - 1]));
+  for (i = 0; i < nRegs; i++)
+    Gia_ManAppendCo(p, pRegs[1][i]);
+  for (c = 0; c < 2; c++)
+    for (i = 0; i < nRegs; i++)
+      Gia_ManAppendCo(p, pNext[c][i]);
+  Gia_ManHashStop(p);
+  Gia_ManSetRegNum(p, 2 * nRegs);
+  return p;
+}
+
+TEST(CecTest, ParallelScorrMatchesSerial) {
+  Gia_Man_t* p = ScorrTestTwinCounters(150);
+  Gia_Man_t* pRes[2];
+  Cec_ParCor_t Pars;
+  int k, fUseCSat;
+  for (fUseCSat = 0; fUseCSat < 2; fUseCSat++) {
+    for (k = 0; k < 2; k++) {
+      Cec_ManCorSetDefaultParams(&Pars);
+      Pars.fUseCSat = fUseCSat;
+      Pars.nProcs = 1 + 3 * k;
+      pRes[k] = Cec_ManLSCorrespondence(p, &Pars);
+    }
+    EXPECT_EQ(Gia_ManRegNum(pRes[0]), 150);
+    EXPECT_EQ(Gia_ManRegNum(pRes[0]), Gia_ManRegNum(pRes[1]));
+    EXPECT_EQ(Gia_ManAndNum(pRes[0]), Gia_ManAndNum(pRes[1]));
+    EXPECT_TRUE(Gia_ObjIsConst0(Gia_ObjFanin0(Gia_ManPo(pRes[1], 0))));
+    for (k = 0; k < 2; k++)
+      Gia_ManStop(pRes[k]);
+  }
+  Gia_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
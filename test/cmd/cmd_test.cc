@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "misc/extra/extra.h"
+#include "sat/bsat/satSolver.h"
+#include "misc/util/utilProf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(CmdTest, ProfilerWritesChromeTrace) {
+  const char* pFileName = "cmd_test_trace.json";
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* pGia = Gia_ManStart(10);
+  int iLit0 = Gia_ManAppendCi(pGia), iLit1 = Gia_ManAppendCi(pGia);
+  Gia_ManAppendCo(pGia, Gia_ManAppendAnd(pGia, iLit0, iLit1));
+  Abc_FrameUpdateGia(pAbc, pGia);
+  Abc_FrameSetBatchMode(1);
+  EXPECT_EQ(Cmd_CommandExecute(pAbc, "profile cmd_test_trace.json; &st"), 0);
+  ASSERT_TRUE(Abc_ProfEnabled);
+  // a phase with one SAT call
+  Abc_ProfPhaseBegin("test \"phase\"");
+  sat_solver* pSat = sat_solver_new();
+  sat_solver_setnvars(pSat, 1);
+  EXPECT_EQ(sat_solver_solve(pSat, NULL, NULL, 0, 0, 0, 0), l_True);
+  sat_solver_delete(pSat);
+  Abc_ProfPhaseEnd();
+  EXPECT_EQ(Abc_ProfEventNum(), 2);
+  EXPECT_EQ(Cmd_CommandExecute(pAbc, "profile -s"), 0);
+  Abc_FrameSetBatchMode(0);
+  EXPECT_FALSE(Abc_ProfEnabled);
+  char* pContents = Extra_FileReadContents((char*)pFileName);
+  ASSERT_TRUE(pContents != NULL);
+  EXPECT_TRUE(strstr(pContents, "{\"traceEvents\":[") == pContents);
+  EXPECT_TRUE(strstr(pContents, "\"name\":\"&st\",\"cat\":\"command\"") != NULL);
+  EXPECT_TRUE(strstr(pContents, "\"gia_ands_before\":1,\"gia_ands_after\":1") != NULL);
+  EXPECT_TRUE(strstr(pContents, "\"name\":\"test \\\"phase\\\"\",\"cat\":\"phase\"") != NULL);
+  EXPECT_TRUE(strstr(pContents, "\"sat_calls\":1}") != NULL);
+  ABC_FREE(pContents);
+  remove(pFileName);
+}
+
+ABC_NAMESPACE_IMPL_END
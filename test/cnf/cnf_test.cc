@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(CnfTest, ParallelFastCnfMatchesSerial) {
+  int fBug;
+  for (fBug = 0; fBug < 2; fBug++) {
+    Gia_Man_t* p0 = TestMultiplier(6, 0, 0);
+    Gia_Man_t* p1 = TestMultiplier(6, 1, fBug);
+    Gia_Man_t* miter = Gia_ManMiter(p0, p1, 0, 0, 0, 0, 0);
+    Aig_Man_t* pAig = Gia_ManToAigSimple(miter);
+    Cnf_Dat_t* pCnf1 = Cnf_DeriveFastPar(pAig, Aig_ManCoNum(pAig), 1);
+    Cnf_Dat_t* pCnf3 = Cnf_DeriveFastPar(pAig, Aig_ManCoNum(pAig), 3);
+    ASSERT_EQ(pCnf1->nVars, pCnf3->nVars);
+    ASSERT_EQ(pCnf1->nClauses, pCnf3->nClauses);
+    ASSERT_EQ(pCnf1->nLiterals, pCnf3->nLiterals);
+    EXPECT_EQ(memcmp(pCnf1->pClauses[0], pCnf3->pClauses[0], sizeof(int) * pCnf1->nLiterals), 0);
+    EXPECT_EQ(memcmp(pCnf1->pVarNums, pCnf3->pVarNums, sizeof(int) * Aig_ManObjNumMax(pAig)), 0);
+    int* pVarNums = NULL;
+    sat_solver* pSat = (sat_solver*)Cnf_DeriveFastIntoSolver(pAig, Aig_ManCoNum(pAig), 3, &pVarNums);
+    ASSERT_TRUE(pSat != NULL);
+    Vec_Int_t* vLits = Vec_IntAlloc(Aig_ManCoNum(pAig));
+    Aig_Obj_t* pObj;
+    int i;
+    Aig_ManForEachCo(pAig, pObj, i)
+      Vec_IntPush(vLits, Abc_Var2Lit(pVarNums[Aig_ObjId(pObj)], 0));
+    sat_solver_addclause(pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits));
+    EXPECT_EQ(sat_solver_solve(pSat, NULL, NULL, 0, 0, 0, 0), fBug ? l_True : l_False);
+    Vec_IntFree(vLits);
+    sat_solver_delete(pSat);
+    ABC_FREE(pVarNums);
+    Cnf_DataFree(pCnf1);
+    Cnf_DataFree(pCnf3);
+    Aig_ManStop(pAig);
+    Gia_ManStop(miter);
+    Gia_ManStop(p1);
+    Gia_ManStop(p0);
+  }
+}
+
+ABC_NAMESPACE_IMPL_END
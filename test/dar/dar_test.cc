@@ -0,0 +1,21 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(DarTest, ParallelDc2IsEquivalent) {
+  Gia_Man_t* p = TestMultiplier(6, 0, 0);
+  Gia_Man_t* p2 = Gia_ManCompress2Par(p, 1, 50, 2, 0);
+  Gia_Man_t* p4 = Gia_ManCompress2Par(p, 1, 50, 4, 0);
+  EXPECT_LE(Gia_ManAndNum(p2), Gia_ManAndNum(p));
+  EXPECT_EQ(Gia_ManAndNum(p2), Gia_ManAndNum(p4));
+  EXPECT_TRUE(TestGiaEquivalent(p, p4));
+  Gia_ManStop(p4);
+  Gia_ManStop(p2);
+  Gia_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
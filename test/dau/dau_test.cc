@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+
+#include "opt/dau/dau.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(DauTest, BatchCanonicizationMatchesSerial) {
+  const int nVars = 8, nWords = 4, nFuncs = 3000;
+  word* pTruths = ABC_ALLOC(word, nFuncs * nWords);
+  word* pSerial = ABC_ALLOC(word, nFuncs * nWords);
+  word* pOrig = ABC_ALLOC(word, nFuncs * nWords);
+  unsigned* pPhases = ABC_ALLOC(unsigned, nFuncs);
+  char* pPerms = ABC_ALLOC(char, nFuncs * nVars);
+  char pPerm[16];
+  Abc_TtNpnCache_t* pCache = Abc_TtNpnCacheStart(nVars);
+  int i, w;
+  Abc_RandomW(1);
+  for (i = 0; i < nFuncs; i++)
+    for (w = 0; w < nWords; w++)
+      pTruths[i * nWords + w] = (i % 3 == 2) ? pTruths[(i - 1) * nWords + w] : Abc_RandomW(0);
+  memcpy(pSerial, pTruths, sizeof(word) * nFuncs * nWords);
+  memcpy(pOrig, pTruths, sizeof(word) * nFuncs * nWords);
+  Abc_TtCanonicizeBatch(pCache, pTruths, nFuncs, nVars, pPhases, pPerms, 4);
+  EXPECT_EQ(Abc_TtNpnCacheSize(pCache), 2000);
+  for (i = 0; i < nFuncs; i++) {
+    unsigned uPhase = Abc_TtCanonicize(pSerial + i * nWords, nVars, pPerm);
+    EXPECT_EQ(uPhase, pPhases[i]);
+    EXPECT_EQ(memcmp(pPerm, pPerms + i * nVars, nVars), 0);
+    EXPECT_TRUE(Abc_TtEqual(pSerial + i * nWords, pTruths + i * nWords, nWords));
+  }
+  // the second batch is answered by the memo
+  memcpy(pTruths, pOrig, sizeof(word) * nFuncs * nWords);
+  Abc_TtCanonicizeBatch(pCache, pTruths, nFuncs, nVars, NULL, NULL, 4);
+  EXPECT_EQ(Abc_TtNpnCacheSize(pCache), 2000);
+  for (i = 0; i < nFuncs; i++)
+    EXPECT_TRUE(Abc_TtEqual(pSerial + i * nWords, pTruths + i * nWords, nWords));
+  Abc_TtNpnCacheStop(pCache);
+  ABC_FREE(pTruths);
+  ABC_FREE(pSerial);
+  ABC_FREE(pOrig);
+  ABC_FREE(pPhases);
+  ABC_FREE(pPerms);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "proof/dch/dch.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(DchTest, ParallelChoicesAreDeterministic) {
+  Gia_Man_t* p = TestMultiplier(6, 0, 0);
+  Gia_Man_t* pRes[3];
+  Dch_Pars_t Pars;
+  int i, k;
+  // the choices computed with 1, 2 and 4 threads
+  for (k = 0; k < 3; k++) {
+    Dch_ManSetDefaultParams(&Pars);
+    Pars.nProcs = k ? 2 * k : 1;
+    pRes[k] = Gia_ManPerformDch(p, &Pars);
+  }
+  EXPECT_TRUE(Gia_ManHasChoices(pRes[0]));
+  for (k = 1; k < 3; k++) {
+    ASSERT_EQ(Gia_ManObjNum(pRes[0]), Gia_ManObjNum(pRes[k]));
+    for (i = 0; i < Gia_ManObjNum(pRes[0]); i++) {
+      EXPECT_EQ(Gia_ObjIsAnd(Gia_ManObj(pRes[0], i)), Gia_ObjIsAnd(Gia_ManObj(pRes[k], i)));
+      EXPECT_EQ(Gia_ObjSibl(pRes[0], i), Gia_ObjSibl(pRes[k], i));
+      if (!Gia_ObjIsAnd(Gia_ManObj(pRes[0], i)))
+        continue;
+      EXPECT_EQ(Gia_ObjFaninLit0p(pRes[0], Gia_ManObj(pRes[0], i)), Gia_ObjFaninLit0p(pRes[k], Gia_ManObj(pRes[k], i)));
+      EXPECT_EQ(Gia_ObjFaninLit1p(pRes[0], Gia_ManObj(pRes[0], i)), Gia_ObjFaninLit1p(pRes[k], Gia_ManObj(pRes[k], i)));
+    }
+  }
+  // the outputs of the choice AIG are equivalent to those of the input
+  for (k = 0; k < 3; k++) {
+    EXPECT_TRUE(TestGiaEquivalent(p, pRes[k]));
+    Gia_ManStop(pRes[k]);
+  }
+  Gia_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
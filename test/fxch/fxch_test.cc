@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "opt/fxch/Fxch.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(FxchTest, ParallelExtractionMatchesSerial) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Vec_Ptr_t* vSops[2];
+  const char* pCommands[2] = {"fxch", "fxch -P 3"};
+  Abc_Obj_t* pObj;
+  int i, k;
+  for (k = 0; k < 2; k++) {
+    Abc_FrameUpdateGia(pAbc, TestMultiplier(8, 0, 0));
+    EXPECT_EQ(TestCommandExecute(pAbc, "&put; strash; if -K 8; sop"), 0);
+    EXPECT_EQ(TestCommandExecute(pAbc, pCommands[k]), 0);
+    vSops[k] = Vec_PtrAlloc(1000);
+    Abc_NtkForEachNode(Abc_FrameReadNtk(pAbc), pObj, i)
+      Vec_PtrPush(vSops[k], Abc_UtilStrsav((char*)pObj->pData));
+  }
+  EXPECT_EQ(TestCommandExecute(pAbc, "strash; &get"), 0);
+  // the divisors found by several threads are extracted in the same order
+  ASSERT_EQ(Vec_PtrSize(vSops[0]), Vec_PtrSize(vSops[1]));
+  for (i = 0; i < Vec_PtrSize(vSops[0]); i++)
+    EXPECT_STREQ((char*)Vec_PtrEntry(vSops[0], i), (char*)Vec_PtrEntry(vSops[1], i));
+  Gia_Man_t* p = TestMultiplier(8, 0, 0);
+  EXPECT_TRUE(TestGiaEquivalent(p, Abc_FrameReadGia(pAbc)));
+  Gia_ManStop(p);
+  for (k = 0; k < 2; k++)
+    Vec_PtrFreeFree(vSops[k]);
+}
+
+TEST(FxchTest, LargeCoverUsesThreadedBatches) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_Ntk_t* pNtk;
+  Fxch_Man_t* pFxchMan;
+  Vec_Wec_t* vCubes;
+  Abc_FrameUpdateGia(pAbc, TestMultiplier(8, 0, 0));
+  EXPECT_EQ(TestCommandExecute(pAbc, "&put; strash; if -K 8; sop"), 0);
+  pNtk = Abc_FrameReadNtk(pAbc);
+  vCubes = Abc_NtkFxRetrieve(pNtk);
+  // the same steps as in Fxch_FastExtract() before the extraction
+  pFxchMan = Fxch_ManAlloc(vCubes);
+  pFxchMan->nProcs = 3;
+  Fxch_CubesGruping(pFxchMan);
+  Fxch_ManMapLiteralsIntoCubes(pFxchMan, Abc_NtkObjNumMax(pNtk));
+  Fxch_ManGenerateLitHashKeys(pFxchMan);
+  Fxch_ManComputeLevel(pFxchMan);
+  Fxch_ManSCHashTablesInit(pFxchMan);
+  Fxch_ManDivCreate(pFxchMan);
+  // some batches have at least FXCH_BATCH_MIN sub-cube operations
+  EXPECT_GT(pFxchMan->nBatchesPar, 0);
+  Fxch_CubesUnGruping(pFxchMan);
+  Fxch_ManSCHashTablesFree(pFxchMan);
+  Fxch_ManFree(pFxchMan);
+  Vec_WecFree(vCubes);
+}
+
+ABC_NAMESPACE_IMPL_END
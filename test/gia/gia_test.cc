@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "misc/util/utilSimd.h"
+#include "../test_util.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +53,117 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, ParallelAigerReadMatchesSerial) {
+  Gia_Man_t* aig_manager = TestRandomAig(64, 100000, 1, 0, 0);
+  char file_name[] = "gia_test_par.aig";
+  int fSkipStrash, nProcs;
+
+  Gia_AigerWrite(aig_manager, file_name, 0, 0, 0);
+
+  for (fSkipStrash = 0; fSkipStrash < 2; fSkipStrash++)
+  for (nProcs = 2; nProcs <= 4; nProcs += 2) {
+    Gia_Man_t* serial = Gia_AigerReadPar(file_name, 0, fSkipStrash, 0, 1);
+    Gia_Man_t* parallel = Gia_AigerReadPar(file_name, 0, fSkipStrash, 0, nProcs);
+    ASSERT_TRUE(serial != nullptr);
+    ASSERT_TRUE(parallel != nullptr);
+    EXPECT_EQ(Gia_ManObjNum(serial), Gia_ManObjNum(parallel));
+    EXPECT_EQ(Gia_ManBufNum(serial), Gia_ManBufNum(parallel));
+    EXPECT_EQ(memcmp(serial->pObjs, parallel->pObjs, sizeof(Gia_Obj_t) * Gia_ManObjNum(serial)), 0);
+    Gia_ManStop(serial);
+    Gia_ManStop(parallel);
+  }
+  remove(file_name);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SimulationIsIndependentOfSimdLevel) {
+  Gia_Man_t* aig_manager = TestRandomAig(16, 1000, 1, 5, 0);
+  int level, level_old = Abc_SimdLevel();
+  int nWords = 13;
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  Abc_SimdSetLevel(ABC_SIMD_NONE);
+  Vec_Wrd_t* reference = Gia_ManSimPatSimOut(aig_manager, stimulus, 0);
+  for (level = ABC_SIMD_SSE2; level <= Abc_SimdLevelMax(); level++) {
+    Abc_SimdSetLevel(level);
+    Vec_Wrd_t* output = Gia_ManSimPatSimOut(aig_manager, stimulus, 0);
+    EXPECT_TRUE(Vec_WrdEqual(output, reference)) << Abc_SimdLevelName(level);
+    Vec_WrdFree(output);
+  }
+  Abc_SimdSetLevel(level_old);
+  Vec_WrdFree(reference);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelSimulationMatchesSerial) {
+  Gia_Man_t* aig_manager = TestRandomAig(32, 4000, 7, 0, 100);
+  int nWords = 100;
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  Vec_Wrd_t* serial = Gia_ManSimPatSimOut(aig_manager, stimulus, 1);
+  Vec_Wrd_t* parallel = Gia_ManSimPatSimOutPar(aig_manager, stimulus, 1, 4);
+  EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+  Vec_WrdFree(parallel);
+  Vec_WrdFree(serial);
+  serial = Gia_ManSimPatSimOut(aig_manager, stimulus, 0);
+  parallel = Gia_ManSimPatSimOutPar(aig_manager, stimulus, 0, 4);
+  EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+  Vec_WrdFree(parallel);
+  Vec_WrdFree(serial);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ConcurrentRehashMatchesSerial) {
+  Gia_Man_t* aig_manager = TestRandomAig(64, 40000, 11, 0, 50);
+  int nWords = 4;
+
+  Gia_Man_t* serial = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* parallel = Gia_ManRehashPar(aig_manager, 5);
+  EXPECT_EQ(Gia_ManAndNum(serial), Gia_ManAndNum(parallel));
+  EXPECT_EQ(Gia_ManCoNum(serial), Gia_ManCoNum(parallel));
+  EXPECT_TRUE(Gia_ManIsNormalized(parallel));
+
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  Vec_Wrd_t* outputs_serial = Gia_ManSimPatSimOut(serial, stimulus, 1);
+  Vec_Wrd_t* outputs_parallel = Gia_ManSimPatSimOut(parallel, stimulus, 1);
+  EXPECT_TRUE(Vec_WrdEqual(outputs_serial, outputs_parallel));
+  Vec_WrdFree(outputs_parallel);
+  Vec_WrdFree(outputs_serial);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(parallel);
+  Gia_ManStop(serial);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelLutMappingMatchesSerial) {
+  Gia_Man_t* aig_manager = TestRandomAig(256, 12000, 3, 0, 20);
+  int k;
+
+  for (k = 0; k < 2; k++) {
+    Jf_Par_t Pars, *pPars = &Pars;
+    Gia_Man_t *copy0 = Gia_ManDup(aig_manager), *copy1 = Gia_ManDup(aig_manager);
+    Gia_Man_t *serial, *parallel;
+    if (k == 0)
+      Mf_ManSetDefaultPars(pPars);
+    else
+      Lf_ManSetDefaultPars(pPars);
+    pPars->fCoarsen = 0;
+    serial = k == 0 ? Mf_ManPerformMapping(copy0, pPars) : Lf_ManPerformMapping(copy0, pPars);
+    pPars->nProcNum = 4;
+    parallel = k == 0 ? Mf_ManPerformMapping(copy1, pPars) : Lf_ManPerformMapping(copy1, pPars);
+    ASSERT_TRUE(serial->vMapping != NULL && parallel->vMapping != NULL);
+    EXPECT_EQ(Gia_ManLutNum(serial), Gia_ManLutNum(parallel));
+    EXPECT_TRUE(Vec_IntEqual(serial->vMapping, parallel->vMapping));
+    if (serial != copy0)
+      Gia_ManStop(serial);
+    if (parallel != copy1)
+      Gia_ManStop(parallel);
+    Gia_ManStop(copy0);
+    Gia_ManStop(copy1);
+  }
+  Gia_ManStop(aig_manager);
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "map/if/if.h"
+#include "opt/dau/dau.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(IfTest, ParallelMappingMatchesSerial) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* pRandom = TestRandomAig(256, 20000, 3, 0, 20);
+  Gia_Man_t* p = Gia_ManRehash(pRandom, 0);
+  Gia_Man_t* pRes[3];
+  const char* pCommands[3] = {"&if -K 6", "&if -K 6 -P 2", "&if -K 6 -P 4"};
+  Vec_Int_t* vCounts;
+  int i, k;
+  Gia_ManStop(pRandom);
+  // some levels are wide enough to be mapped by four threads
+  vCounts = Vec_IntStart(Gia_ManLevelNum(p) + 1);
+  Gia_ManForEachAndId(p, i)
+    Vec_IntAddToEntry(vCounts, Gia_ObjLevelId(p, i), 1);
+  EXPECT_GE(Vec_IntFindMax(vCounts), 64 * 4);
+  Vec_IntFree(vCounts);
+  for (k = 0; k < 3; k++) {
+    Abc_FrameUpdateGia(pAbc, Gia_ManDup(p));
+    EXPECT_EQ(TestCommandExecute(pAbc, pCommands[k]), 0);
+    pRes[k] = Gia_ManDup(Abc_FrameReadGia(pAbc));
+    Gia_ManTransferMapping(pRes[k], Abc_FrameReadGia(pAbc));
+    ASSERT_TRUE(pRes[k]->vMapping != NULL);
+  }
+  for (k = 1; k < 3; k++) {
+    EXPECT_EQ(Gia_ManLutNum(pRes[0]), Gia_ManLutNum(pRes[k])) << pCommands[k];
+    EXPECT_TRUE(Vec_IntEqual(pRes[0]->vMapping, pRes[k]->vMapping)) << pCommands[k];
+  }
+  for (k = 0; k < 3; k++)
+    Gia_ManStop(pRes[k]);
+  Gia_ManStop(p);
+}
+
+TEST(IfTest, DsdManagerSurvivesSaveAndLoad) {
+  If_DsdMan_t* dsd_manager = If_DsdManAlloc(6, 4);
+  const char* file_name = "if_test_dsd_cache.dsd";
+  unsigned char perm[DAU_MAX_VAR];
+  word truths[200];
+  int ids[200];
+  unsigned seed = 5;
+  int i, k;
+
+  for (i = 0; i < 200; i++) {
+    // half of the functions are decomposable (a random function ANDed with a variable)
+    for (k = 0, truths[i] = 0; k < 4; k++) {
+      seed = 1664525 * seed + 1013904223;
+      truths[i] = (truths[i] << 16) ^ (seed >> 16);
+    }
+    if (i & 1)
+      truths[i] &= s_Truths6[i % 6];
+    if (Abc_TtSupportSize(&truths[i], 6) < 6)
+      truths[i] = s_Truths6[0] ^ s_Truths6[1] ^ s_Truths6[2] ^ s_Truths6[3] ^ s_Truths6[4] ^ s_Truths6[5];
+    ids[i] = If_DsdManCompute(dsd_manager, &truths[i], 6, perm, NULL);
+  }
+  If_DsdManSave(dsd_manager, (char*)file_name);
+
+  If_DsdMan_t* loaded = If_DsdManLoad((char*)file_name);
+  ASSERT_TRUE(loaded != nullptr);
+  EXPECT_EQ(If_DsdManObjNum(loaded), If_DsdManObjNum(dsd_manager));
+  EXPECT_EQ(If_DsdManLutSize(loaded), 4);
+  for (i = 0; i < 200; i++)
+    EXPECT_EQ(If_DsdManCompute(loaded, &truths[i], 6, perm, NULL), ids[i]);
+  EXPECT_EQ(If_DsdManObjNum(loaded), If_DsdManObjNum(dsd_manager));
+
+  If_DsdManFree(loaded, 0);
+  If_DsdManFree(dsd_manager, 0);
+  remove(file_name);
+}
+
+ABC_NAMESPACE_IMPL_END
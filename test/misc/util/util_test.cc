@@ -0,0 +1,178 @@
+#include "gtest/gtest.h"
+
+#include "misc/util/abc_global.h"
+#include "misc/vec/vec.h"
+#include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static int PoolTestLeaf(void* pArg) {
+  int* pValue = (int*)pArg;
+  *pValue = *pValue * 2 + 1;
+  return *pValue;
+}
+
+static int PoolTestNode(void* pArg) {
+  // each node runs its leaves as nested tasks and waits for them
+  int* pValues = (int*)pArg;
+  Util_Task_t* pTasks[8];
+  int i, Sum = 0;
+  for (i = 0; i < 8; i++)
+    pTasks[i] = Util_PoolSubmit(PoolTestLeaf, pValues + i);
+  for (i = 0; i < 8; i++) {
+    Util_TaskWait(pTasks[i], 0);
+    Sum += Util_TaskResult(pTasks[i]);
+    Util_TaskFree(pTasks[i]);
+  }
+  return Sum;
+}
+
+TEST(UtilTest, ThreadPoolRunsNestedTasks) {
+  int Values[64 * 8], i, k, Sum = 0;
+  Util_Task_t* pTasks[64];
+  Vec_Ptr_t* vData = Vec_PtrAlloc(64);
+  for (i = 0; i < 64 * 8; i++)
+    Values[i] = i;
+  Util_PoolStart(3);
+  for (k = 0; k < 64; k++)
+    pTasks[k] = Util_PoolSubmit(PoolTestNode, Values + 8 * k);
+  for (k = 0; k < 64; k++) {
+    int iTask = Util_TaskWaitAny(pTasks, 64, 0);
+    ASSERT_GE(iTask, 0);
+    Sum += Util_TaskResult(pTasks[iTask]);
+    Util_TaskFree(pTasks[iTask]);
+    pTasks[iTask] = NULL;
+  }
+  EXPECT_EQ(Util_TaskWaitAny(pTasks, 64, 0), -1);
+  EXPECT_EQ(Sum, 64 * 8 * (64 * 8 - 1) + 64 * 8);
+  // the same leaves are processed again by Util_ProcessThreads()
+  for (i = 0; i < 64 * 8; i++)
+    Vec_PtrPush(vData, Values + i);
+  Util_ProcessThreads(PoolTestLeaf, vData, 4, 0, 0);
+  for (i = 0; i < 64 * 8; i++)
+    EXPECT_EQ(Values[i], 4 * i + 3);
+  Vec_PtrFree(vData);
+}
+
+// the scalar word loops of Abc_TtFlip() and others before the vector kernels
+static void TtRefFlip(word* pTruth, int nWords, int iVar) {
+  int w, i, iStep = Abc_TtWordNum(iVar);
+  if (iVar <= 5) {
+    for (w = 0; w < nWords; w++)
+      pTruth[w] = ((pTruth[w] << (1 << iVar)) & s_Truths6[iVar]) | ((pTruth[w] & s_Truths6[iVar]) >> (1 << iVar));
+    return;
+  }
+  for (w = 0; w < nWords; w += 2 * iStep)
+    for (i = 0; i < iStep; i++)
+      ABC_SWAP(word, pTruth[w + i], pTruth[w + i + iStep]);
+}
+
+static void TtRefSwapAdjacent(word* pTruth, int nWords, int iVar) {
+  int w, i, iStep = Abc_TtWordNum(iVar);
+  if (iVar < 5) {
+    for (w = 0; w < nWords; w++)
+      pTruth[w] = (pTruth[w] & s_PMasks[iVar][0]) | ((pTruth[w] & s_PMasks[iVar][1]) << (1 << iVar)) | ((pTruth[w] & s_PMasks[iVar][2]) >> (1 << iVar));
+    return;
+  }
+  if (iVar == 5) {
+    unsigned* pTruthU = (unsigned*)pTruth;
+    for (w = 0; w < 2 * nWords; w += 4)
+      ABC_SWAP(unsigned, pTruthU[w + 1], pTruthU[w + 2]);
+    return;
+  }
+  for (w = 0; w < nWords; w += 4 * iStep)
+    for (i = 0; i < iStep; i++)
+      ABC_SWAP(word, pTruth[w + i + iStep], pTruth[w + i + 2 * iStep]);
+}
+
+static void TtRefSwapVars(word* pTruth, int nWords, int iVar, int jVar) {
+  int w, i, j, iStep = Abc_TtWordNum(iVar), jStep = Abc_TtWordNum(jVar);
+  if (jVar <= 5) {
+    word* pMasks = s_PPMasks[iVar][jVar];
+    int shift = (1 << jVar) - (1 << iVar);
+    for (w = 0; w < nWords; w++)
+      pTruth[w] = (pTruth[w] & pMasks[0]) | ((pTruth[w] & pMasks[1]) << shift) | ((pTruth[w] & pMasks[2]) >> shift);
+    return;
+  }
+  if (iVar <= 5) {
+    for (w = 0; w < nWords; w += 2 * jStep)
+      for (j = 0; j < jStep; j++) {
+        word low2High = (pTruth[w + j] & s_Truths6[iVar]) >> (1 << iVar);
+        word high2Low = (pTruth[w + j + jStep] << (1 << iVar)) & s_Truths6[iVar];
+        pTruth[w + j] = (pTruth[w + j] & ~s_Truths6[iVar]) | high2Low;
+        pTruth[w + j + jStep] = (pTruth[w + j + jStep] & s_Truths6[iVar]) | low2High;
+      }
+    return;
+  }
+  for (w = 0; w < nWords; w += 2 * jStep)
+    for (i = 0; i < jStep; i += 2 * iStep)
+      for (j = 0; j < iStep; j++)
+        ABC_SWAP(word, pTruth[w + iStep + i + j], pTruth[w + jStep + i + j]);
+}
+
+static void TtRefCofactor(word* pTruth, int nWords, int iVar, int fCof1) {
+  int w, i, iStep = Abc_TtWordNum(iVar);
+  if (iVar <= 5) {
+    for (w = 0; w < nWords; w++)
+      if (fCof1)
+        pTruth[w] = (pTruth[w] & s_Truths6[iVar]) | ((pTruth[w] & s_Truths6[iVar]) >> (1 << iVar));
+      else
+        pTruth[w] = ((pTruth[w] & s_Truths6Neg[iVar]) << (1 << iVar)) | (pTruth[w] & s_Truths6Neg[iVar]);
+    return;
+  }
+  for (w = 0; w < nWords; w += 2 * iStep)
+    for (i = 0; i < iStep; i++)
+      if (fCof1)
+        pTruth[w + i] = pTruth[w + i + iStep];
+      else
+        pTruth[w + i + iStep] = pTruth[w + i];
+}
+
+TEST(UtilTest, TruthTableKernelsAreIndependentOfSimdLevel) {
+  int level, level_old = Abc_SimdLevel();
+  int nVars, i, j, w;
+  for (nVars = 7; nVars <= 11; nVars++) {
+    int nWords = Abc_TtWordNum(nVars);
+    word pRef[32], pRes[32], pIn[32];
+    for (w = 0; w < nWords; w++)
+      pIn[w] = Abc_RandomW(0);
+    for (i = 0; i < nVars; i++)
+      for (j = i; j < nVars; j++) {
+        // flip i, swap (i,j) or adjacent, then cofactor j
+        Abc_TtCopy(pRef, pIn, nWords, 0);
+        TtRefFlip(pRef, nWords, i);
+        if (j > i)
+          TtRefSwapVars(pRef, nWords, i, j);
+        else if (i < nVars - 1)
+          TtRefSwapAdjacent(pRef, nWords, i);
+        TtRefCofactor(pRef, nWords, j, (i + j) & 1);
+        for (level = ABC_SIMD_NONE; level <= Abc_SimdLevelMax(); level++) {
+          Abc_SimdSetLevel(level);
+          Abc_TtCopy(pRes, pIn, nWords, 0);
+          Abc_SimdTtFlip(pRes, nWords, i);
+          if (j > i)
+            Abc_SimdTtSwapVars(pRes, nWords, i, j);
+          else if (i < nVars - 1)
+            Abc_SimdTtSwapAdjacent(pRes, nWords, i);
+          Abc_SimdTtCofactor(pRes, pRes, nWords, j, (i + j) & 1);
+          EXPECT_TRUE(Abc_TtEqual(pRes, pRef, nWords)) << Abc_SimdLevelName(level) << " " << nVars << " " << i << " " << j;
+          // the same through the inline functions in utilTruth.h
+          Abc_TtCopy(pRes, pIn, nWords, 0);
+          Abc_TtFlip(pRes, nWords, i);
+          if (j > i)
+            Abc_TtSwapVars(pRes, nVars, i, j);
+          else if (i < nVars - 1)
+            Abc_TtSwapAdjacent(pRes, nWords, i);
+          if ((i + j) & 1)
+            Abc_TtCofactor1(pRes, nWords, j);
+          else
+            Abc_TtCofactor0(pRes, nWords, j);
+          EXPECT_TRUE(Abc_TtEqual(pRes, pRef, nWords)) << Abc_SimdLevelName(level) << " " << nVars << " " << i << " " << j;
+        }
+      }
+  }
+  Abc_SimdSetLevel(level_old);
+}
+
+ABC_NAMESPACE_IMPL_END
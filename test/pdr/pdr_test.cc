@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "aig/saig/saig.h"
+#include "proof/pdr/pdr.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// counter incremented by the input, reset after reaching Limit, and
+// the output equal to 1 when the counter is equal to Target
+static Gia_Man_t* PdrTestCounter(int nBits, int Limit, int Target) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  int i, iEn, iCarry, iLimit = 1, iTarget = 1, pRo[16], pRi[16];
+  Gia_ManHashAlloc(p);
+  iEn = Gia_ManAppendCi(p);
+  for (i = 0; i < nBits; i++)
+    pRo[i] = Gia_ManAppendCi(p);
+  for (i = 0, iCarry = iEn; i < nBits; i++) {
+    pRi[i] = Gia_ManHashXor(p, pRo[i], iCarry);
+    iCarry = Gia_ManHashAnd(p, pRo[i], iCarry);
+    iLimit = Gia_ManHashAnd(p, iLimit, Abc_LitNotCond(pRo[i], !((Limit >> i) & 1)));
+    iTarget = Gia_ManHashAnd(p, iTarget, Abc_LitNotCond(pRo[i], !((Target >> i) & 1)));
+  }
+  Gia_ManAppendCo(p, iTarget);
+  for (i = 0; i < nBits; i++)
+    Gia_ManAppendCo(p, Gia_ManHashAnd(p, pRi[i], Abc_LitNot(iLimit)));
+  Gia_ManSetRegNum(p, nBits);
+  Gia_ManHashStop(p);
+  return p;
+}
+
+TEST(PdrTest, ParallelPdrMatchesSerial) {
+  int Target, nProcs;
+  Abc_FrameGetGlobalFrame();
+  for (Target = 20; Target <= 25; Target += 5) {
+    for (nProcs = 1; nProcs <= 3; nProcs += 2) {
+      Gia_Man_t* pGia = PdrTestCounter(5, 20, Target);
+      Aig_Man_t* pAig = Gia_ManToAigSimple(pGia);
+      Pdr_Par_t Pars;
+      Pdr_ManSetDefaultParams(&Pars);
+      Pars.nProcs = nProcs;
+      Pars.fSilent = 1;
+      int RetValue = Pdr_ManSolve(pAig, &Pars);
+      if (Target == 20) {
+        // the target is reached after 20 increments
+        EXPECT_EQ(RetValue, 0);
+        ASSERT_TRUE(pAig->pSeqModel != NULL);
+        EXPECT_EQ(pAig->pSeqModel->iFrame, 20);
+        EXPECT_TRUE(Saig_ManVerifyCex(pAig, pAig->pSeqModel));
+      } else {
+        EXPECT_EQ(RetValue, 1);
+        EXPECT_TRUE(pAig->pSeqModel == NULL);
+      }
+      Aig_ManStop(pAig);
+      Gia_ManStop(pGia);
+    }
+  }
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+
+#include "map/scl/sclSize.h"
+#include "base/main/main.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static void SclTestWriteLibrary(const char* pFileName, int nSizes) {
+  const char* pCells[3][3] = {{"BUF", "A", "positive_unate"}, {"INV", "!A", "negative_unate"}, {"NAND2", "!(A&B)", "negative_unate"}};
+  const char* pTables[4] = {"cell_rise", "cell_fall", "rise_transition", "fall_transition"};
+  FILE* pFile = fopen(pFileName, "wb");
+  int c, x, i, t, s, l;
+  fprintf(pFile, "library(test) {\n time_unit : \"1ns\" ;\n capacitive_load_unit (1,pf) ;\n");
+  fprintf(pFile, " lu_table_template(t4) {\n  variable_1 : input_net_transition ;\n  variable_2 : total_output_net_capacitance ;\n");
+  fprintf(pFile, "  index_1 (\"0.01, 0.05, 0.2, 0.8\") ;\n  index_2 (\"0.001, 0.004, 0.016, 0.064\") ;\n }\n");
+  // the larger sizes have larger input capacitances and depend less on the load
+  for (c = 0; c < 3; c++)
+  for (x = 1; x < (1 << nSizes); x *= 2) {
+    int nIns = c < 2 ? 1 : 2;
+    if (nSizes == 1)
+      fprintf(pFile, " cell(%s) {\n  area : %d ;\n", pCells[c][0], 2 + c);
+    else
+      fprintf(pFile, " cell(%s_X%d) {\n  area : %d ;\n", pCells[c][0], x, (2 + c) * x);
+    for (i = 0; i < nIns; i++)
+      fprintf(pFile, "  pin(%c) {\n   direction : input ;\n   capacitance : %.4f ;\n  }\n", 'A' + i, 0.002 * x);
+    fprintf(pFile, "  pin(Y) {\n   direction : output ;\n   function : \"%s\" ;\n", pCells[c][1]);
+    for (i = 0; i < nIns; i++) {
+      fprintf(pFile, "   timing() {\n    related_pin : \"%c\" ;\n    timing_sense : %s ;\n", 'A' + i, pCells[c][2]);
+      for (t = 0; t < 4; t++) {
+        fprintf(pFile, "    %s(t4) {\n     index_1 (\"0.01, 0.05, 0.2, 0.8\") ;\n     index_2 (\"0.001, 0.004, 0.016, 0.064\") ;\n     values (", pTables[t]);
+        for (s = 0; s < 4; s++) {
+          fprintf(pFile, "%s\"", s ? ", " : " ");
+          for (l = 0; l < 4; l++)
+            fprintf(pFile, "%s%.4f", l ? ", " : "", 0.01 * (c + 1 + i + t) + 0.02 * s * s + 0.03 * (t + 1) * l * (1 + 0.1 * s) / x);
+          fprintf(pFile, "\"");
+        }
+        fprintf(pFile, " ) ;\n    }\n");
+      }
+      fprintf(pFile, "   }\n");
+    }
+    fprintf(pFile, "  }\n }\n");
+  }
+  fprintf(pFile, "}\n");
+  fclose(pFile);
+}
+
+TEST(SclTest, FastTimingMatchesSerial) {
+  const char* pFileName = "scl_test.lib";
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  SclTestWriteLibrary(pFileName, 1);
+  Abc_FrameUpdateGia(pAbc, TestMultiplier(6, 0, 0));
+  EXPECT_EQ(TestCommandExecute(pAbc, "read_lib -v scl_test.lib; &put; strash; amap; topo"), 0);
+  remove(pFileName);
+  SC_Lib* pLib = (SC_Lib*)Abc_FrameReadLibScl();
+  Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+  ASSERT_TRUE(pLib != NULL && pNtk != NULL && Abc_NtkHasMapping(pNtk));
+  // the flat tables give the same values as the original ones
+  SC_Cell* pCell;
+  SC_Pin* pPin;
+  SC_Timings* pTimings;
+  SC_Timing* pTiming;
+  int i, k, m, n, nPaired = 0;
+  Abc_SclLibPrepareLookup(pLib);
+  SC_LibForEachCell(pLib, pCell, i)
+  SC_CellForEachPinOut(pCell, pPin, k)
+  SC_PinForEachRTiming(pPin, pTimings, m)
+  Vec_PtrForEachEntry(SC_Timing*, &pTimings->vTimings, pTiming, n) {
+    SC_Pair ArrIn = {10, 20}, SlewIn = {0.03f, 0.5f}, Load = {0.003f, 0.1f};
+    SC_Pair ArrOut[2] = {{0, 0}, {0, 0}}, SlewOut[2] = {{0, 0}, {0, 0}};
+    SC_Surface* pSurfs[4] = {&pTiming->pCellRise, &pTiming->pCellFall, &pTiming->pRiseTrans, &pTiming->pFallTrans};
+    float* pFlats[4];
+    float Values[4][3];
+    int fPaired = pTiming->fPaired, s;
+    nPaired += fPaired;
+    Scl_LibPinArrival(pTiming, &ArrIn, &SlewIn, &Load, &ArrOut[0], &SlewOut[0]);
+    for (s = 0; s < 4; s++) {
+      ASSERT_TRUE(pSurfs[s]->pFlat != NULL);
+      for (k = 0; k < 3; k++)
+        Values[s][k] = Scl_LibLookup(pSurfs[s], 0.3f * k * k, 0.05f * k);
+      pFlats[s] = pSurfs[s]->pFlat;
+      pSurfs[s]->pFlat = NULL;
+    }
+    // compare with the original lookups
+    pTiming->fPaired = 0;
+    Scl_LibPinArrival(pTiming, &ArrIn, &SlewIn, &Load, &ArrOut[1], &SlewOut[1]);
+    EXPECT_TRUE(SC_PairEqual(&ArrOut[0], &ArrOut[1]));
+    EXPECT_TRUE(SC_PairEqual(&SlewOut[0], &SlewOut[1]));
+    for (s = 0; s < 4; s++) {
+      for (k = 0; k < 3; k++)
+        EXPECT_EQ(Values[s][k], Scl_LibLookup(pSurfs[s], 0.3f * k * k, 0.05f * k));
+      pSurfs[s]->pFlat = pFlats[s];
+    }
+    pTiming->fPaired = fPaired;
+  }
+  EXPECT_GT(nPaired, 0);
+  // the timing computed by several threads is the same
+  SC_Man* p = Abc_SclManStart(pLib, pNtk, 0, 1, 0, 0);
+  SC_Pair* pTimes = ABC_ALLOC(SC_Pair, p->nObjs);
+  SC_Pair* pDepts = ABC_ALLOC(SC_Pair, p->nObjs);
+  memcpy(pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs);
+  memcpy(pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs);
+  p->nProcs = 4;
+  Abc_SclTimeNtkRecompute(p, NULL, NULL, 1, 0);
+  EXPECT_EQ(memcmp(pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs), 0);
+  EXPECT_EQ(memcmp(pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs), 0);
+  ABC_FREE(pTimes);
+  ABC_FREE(pDepts);
+  Abc_SclManFree(p);
+}
+
+static Vec_Ptr_t* SclTestSizeGates(Abc_Frame_t* pAbc, const char* pCommand) {
+  Vec_Ptr_t* vGates = Vec_PtrAlloc(1000);
+  Abc_Obj_t* pObj;
+  int i;
+  EXPECT_EQ(TestCommandExecute(pAbc, "&put; strash; amap; topo"), 0);
+  EXPECT_EQ(TestCommandExecute(pAbc, pCommand), 0);
+  Abc_NtkForEachNode(Abc_FrameReadNtk(pAbc), pObj, i)
+    Vec_PtrPush(vGates, pObj->pData);
+  return vGates;
+}
+
+static int SclTestSameGates(Vec_Ptr_t* vGates1, Vec_Ptr_t* vGates2) {
+  return Vec_PtrSize(vGates1) == Vec_PtrSize(vGates2) &&
+         !memcmp(Vec_PtrArray(vGates1), Vec_PtrArray(vGates2), sizeof(void*) * Vec_PtrSize(vGates1));
+}
+
+TEST(SclTest, ParallelSizingMatchesSerial) {
+  const char* pFileName = "scl_test.lib";
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  SclTestWriteLibrary(pFileName, 3);
+  Abc_FrameUpdateGia(pAbc, TestMultiplier(6, 0, 0));
+  EXPECT_EQ(TestCommandExecute(pAbc, "read_lib scl_test.lib"), 0);
+  remove(pFileName);
+  // the gates tried by several threads lead to the same sizes
+  Vec_Ptr_t* vInit = SclTestSizeGates(pAbc, "topo");
+  Vec_Ptr_t* vSerial = SclTestSizeGates(pAbc, "upsize -I 20; dnsize -I 2");
+  Vec_Ptr_t* vPar = SclTestSizeGates(pAbc, "upsize -I 20 -P 4; dnsize -I 2 -P 4");
+  EXPECT_FALSE(SclTestSameGates(vInit, vSerial));
+  EXPECT_TRUE(SclTestSameGates(vSerial, vPar));
+  Vec_PtrFree(vInit);
+  Vec_PtrFree(vSerial);
+  Vec_PtrFree(vPar);
+}
+
+static int SclTestSameFiles(const char* pFileName1, const char* pFileName2) {
+  FILE* pFile1 = fopen(pFileName1, "rb");
+  FILE* pFile2 = fopen(pFileName2, "rb");
+  int c1 = 0, c2 = 0;
+  while (pFile1 && pFile2 && c1 == c2 && c1 != EOF) {
+    c1 = fgetc(pFile1);
+    c2 = fgetc(pFile2);
+  }
+  if (pFile1) fclose(pFile1);
+  if (pFile2) fclose(pFile2);
+  return pFile1 && pFile2 && c1 == EOF && c2 == EOF;
+}
+
+TEST(SclTest, LibertyImageMatchesParsedLibrary) {
+  char pFileName[] = "scl_test_img.lib";
+  char pImageName[] = "scl_test_img.lib.sclimg";
+  SC_DontUse dont_use = {0, NULL};
+  remove(pImageName);
+  SclTestWriteLibrary(pFileName, 1);
+  // the first read creates the image, the second one uses it
+  SC_Lib* pLib1 = Abc_SclReadLiberty(pFileName, 0, 0, dont_use, 0);
+  SC_Lib* pLib2 = Abc_SclReadLibertyImage(pFileName, pImageName, 0, 0, dont_use, 0);
+  FILE* pFile = fopen(pImageName, "rb");
+  EXPECT_TRUE(pFile != NULL);
+  if (pFile) fclose(pFile);
+  SC_Lib* pLib3 = Abc_SclReadLibertyImage(pFileName, pImageName, 0, 0, dont_use, 0);
+  ASSERT_TRUE(pLib1 != NULL && pLib2 != NULL && pLib3 != NULL);
+  Abc_SclWriteScl((char*)"scl_test_img1.scl", pLib1);
+  Abc_SclWriteScl((char*)"scl_test_img3.scl", pLib3);
+  EXPECT_TRUE(SclTestSameFiles("scl_test_img1.scl", "scl_test_img3.scl"));
+  EXPECT_EQ(SC_LibCellNum(pLib3), 3);
+  Abc_SclLibFree(pLib1);
+  Abc_SclLibFree(pLib2);
+  Abc_SclLibFree(pLib3);
+  // the image is not used after the library has changed
+  SclTestWriteLibrary(pFileName, 3);
+  pLib1 = Abc_SclReadLibertyImage(pFileName, pImageName, 0, 0, dont_use, 0);
+  ASSERT_TRUE(pLib1 != NULL);
+  EXPECT_EQ(SC_LibCellNum(pLib1), 9);
+  Abc_SclLibFree(pLib1);
+  remove(pFileName);
+  remove(pImageName);
+  remove("scl_test_img1.scl");
+  remove("scl_test_img3.scl");
+}
+
+ABC_NAMESPACE_IMPL_END
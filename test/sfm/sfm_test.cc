@@ -0,0 +1,30 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "../test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(SfmTest, ParallelMfsIsDeterministic) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* p = TestMultiplier(6, 0, 0);
+  Gia_Man_t* pRes[2];
+  const char* pCommands[2] = {"&if -K 6; &mfs -P 2", "&if -K 6; &mfs -P 4"};
+  int k;
+  for (k = 0; k < 2; k++) {
+    Abc_FrameUpdateGia(pAbc, Gia_ManDup(p));
+    EXPECT_EQ(TestCommandExecute(pAbc, pCommands[k]), 0);
+    pRes[k] = Gia_ManDup(Abc_FrameReadGia(pAbc));
+    Gia_ManTransferMapping(pRes[k], Abc_FrameReadGia(pAbc));
+  }
+  ASSERT_TRUE(pRes[0]->vMapping != NULL && pRes[1]->vMapping != NULL);
+  EXPECT_EQ(Gia_ManAndNum(pRes[0]), Gia_ManAndNum(pRes[1]));
+  EXPECT_TRUE(Vec_IntEqual(pRes[0]->vMapping, pRes[1]->vMapping));
+  EXPECT_TRUE(TestGiaEquivalent(p, pRes[1]));
+  for (k = 0; k < 2; k++)
+    Gia_ManStop(pRes[k]);
+  Gia_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,92 @@
+#ifndef ABC_TEST_UTIL_H
+#define ABC_TEST_UTIL_H
+
+#include "aig/gia/gia.h"
+#include "proof/cec/cec.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_HEADER_START
+
+// random AIG with nCis inputs and about nAnds gates whose fanins are
+// chosen among the existing nodes by an LCG started from Seed; every
+// XorStep-th gate is XOR (no XORs if XorStep is 0); the outputs are
+// every CoStep-th gate (the last gate only if CoStep is 0)
+static inline Gia_Man_t* TestRandomAig(int nCis, int nAnds, unsigned Seed, int XorStep, int CoStep) {
+  Gia_Man_t* p = Gia_ManStart(nCis + nAnds + 1000);
+  int i, nObjsEnd;
+  for (i = 0; i < nCis; i++)
+    Gia_ManAppendCi(p);
+  for (i = 0; i < nAnds; i++) {
+    int nObjs = Gia_ManObjNum(p);
+    int iLit0, iLit1;
+    Seed = 1664525 * Seed + 1013904223;
+    iLit0 = Abc_Var2Lit(1 + (Seed >> 8) % (nObjs - 1), Seed & 1);
+    Seed = 1664525 * Seed + 1013904223;
+    iLit1 = Abc_Var2Lit(1 + (Seed >> 8) % (nObjs - 1), Seed & 1);
+    if (Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1))
+      continue;
+    if (XorStep && i % XorStep == 0)
+      Gia_ManAppendXorReal(p, iLit0, iLit1);
+    else
+      Gia_ManAppendAnd(p, iLit0, iLit1);
+  }
+  // the outputs are added after all gates, so that no gate uses a CO as a fanin
+  nObjsEnd = Gia_ManObjNum(p);
+  if (CoStep == 0)
+    Gia_ManAppendCo(p, Abc_Var2Lit(nObjsEnd - 1, 0));
+  else
+    for (i = nCis + 1; i < nObjsEnd; i += CoStep)
+      Gia_ManAppendCo(p, Abc_Var2Lit(i, i & 1));
+  return p;
+}
+
+// array multiplier adding the partial products of the first operand's bits;
+// if fBug is set, one partial product is replaced by OR
+static inline Gia_Man_t* TestMultiplier(int nBits, int fSwap, int fBug) {
+  Gia_Man_t* p = Gia_ManStart(5000);
+  int i, k, pA[8], pB[8], pSum[16] = {0};
+  Gia_ManHashAlloc(p);
+  for (i = 0; i < nBits; i++)
+    pA[i] = Gia_ManAppendCi(p);
+  for (i = 0; i < nBits; i++)
+    pB[i] = Gia_ManAppendCi(p);
+  if (fSwap)
+    for (i = 0; i < nBits; i++)
+      ABC_SWAP(int, pA[i], pB[i]);
+  for (i = 0; i < nBits; i++) {
+    int iCarry = 0;
+    for (k = 0; k < nBits; k++) {
+      int iProd = (fBug && i == 1 && k == 2) ? Gia_ManHashOr(p, pA[i], pB[k]) : Gia_ManHashAnd(p, pA[i], pB[k]);
+      int iXor = Gia_ManHashXor(p, pSum[i + k], iProd);
+      int iNext = Gia_ManHashOr(p, Gia_ManHashAnd(p, pSum[i + k], iProd), Gia_ManHashAnd(p, iXor, iCarry));
+      pSum[i + k] = Gia_ManHashXor(p, iXor, iCarry);
+      iCarry = iNext;
+    }
+    pSum[i + nBits] = iCarry;
+  }
+  for (i = 0; i < 2 * nBits; i++)
+    Gia_ManAppendCo(p, pSum[i]);
+  Gia_ManHashStop(p);
+  return p;
+}
+
+// returns 1 if the SAT portfolio proves the two AIGs equivalent
+static inline int TestGiaEquivalent(Gia_Man_t* p0, Gia_Man_t* p1) {
+  Gia_Man_t* pMiter = Gia_ManMiter(p0, p1, 0, 0, 0, 0, 0);
+  int RetValue = Cec_GiaProvePortfolio(pMiter, 2, 60, 0, 1);
+  Gia_ManStop(pMiter);
+  return RetValue == 1;
+}
+
+// runs the command in batch mode and returns 0 on success
+static inline int TestCommandExecute(Abc_Frame_t* pAbc, const char* pCommand) {
+  int RetValue;
+  Abc_FrameSetBatchMode(1);
+  RetValue = Cmd_CommandExecute(pAbc, pCommand);
+  Abc_FrameSetBatchMode(0);
+  return RetValue;
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif